@@ -22,7 +22,6 @@
  *******************************************************************************/
 package openj9.internal.foreign.abi;
 
-import java.util.HashMap;
 import java.util.List;
 /*[IF JAVA_SPEC_VERSION >= 21]*/
 import java.util.Objects;
@@ -105,9 +104,11 @@ public class InternalDowncallHandler {
 
 	static final Lookup lookup = MethodHandles.lookup();
 
-	/* The prep_cif and the corresponding argument types are cached & shared in multiple downcalls/threads. */
-	private static final HashMap<Integer, Long> cachedCifNativeThunkAddr = new HashMap<>();
-	private static final HashMap<Integer, Long> cachedArgTypes = new HashMap<>();
+	/* The prep_cif and the corresponding argument types are cached & shared in multiple downcalls/threads,
+	 * keyed by the full layout strings so that distinct signatures can never share a prep_cif.
+	 */
+	private static final ConcurrentHashMap<String, Long> cachedCifNativeThunkAddr = new ConcurrentHashMap<>();
+	private static final ConcurrentHashMap<String, Long> cachedArgTypes = new ConcurrentHashMap<>();
 
 	/* Argument filters that convert the primitive types/MemoryAddress/MemorySegment to long. */
 	private static final MethodHandle booleanToLongArgFilter;
@@ -451,6 +452,24 @@ public class InternalDowncallHandler {
 			retLayoutStr = LayoutStrPreprocessor.getSimplifiedLayoutString(realReturnLayout, true);
 		}
 
+		/*[IF JAVA_SPEC_VERSION >= 21]*/
+		int varArgIdx = LayoutStrPreprocessor.getVarArgIndex(funcDescriptor, linkerOpts);
+		/*[ELSE] JAVA_SPEC_VERSION >= 21 */
+		int varArgIdx = LayoutStrPreprocessor.getVarArgIndex(funcDescriptor);
+		/*[ENDIF] JAVA_SPEC_VERSION >= 21 */
+		String argLayoutStrsKey = argLayoutStrsLine.toString();
+		String argRetLayoutStrsKey = ((varArgIdx >= 0) ? varArgIdx : "") + argLayoutStrsKey + retLayoutStr;
+
+		/* Repeated signatures reuse the cached prep_cif without taking the lock. The argument types
+		 * are always cached before the prep_cif, so they are present once the prep_cif is found.
+		 */
+		Long cifNativeThunk = cachedCifNativeThunkAddr.get(argRetLayoutStrsKey);
+		if (cifNativeThunk != null) {
+			cifNativeThunkAddr = cifNativeThunk.longValue();
+			argTypesAddr = cachedArgTypes.get(argLayoutStrsKey).longValue();
+			return;
+		}
+
 		synchronized (privateClassLock) {
 			/* If a prep_cif for a given function descriptor exists, then the corresponding return & argument layouts
 			 * were already set up for this prep_cif, in which case there is no need to check the layouts.
@@ -463,22 +482,15 @@ public class InternalDowncallHandler {
 			 * e.g.  C_INT without the layout name = b32[abi/kind=INT]
 			 *  and  C_INT with the layout name = b32(int)[abi/kind=INT,layout/name=int]
 			 */
-			/*[IF JAVA_SPEC_VERSION >= 21]*/
-			int varArgIdx = LayoutStrPreprocessor.getVarArgIndex(funcDescriptor, linkerOpts);
-			/*[ELSE] JAVA_SPEC_VERSION >= 21 */
-			int varArgIdx = LayoutStrPreprocessor.getVarArgIndex(funcDescriptor);
-			/*[ENDIF] JAVA_SPEC_VERSION >= 21 */
-			String argRetLayoutStrsLine = ((varArgIdx >= 0) ? varArgIdx : "") + argLayoutStrsLine.toString() + retLayoutStr;
-			Integer argRetLayoutStrLineHash = Integer.valueOf(argRetLayoutStrsLine.hashCode());
-			Integer argLayoutStrsLineHash = Integer.valueOf(argLayoutStrsLine.toString().hashCode());
-			Long cifNativeThunk = cachedCifNativeThunkAddr.get(argRetLayoutStrLineHash);
+			cifNativeThunk = cachedCifNativeThunkAddr.get(argRetLayoutStrsKey);
 			if (cifNativeThunk != null) {
 				cifNativeThunkAddr = cifNativeThunk.longValue();
-				argTypesAddr = cachedArgTypes.get(argLayoutStrsLineHash).longValue();
+				argTypesAddr = cachedArgTypes.get(argLayoutStrsKey).longValue();
 			} else {
-				boolean newArgTypes = cachedArgTypes.containsKey(argLayoutStrsLineHash) ? false : true;
+				Long argTypes = cachedArgTypes.get(argLayoutStrsKey);
+				boolean newArgTypes = (argTypes == null);
 				if (!newArgTypes) {
-					argTypesAddr = cachedArgTypes.get(argLayoutStrsLineHash).longValue();
+					argTypesAddr = argTypes.longValue();
 				}
 
 				/* Prepare the prep_cif for the native function specified by the arguments/return layouts. */
@@ -486,9 +498,9 @@ public class InternalDowncallHandler {
 
 				/* Cache the address of prep_cif and argTypes after setting up via the out-of-line native code. */
 				if (newArgTypes) {
-					cachedArgTypes.put(argLayoutStrsLineHash, Long.valueOf(argTypesAddr));
+					cachedArgTypes.put(argLayoutStrsKey, Long.valueOf(argTypesAddr));
 				}
-				cachedCifNativeThunkAddr.put(argRetLayoutStrLineHash, Long.valueOf(cifNativeThunkAddr));
+				cachedCifNativeThunkAddr.put(argRetLayoutStrsKey, Long.valueOf(cifNativeThunkAddr));
 			}
 		}
 	}
@@ -874,6 +874,36 @@ public class MemoryMXBeanImpl extends LazyDelegatingNotifier implements MemoryMX
 		return getCurrentGCThreadsImpl();
 	}
 
+	/**
+	 * Returns the sum of the drops in process resident set size across all idle cycles.
+	 *
+	 * @return resident set size reduction in bytes, or -1 if idle tuning is not active
+	 * @see #getIdleResidentSetReduction()
+	 */
+	private native long getIdleResidentSetReductionImpl();
+
+	/**
+	 * {@inheritDoc}
+	 */
+	public long getIdleResidentSetReduction() {
+		return getIdleResidentSetReductionImpl();
+	}
+
+	/**
+	 * Returns the drop in process resident set size across the most recent idle cycle.
+	 *
+	 * @return resident set size reduction in bytes, or -1 if idle tuning is not active
+	 * @see #getLastIdleResidentSetReduction()
+	 */
+	private native long getLastIdleResidentSetReductionImpl();
+
+	/**
+	 * {@inheritDoc}
+	 */
+	public long getLastIdleResidentSetReduction() {
+		return getLastIdleResidentSetReductionImpl();
+	}
+
 	/**
 	 * {@inheritDoc}
 	 */
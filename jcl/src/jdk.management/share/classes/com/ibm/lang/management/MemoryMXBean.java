@@ -310,4 +310,22 @@ public interface MemoryMXBean extends java.lang.management.MemoryMXBean {
      * @return number of active GC worker threads
      */
 	public int getCurrentGCThreads();
+
+	/**
+     * Returns the sum of the drops in process resident set size measured across
+     * all idle cycles (see -XX:+IdleTuningGcOnIdle), in bytes. The value is an
+     * observation of the whole process, sampled before and after each idle
+     * garbage collection; idle cycles are only run by the gencon policy.
+     * 
+     * @return resident set size reduction in bytes, or -1 if idle tuning is not active
+     */
+	public long getIdleResidentSetReduction();
+
+	/**
+     * Returns the drop in process resident set size measured across the most
+     * recent idle cycle, in bytes (0 if the resident set did not shrink).
+     * 
+     * @return resident set size reduction in bytes, or -1 if idle tuning is not active
+     */
+	public long getLastIdleResidentSetReduction();
 }
@@ -60,6 +60,9 @@ j9vm_shadowed_option(J9VM_GC_DEBUG_ASSERTS "Specialized GC assertions are used i
 # become discontiguous whenever this flag is enabled. Since there won’t be any empty arraylet leaves, then arrayoid NULL pointers are no longer required since
 # all data is stored in a unique region. It additionaly reduces footprint, mainly for JNI primitive array critical.
 j9vm_shadowed_option(J9VM_GC_ENABLE_DOUBLE_MAP OMR_GC_DOUBLE_MAP_ARRAYLETS "Allows LINUX and OSX systems to double map arrays that are stored as arraylets.")
+# When enabled, the data of large primitive arrays in balanced GC may be stored in a contiguous block of memory reserved outside
+# of the region heap. The in-heap spine becomes a proxy for the off-heap data and its dataAddr field points directly at it.
+j9vm_shadowed_option(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION OMR_GC_SPARSE_HEAP_ALLOCATION "Allows large primitive arrays to be allocated off heap in balanced GC.")
 j9vm_shadowed_option(J9VM_GC_LARGE_OBJECT_AREA "Enable large object area (LOA) support")
 j9vm_shadowed_option(J9VM_GC_LEAF_BITS "Add leaf bit instance descriptions to classes")
 j9vm_shadowed_option(J9VM_GC_MINIMUM_OBJECT_SIZE "Guarantee a minimum size to all objects allocated")
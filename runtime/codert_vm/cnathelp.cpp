@@ -110,30 +110,18 @@ static VMINLINE UDATA
 convertITableOffsetToVTableOffset(J9VMThread *currentThread, J9Class *receiverClass, J9Class *interfaceClass, UDATA iTableOffset)
 {
 	UDATA vTableOffset = 0;
-	J9ITable * iTable = receiverClass->lastITable;
-	if (interfaceClass == iTable->interfaceClass) {
-		goto foundITable;
-	}
-	
-	iTable = (J9ITable*)receiverClass->iTable;
-	while (NULL != iTable) {
-		if (interfaceClass == iTable->interfaceClass) {
-			receiverClass->lastITable = iTable;
-foundITable:
-			if (J9_UNEXPECTED(J9_ARE_ANY_BITS_SET(iTableOffset, J9_ITABLE_OFFSET_TAG_BITS))) {
-				/* Direct methods should not reach here - no possibility of obtaining a vTableOffset */
-				Assert_CodertVM_false(J9_ARE_ANY_BITS_SET(iTableOffset, J9_ITABLE_OFFSET_DIRECT));
-				/* Object method in the vTable */
-				vTableOffset = iTableOffset & ~J9_ITABLE_OFFSET_TAG_BITS;
-			} else {
-				/* Standard interface method */
-				vTableOffset = *(UDATA*)(((UDATA)iTable) + iTableOffset);
-			}
-			goto done;
+	J9ITable * iTable = VM_VMHelpers::findITable(receiverClass, interfaceClass);
+	if (NULL != iTable) {
+		if (J9_UNEXPECTED(J9_ARE_ANY_BITS_SET(iTableOffset, J9_ITABLE_OFFSET_TAG_BITS))) {
+			/* Direct methods should not reach here - no possibility of obtaining a vTableOffset */
+			Assert_CodertVM_false(J9_ARE_ANY_BITS_SET(iTableOffset, J9_ITABLE_OFFSET_DIRECT));
+			/* Object method in the vTable */
+			vTableOffset = iTableOffset & ~J9_ITABLE_OFFSET_TAG_BITS;
+		} else {
+			/* Standard interface method */
+			vTableOffset = *(UDATA*)(((UDATA)iTable) + iTableOffset);
 		}
-		iTable = iTable->next;
 	}
-done:
 	return vTableOffset;
 }
 
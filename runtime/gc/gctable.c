@@ -118,6 +118,7 @@ J9MemoryManagerFunctions MemoryManagerFunctions = {
 	j9gc_get_softmx,
 	j9gc_get_initial_heap_size,
 	j9gc_get_maximum_heap_size,
+	j9gc_get_idle_rss_statistics,
 	j9gc_objaccess_checkClassLive,
 #if defined(J9VM_GC_OBJECT_ACCESS_BARRIER)
 	j9gc_objaccess_indexableReadI8,
@@ -216,6 +217,10 @@ J9MemoryManagerFunctions MemoryManagerFunctions = {
 	j9mm_iterate_object_slots,
 	j9mm_initialize_object_descriptor,
 	j9mm_iterate_all_objects,
+	j9mm_iterate_all_objects_parallel,
+	j9mm_iterate_regions_parallel,
+	j9mm_get_parallel_walk_thread_count,
+	j9mm_is_parallel_walk_possible,
 	j9gc_modron_isFeatureSupported,
 	j9gc_modron_getConfigurationValueForKey,
 	omrgc_get_version,
@@ -28,7 +28,9 @@
 #include "ModronAssertions.h"
 
 #include "ArrayletLeafIterator.hpp"
+#include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "GlobalCollector.hpp"
 #include "HeapIteratorAPIRootIterator.hpp"
 #include "HeapIteratorAPIBufferedIterator.hpp"
 #include "HeapRegionDescriptor.hpp"
@@ -43,6 +45,8 @@
 #include "ObjectAccessBarrier.hpp"
 #include "OwnableSynchronizerObjectList.hpp"
 #include "ContinuationObjectList.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelTask.hpp"
 #include "PointerArrayIterator.hpp"
 #include "SlotObject.hpp"
 #include "VMInterface.hpp"
@@ -85,6 +89,42 @@ iterateRegionObjects(
 	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData),
 	void *userData);
 
+/**
+ * Task used by j9mm_iterate_regions_parallel (and j9mm_iterate_all_objects_parallel on top of it): every
+ * region of the default memory space is a work unit, handed to the region callback on the claiming worker.
+ */
+class HeapIteratorAPI_ParallelRegionWalkTask : public MM_ParallelTask
+{
+	/* Data Members */
+private:
+	J9JavaVM *_javaVM;
+	jvmtiIterationControl (*_func)(J9JavaVM *vm, J9MM_IterateRegionDescriptor *regionDesc, UDATA workerID, void *userData);
+	void *_userData;
+	volatile bool _aborted; /**< set once any worker's callback returns JVMTI_ITERATION_ABORT */
+protected:
+public:
+
+	/* Member Functions */
+private:
+protected:
+public:
+	virtual UDATA getVMStateID(void) { return J9VMSTATE_GC; }
+	virtual void run(MM_EnvironmentBase *env);
+
+	bool wasAborted() { return _aborted; }
+
+	HeapIteratorAPI_ParallelRegionWalkTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, J9JavaVM *javaVM,
+			jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateRegionDescriptor *regionDesc, UDATA workerID, void *userData), void *userData)
+		: MM_ParallelTask(env, dispatcher)
+		, _javaVM(javaVM)
+		, _func(func)
+		, _userData(userData)
+		, _aborted(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 extern "C" {
 
 /* used by j9mm_iterate_all_objects */
@@ -92,6 +132,10 @@ static jvmtiIterationControl internalIterateHeaps(J9JavaVM *vm, J9MM_IterateHeap
 static jvmtiIterationControl internalIterateSpaces(J9JavaVM *vm, J9MM_IterateSpaceDescriptor *space, void *userData);
 static jvmtiIterationControl internalIterateRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *userData);
 
+/* used by j9mm_iterate_all_objects_parallel */
+static jvmtiIterationControl internalIterateRegionsParallel(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, UDATA workerID, void *userData);
+static jvmtiIterationControl internalIterateObjectsParallel(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData);
+
 typedef struct J9MM_CallbackDataHolderPrivate{
 	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData);
 	void *userData;
@@ -99,6 +143,18 @@ typedef struct J9MM_CallbackDataHolderPrivate{
 	UDATA flags;
 } J9MM_CallbackDataHolderPrivate;
 
+typedef struct J9MM_ParallelObjectWalkDataPrivate {
+	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData);
+	void *userData;
+	UDATA flags;
+} J9MM_ParallelObjectWalkDataPrivate;
+
+/* per-region holder so that the object callback learns the worker it runs on */
+typedef struct J9MM_ParallelObjectWalkRegionDataPrivate {
+	J9MM_ParallelObjectWalkDataPrivate *walkData;
+	UDATA workerID;
+} J9MM_ParallelObjectWalkRegionDataPrivate;
+
 
 typedef enum J9MM_RegionType{
 	j9mm_region_type_region = 0
@@ -362,7 +418,13 @@ iterateArrayletSlots(
 {
 	jvmtiIterationControl returnCode = JVMTI_ITERATION_CONTINUE;
 	if (j9mm_iterator_flag_include_arraylet_leaves == (flags & j9mm_iterator_flag_include_arraylet_leaves) ) {
-		if (MM_GCExtensions::getExtensions(javaVM->omrVM)->indexableObjectModel.hasArrayletLeafPointers((J9IndexableObject *)objectPtr)) {
+		GC_ArrayObjectModel *indexableObjectModel = &MM_GCExtensions::getExtensions(javaVM->omrVM)->indexableObjectModel;
+		bool hasHeapLeaves = indexableObjectModel->hasArrayletLeafPointers((J9IndexableObject *)objectPtr);
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+		/* off heap data is not part of the heap, so its leaves are not reported */
+		hasHeapLeaves = hasHeapLeaves && !indexableObjectModel->isOffHeapDataArray((J9IndexableObject *)objectPtr);
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+		if (hasHeapLeaves) {
 			GC_ArrayletLeafIterator arrayletLeafIterator(javaVM, (J9IndexableObject*)objectPtr);
 			GC_SlotObject *slotObject = NULL;
 
@@ -462,6 +524,92 @@ j9mm_iterate_all_objects(J9JavaVM *vm, J9PortLibrary *portLibrary, UDATA flags,
 	return j9mm_iterate_heaps(vm, portLibrary, flags, &internalIterateHeaps, &data);
 }
 
+/**
+ * Walk all objects of the default memory space, distributing regions over the GC worker threads.
+ * @see HeapIteratorAPI.h
+ */
+jvmtiIterationControl
+j9mm_iterate_all_objects_parallel(J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData), void *userData)
+{
+	J9MM_ParallelObjectWalkDataPrivate data;
+	data.func = func;
+	data.userData = userData;
+	data.flags = flags;
+	/* object walks always need a walkable heap, so never pass regions_read_only through */
+	return j9mm_iterate_regions_parallel(vmThread, portLibrary, 0, internalIterateRegionsParallel, &data);
+}
+
+/**
+ * Walk all regions of the default memory space, distributing them over the GC worker threads.
+ * @see HeapIteratorAPI.h
+ */
+jvmtiIterationControl
+j9mm_iterate_regions_parallel(J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateRegionDescriptor *regionDesc, UDATA workerID, void *userData), void *userData)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(vm->omrVM);
+
+	if (NULL == vm->defaultMemorySpace) {
+		return JVMTI_ITERATION_CONTINUE;
+	}
+
+	if (j9mm_iterator_flag_regions_read_only != (flags & j9mm_iterator_flag_regions_read_only)) {
+		/* make sure the heap is walkable (flush TLH's, secure heap integrity) */
+		vm->memoryManagerFunctions->j9gc_flush_caches_for_walk(vm);
+	}
+
+	MM_MemorySpace *memorySpace = MM_MemorySpace::getMemorySpace(vm->defaultMemorySpace);
+	MM_HeapRegionManager *manager = memorySpace->getHeap()->getHeapRegionManager();
+	jvmtiIterationControl returnCode = JVMTI_ITERATION_CONTINUE;
+	manager->lock();
+	if (j9mm_is_parallel_walk_possible(vmThread)) {
+		HeapIteratorAPI_ParallelRegionWalkTask walkTask(env, extensions->dispatcher, vm, func, userData);
+		extensions->dispatcher->run(env, &walkTask);
+		if (walkTask.wasAborted()) {
+			returnCode = JVMTI_ITERATION_ABORT;
+		}
+	} else {
+		/* the dispatcher is busy with concurrent GC work, walk the regions on this thread */
+		GC_HeapRegionIterator regionIterator(manager, memorySpace);
+		MM_HeapRegionDescriptor *region = NULL;
+		while ((JVMTI_ITERATION_CONTINUE == returnCode) && (NULL != (region = regionIterator.nextRegion()))) {
+			J9MM_IterateRegionDescriptorPrivate regionDescription;
+			regionDescription.type = j9mm_region_type_region;
+			initializeRegionDescriptor(extensions, &regionDescription.descriptor, region);
+			returnCode = func(vm, &regionDescription.descriptor, 0, userData);
+		}
+	}
+	manager->unlock();
+
+	return returnCode;
+}
+
+UDATA
+j9mm_get_parallel_walk_thread_count(J9JavaVM *vm)
+{
+	return MM_GCExtensionsBase::getExtensions(vm->omrVM)->dispatcher->threadCountMaximum();
+}
+
+/**
+ * Answer whether the parallel walks can run on the GC worker threads.
+ * @see HeapIteratorAPI.h
+ */
+BOOLEAN
+j9mm_is_parallel_walk_possible(J9VMThread *vmThread)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (extensions->isConcurrentScavengerInProgress()) {
+		return FALSE;
+	}
+	if (extensions->getGlobalCollector()->isConcurrentWorkAvailable(env)) {
+		return FALSE;
+	}
+	return TRUE;
+}
+
 /* used by j9mm_iterate_all_objects */
 static jvmtiIterationControl
 internalIterateHeaps(J9JavaVM *vm, J9MM_IterateHeapDescriptor *heap, void *userData)
@@ -484,6 +632,24 @@ internalIterateRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void
 	return j9mm_iterate_region_objects(vm, data->portLibrary, region, data->flags, data->func, data->userData);
 }
 
+/* used by j9mm_iterate_all_objects_parallel */
+static jvmtiIterationControl
+internalIterateRegionsParallel(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, UDATA workerID, void *userData)
+{
+	J9MM_ParallelObjectWalkDataPrivate *data = (J9MM_ParallelObjectWalkDataPrivate *)userData;
+	J9MM_ParallelObjectWalkRegionDataPrivate regionData;
+	regionData.walkData = data;
+	regionData.workerID = workerID;
+	return iterateRegionObjects(vm, region, data->flags, internalIterateObjectsParallel, &regionData);
+}
+
+static jvmtiIterationControl
+internalIterateObjectsParallel(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData)
+{
+	J9MM_ParallelObjectWalkRegionDataPrivate *regionData = (J9MM_ParallelObjectWalkRegionDataPrivate *)userData;
+	return regionData->walkData->func(vm, object, regionData->workerID, regionData->walkData->userData);
+}
+
 /**
  * Walk all ownable synchronizer object, call user provided function.
  * @param flags The flags describing the walk (unused currently)
@@ -772,6 +938,27 @@ iterateRegionObjects(
 	return returnCode;
 }
 
+void
+HeapIteratorAPI_ParallelRegionWalkTask::run(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(_javaVM->omrVM);
+	MM_MemorySpace *memorySpace = MM_MemorySpace::getMemorySpace(_javaVM->defaultMemorySpace);
+	UDATA workerID = env->getWorkerID();
+
+	GC_HeapRegionIterator regionIterator(memorySpace->getHeap()->getHeapRegionManager(), memorySpace);
+	MM_HeapRegionDescriptor *region = NULL;
+	while ((!_aborted) && (NULL != (region = regionIterator.nextRegion()))) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			J9MM_IterateRegionDescriptorPrivate regionDescription;
+			regionDescription.type = j9mm_region_type_region;
+			initializeRegionDescriptor(extensions, &regionDescription.descriptor, region);
+			if (JVMTI_ITERATION_ABORT == _func(_javaVM, &regionDescription.descriptor, workerID, _userData)) {
+				_aborted = true;
+			}
+		}
+	}
+}
+
 /**
  * Find the Region that the pointer belongs too.
  * Returns true if region found.
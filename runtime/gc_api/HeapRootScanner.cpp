@@ -399,7 +399,10 @@ MM_HeapRootScanner::scanJNIGlobalReferences()
 	J9Object **slot;
 
 	while ((slot = (J9Object **)jniGlobalReferenceIterator.nextSlot()) != NULL) {
-		doJNIGlobalReferenceSlot(slot, &jniGlobalReferenceIterator);
+		/* Slots cached by threads or deleted but not yet returned to the pool are NULL */
+		if (NULL != *slot) {
+			doJNIGlobalReferenceSlot(slot, &jniGlobalReferenceIterator);
+		}
 	}
 
 	reportScanningEnded(RootScannerEntity_JNIGlobalReferences);
@@ -105,6 +105,8 @@ MM_ClassLoaderManager::initialize(MM_EnvironmentBase *env)
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	_firstUndeadSegment = NULL;
 	_undeadSegmentsTotalSize = 0;
+	_firstDeferredSegment = NULL;
+	_deferredSegmentsTotalSize = 0;
 	
 	if (0 != omrthread_monitor_init_with_name(&_undeadSegmentListMonitor, 0, "Undead Segment List Monitor")) {		
 		return false;
@@ -170,6 +172,72 @@ MM_ClassLoaderManager::flushUndeadSegments(MM_EnvironmentBase *env)
 	}
 }
 
+bool
+MM_ClassLoaderManager::isConcurrentCleanupEnabled()
+{
+#if defined(J9VM_GC_VLHGC) && defined(J9VM_GC_FINALIZATION)
+	return _extensions->isVLHGC() && _extensions->tarokConcurrentClassUnloadCleanup;
+#else /* J9VM_GC_VLHGC && J9VM_GC_FINALIZATION */
+	return false;
+#endif /* J9VM_GC_VLHGC && J9VM_GC_FINALIZATION */
+}
+
+void
+MM_ClassLoaderManager::enqueueDeferredClassSegments(J9MemorySegment *listRoot)
+{
+	if (NULL != listRoot) {
+		omrthread_monitor_enter(_undeadSegmentListMonitor);
+
+		while (NULL != listRoot) {
+			_deferredSegmentsTotalSize += listRoot->size;
+			J9MemorySegment *nextSegment = listRoot->nextSegmentInClassLoader;
+			listRoot->nextSegmentInClassLoader = _firstDeferredSegment;
+			_firstDeferredSegment = listRoot;
+			listRoot = nextSegment;
+		}
+		omrthread_monitor_exit(_undeadSegmentListMonitor);
+	}
+}
+
+void
+MM_ClassLoaderManager::flushDeferredSegments(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_undeadSegmentListMonitor);
+	J9MemorySegment *walker = _firstDeferredSegment;
+	_firstDeferredSegment = NULL;
+	_deferredSegmentsTotalSize = 0;
+	omrthread_monitor_exit(_undeadSegmentListMonitor);
+
+	if (NULL != walker) {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
+		U_64 startTime = j9time_hires_clock();
+		while (NULL != walker) {
+			J9MemorySegment *thisWalk = walker;
+			walker = thisWalk->nextSegmentInClassLoader;
+			_javaVM->internalVMFunctions->freeMemorySegment(_javaVM, thisWalk, TRUE);
+		}
+		addConcurrentCleanupTime(j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+	}
+}
+
+void
+MM_ClassLoaderManager::addConcurrentCleanupTime(U_64 time)
+{
+	omrthread_monitor_enter(_undeadSegmentListMonitor);
+	_concurrentCleanupTime += time;
+	omrthread_monitor_exit(_undeadSegmentListMonitor);
+}
+
+U_64
+MM_ClassLoaderManager::consumeConcurrentCleanupTime()
+{
+	omrthread_monitor_enter(_undeadSegmentListMonitor);
+	U_64 time = _concurrentCleanupTime;
+	_concurrentCleanupTime = 0;
+	omrthread_monitor_exit(_undeadSegmentListMonitor);
+	return time;
+}
+
 void
 MM_ClassLoaderManager::setLastUnloadNumOfClassLoaders() 
 {
@@ -564,6 +632,10 @@ MM_ClassLoaderManager::cleanUpClassLoaders(MM_EnvironmentBase *env, J9ClassLoade
 {
 	*reclaimedSegments = NULL;
 	*unloadLink = NULL;
+	_deferredClassLoaderCount = 0;
+#if defined(J9VM_GC_FINALIZATION)
+	bool deferClassLoaderFree = isConcurrentCleanupEnabled();
+#endif /* J9VM_GC_FINALIZATION */
 
 	/*
 	 * Cleanup segments in anonymous classloader
@@ -593,16 +665,19 @@ MM_ClassLoaderManager::cleanUpClassLoaders(MM_EnvironmentBase *env, J9ClassLoade
 		_javaVM->internalVMFunctions->cleanUpClassLoader((J9VMThread *)env->getLanguageVMThread(), classLoader);
 
 #if defined(J9VM_GC_FINALIZATION)
-		/* Determine if the classLoader needs to be enqueued for finalization (for shared library unloading),
-		 * otherwise add it to the list of classLoaders to be unloaded by cleanUpClassLoadersEnd.
+		/* Determine if the classLoader needs to be enqueued for finalization (for shared library unloading, or
+		 * because freeing it has been moved out of the pause), otherwise add it to the list of classLoaders to be
+		 * unloaded by cleanUpClassLoadersEnd.
 		 */
 		if(((NULL != classLoader->sharedLibraries)
 		&& (0 != pool_numElements(classLoader->sharedLibraries)))
-		|| (_extensions->fvtest_forceFinalizeClassLoaders)) {
+		|| (_extensions->fvtest_forceFinalizeClassLoaders)
+		|| deferClassLoaderFree) {
 			/* Enqueue the class loader for the finalizer */
 			buffer.add(env, classLoader);
 			classLoader->gcFlags |= J9_GC_CLASS_LOADER_ENQ_UNLOAD;
 			*finalizationRequired = true;
+			_deferredClassLoaderCount += 1;
 		} else {
 			/* Add the classLoader to the list of classLoaders to be unloaded by cleanUpClassLoadersEnd */
 			classLoader->unloadLink = *unloadLink;
@@ -54,6 +54,10 @@ private:
 	omrthread_monitor_t _undeadSegmentListMonitor;
 	J9MemorySegment *_firstUndeadSegment;
 	UDATA _undeadSegmentsTotalSize;
+	J9MemorySegment *_firstDeferredSegment; /**< RAM class segments left for the finalizer thread to free after the pause (protected by _undeadSegmentListMonitor) */
+	UDATA _deferredSegmentsTotalSize; /**< total size, in bytes, of the segments on the deferred list */
+	UDATA _deferredClassLoaderCount; /**< number of dead class loaders handed to the finalizer thread by the last unloading pass */
+	U_64 _concurrentCleanupTime; /**< time, in microseconds, the finalizer thread has spent on deferred cleanup since it was last consumed (protected by _undeadSegmentListMonitor) */
 	UDATA _lastUnloadNumOfClassLoaders;  /**< number of class loaders last seen during a dynamic class unloading pass */
 	UDATA _lastUnloadNumOfAnonymousClasses; /**< number of anonymous classes last seen during a dynamic class unloading pass */
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
@@ -73,6 +77,10 @@ public:
 		,_undeadSegmentListMonitor(NULL)
 		,_firstUndeadSegment(NULL)
 		,_undeadSegmentsTotalSize(0)
+		,_firstDeferredSegment(NULL)
+		,_deferredSegmentsTotalSize(0)
+		,_deferredClassLoaderCount(0)
+		,_concurrentCleanupTime(0)
 		,_lastUnloadNumOfClassLoaders(0)
 		,_lastUnloadNumOfAnonymousClasses(0)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
@@ -102,6 +110,46 @@ public:
 	 * Returns the total amount of memory (in bytes) which would be reclaimed if the buffer were to be flushed
 	 */
 	UDATA reclaimableMemory() { return _undeadSegmentsTotalSize; }
+
+	/**
+	 * Answer true if dead class loaders and their RAM class segments should be freed by the finalizer thread
+	 * once the collection pause has ended, rather than inside the pause.  Only Balanced can do this since it
+	 * never needs to walk dead objects (and therefore their classes) after class unloading.
+	 */
+	bool isConcurrentCleanupEnabled();
+
+	/**
+	 * Adds the list of memory segments to the queue freed by the finalizer thread outside of the pause.
+	 * @param listRoot The root of the segments to be added (follow nextSegmentInClassLoader link to traverse)
+	 */
+	void enqueueDeferredClassSegments(J9MemorySegment *listRoot);
+
+	/**
+	 * Frees the segments queued by enqueueDeferredClassSegments.  Called by the finalizer thread, which must hold VM access.
+	 * @param env The environment
+	 */
+	void flushDeferredSegments(MM_EnvironmentBase *env);
+
+	/**
+	 * Account for time spent by the finalizer thread on deferred class unloading cleanup.
+	 * @param time The time, in microseconds
+	 */
+	void addConcurrentCleanupTime(U_64 time);
+
+	/**
+	 * Returns the time, in microseconds, spent on deferred cleanup since the last call, and resets it.
+	 */
+	U_64 consumeConcurrentCleanupTime();
+
+	/**
+	 * Returns the number of dead class loaders handed to the finalizer thread by the last unloading pass
+	 */
+	UDATA getDeferredClassLoaderCount() { return _deferredClassLoaderCount; }
+
+	/**
+	 * Returns the total size, in bytes, of the class segments still waiting for the finalizer thread to free them
+	 */
+	UDATA getDeferredSegmentsTotalSize() { return _deferredSegmentsTotalSize; }
 	
 	/**
 	 * Returns the number of class loaders last seen during a dynamic class unloading pass
@@ -28,6 +28,7 @@
 
 #if defined(J9VM_GC_FINALIZATION)
 
+#include "AtomicOperations.hpp"
 #include "FinalizeListManager.hpp"
 #include "GCExtensions.hpp"
 #include "Debug.hpp"
@@ -109,6 +110,57 @@ GC_FinalizeListManager::tearDown()
 	}
 }
 
+void
+GC_FinalizeListManager::jobsAdded()
+{
+	UDATA jobCount = _classLoaderCount + _defaultFinalizableObjectCount + _systemFinalizableObjectCount + _referenceObjectCount;
+	if (jobCount > _maxJobCount) {
+		_maxJobCount = jobCount;
+	}
+	/* lists are rebuilt in place when objects move, so only the first add after a drain starts the clock */
+	if ((0 == _oldestPendingTime) && (0 != jobCount)) {
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		_oldestPendingTime = omrtime_hires_clock();
+	}
+}
+
+void
+GC_FinalizeListManager::queueDrained()
+{
+	if (0 != _oldestPendingTime) {
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		U_64 latency = omrtime_hires_delta(_oldestPendingTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (latency > _maxDrainLatency) {
+			_maxDrainLatency = latency;
+		}
+		_oldestPendingTime = 0;
+	}
+}
+
+U_64
+GC_FinalizeListManager::getOldestPendingAge()
+{
+	U_64 age = 0;
+	U_64 oldestPendingTime = _oldestPendingTime;
+	if (0 != oldestPendingTime) {
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		age = omrtime_hires_delta(oldestPendingTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	}
+	return age;
+}
+
+void
+GC_FinalizeListManager::workerActivated()
+{
+	MM_AtomicOperations::add(&_activeWorkerCount, 1);
+}
+
+void
+GC_FinalizeListManager::workerDeactivated()
+{
+	MM_AtomicOperations::subtract(&_activeWorkerCount, 1);
+}
+
 void
 GC_FinalizeListManager::addSystemFinalizableObjects(j9object_t head, j9object_t tail, UDATA objectCount)
 {
@@ -117,6 +169,7 @@ GC_FinalizeListManager::addSystemFinalizableObjects(j9object_t head, j9object_t
 	_extensions->accessBarrier->setFinalizeLink(tail, _systemFinalizableObjects);
 	_systemFinalizableObjects = head;
 	_systemFinalizableObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -142,6 +195,7 @@ GC_FinalizeListManager::addDefaultFinalizableObjects(j9object_t head, j9object_t
 	_extensions->accessBarrier->setFinalizeLink(tail, _defaultFinalizableObjects);
 	_defaultFinalizableObjects = head;
 	_defaultFinalizableObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -167,6 +221,7 @@ GC_FinalizeListManager::addReferenceObjects(j9object_t head, j9object_t tail, UD
 	_extensions->accessBarrier->setReferenceLink(tail, _referenceObjects);
 	_referenceObjects = head;
 	_referenceObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -192,6 +247,7 @@ GC_FinalizeListManager::addClassLoaders(J9ClassLoader *head, J9ClassLoader *tail
 	tail->unloadLink = _classLoaders;
 	_classLoaders = head;
 	_classLoaderCount += count;
+	jobsAdded();
 
 	unlock();
 }
@@ -237,52 +293,60 @@ GC_FinalizeListManager::popRequiredClassLoaderForForcedClassLoaderUnload()
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
 GC_FinalizeJob *
-GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
+GC_FinalizeListManager::popJob(GC_FinalizeJob *job, bool includeClassLoaders)
 {
-	Assert_MM_true(J9_PUBLIC_FLAGS_VM_ACCESS == (vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS));
-	Assert_MM_true(1 == omrthread_monitor_owned_by_self(_mutex)); /* caller must be holding _mutex */
-	
-	{
-		j9object_t referenceObject = popReferenceObject();
-		if (NULL != referenceObject) {
-			job->type = FINALIZE_JOB_TYPE_REFERENCE;
-			job->reference = referenceObject;
-
-			return job;
-		}
+	GC_FinalizeJob *result = job;
+	j9object_t referenceObject = NULL;
+	J9ClassLoader *loader = NULL;
+	j9object_t finalizableObject = NULL;
+
+	if (NULL != (referenceObject = popReferenceObject())) {
+		job->type = FINALIZE_JOB_TYPE_REFERENCE;
+		job->reference = referenceObject;
+	} else if (includeClassLoaders && (NULL != (loader = popClassLoader()))) {
+		job->type = FINALIZE_JOB_TYPE_CLASSLOADER;
+		job->classLoader = loader;
+	} else if (NULL != (finalizableObject = popDefaultFinalizableObject())) {
+		job->type = FINALIZE_JOB_TYPE_OBJECT;
+		job->object = finalizableObject;
+	} else if (NULL != (finalizableObject = popSystemFinalizableObject())) {
+		job->type = FINALIZE_JOB_TYPE_OBJECT;
+		job->object = finalizableObject;
+	} else {
+		result = NULL;
 	}
 
-	{
-		J9ClassLoader *loader = popClassLoader();
-		if (NULL != loader) {
-			job->type = FINALIZE_JOB_TYPE_CLASSLOADER;
-			job->classLoader = loader;
-
-			return job;
+	if (NULL != result) {
+		_jobsProcessed += 1;
+		if (0 == (_classLoaderCount + _defaultFinalizableObjectCount + _systemFinalizableObjectCount + _referenceObjectCount)) {
+			queueDrained();
 		}
 	}
 
-	{
-		j9object_t defaultObject = popDefaultFinalizableObject();
-		if (NULL != defaultObject) {
-			job->type = FINALIZE_JOB_TYPE_OBJECT;
-			job->object = defaultObject;
+	return result;
+}
 
-			return job;
-		}
-	}
+GC_FinalizeJob *
+GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
+{
+	Assert_MM_true(J9_PUBLIC_FLAGS_VM_ACCESS == (vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS));
+	Assert_MM_true(1 == omrthread_monitor_owned_by_self(_mutex)); /* caller must be holding _mutex */
 
-	{
-		j9object_t systemObject = popSystemFinalizableObject();
-		if (NULL != systemObject) {
-			job->type = FINALIZE_JOB_TYPE_OBJECT;
-			job->object = systemObject;
+	return popJob(job, true);
+}
 
-			return job;
-		}
+UDATA
+GC_FinalizeListManager::consumeJobs(J9VMThread *vmThread, GC_FinalizeJob *jobs, UDATA maxJobs, bool includeClassLoaders)
+{
+	Assert_MM_true(J9_PUBLIC_FLAGS_VM_ACCESS == (vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS));
+	Assert_MM_true(1 == omrthread_monitor_owned_by_self(_mutex)); /* caller must be holding _mutex */
+
+	UDATA count = 0;
+	while ((count < maxJobs) && (NULL != popJob(&jobs[count], includeClassLoaders))) {
+		count += 1;
 	}
 
-	return NULL;
+	return count;
 }
 
 #endif /* J9VM_GC_FINALIZATION */
@@ -75,6 +75,12 @@ private:
     UDATA _referenceObjectCount; /** count of the reference object */
     J9ClassLoader *_classLoaders; /**< head of the linked list of unloaded classloaders which have open native libraries  */
     UDATA _classLoaderCount; /** count of the class loaders */
+
+    UDATA _maxJobCount; /**< high water mark of the number of jobs on the queue */
+    UDATA _jobsProcessed; /**< total number of jobs handed out to finalizer threads */
+    U_64 _oldestPendingTime; /**< time (hires ticks) when the queue last became non-empty, 0 if the queue is empty */
+    U_64 _maxDrainLatency; /**< longest time (microseconds) the queue has taken to become empty after becoming non-empty */
+    volatile UDATA _activeWorkerCount; /**< number of finalizer threads currently processing jobs */
 protected:
 public:
     
@@ -117,6 +123,31 @@ protected:
      */
     J9ClassLoader *popClassLoader();
 
+    /**
+     * Pop the next job in priority order (references, classloaders, default then system finalizable objects)
+     *
+     * @note Must be called while holding this class' _mutex
+     *
+     * @param job[out] the job to fill in
+     * @param includeClassLoaders[in] false if classloader jobs must be skipped
+     * @return job, or NULL if there is nothing to pop
+     */
+    GC_FinalizeJob *popJob(GC_FinalizeJob *job, bool includeClassLoaders);
+
+    /**
+     * Update queue depth and latency statistics after jobs were added to the queue.
+     *
+     * @note Must be called while holding this class' _mutex
+     */
+    void jobsAdded();
+
+    /**
+     * Update latency statistics once the queue has been drained.
+     *
+     * @note Must be called while holding this class' _mutex
+     */
+    void queueDrained();
+
 public:
 	void lock() const;
 	void unlock() const;
@@ -133,6 +164,37 @@ public:
 		return count;
 	}
 
+	/**
+	 * @return the highest number of jobs observed on the queue
+	 */
+	MMINLINE UDATA getMaxJobCount() {return _maxJobCount;}
+	/**
+	 * @return the total number of jobs handed out to finalizer threads
+	 */
+	MMINLINE UDATA getJobsProcessed() {return _jobsProcessed;}
+	/**
+	 * @return the longest time in microseconds the queue has taken to drain
+	 */
+	MMINLINE U_64 getMaxDrainLatency() {return _maxDrainLatency;}
+	/**
+	 * @return the number of finalizer threads currently processing jobs
+	 */
+	MMINLINE UDATA getActiveWorkerCount() {return _activeWorkerCount;}
+	/**
+	 * Age of the oldest pending job, approximated by the time since the queue became non-empty.
+	 * @return the age in microseconds, or 0 if the queue is empty
+	 */
+	U_64 getOldestPendingAge();
+
+	/**
+	 * Record that a finalizer thread has started processing jobs
+	 */
+	void workerActivated();
+	/**
+	 * Record that a finalizer thread has stopped processing jobs
+	 */
+	void workerDeactivated();
+
 	virtual UDATA getSystemCount() {return _systemFinalizableObjectCount;}
 	virtual UDATA getDefaultCount() {return _defaultFinalizableObjectCount;}
 	MMINLINE UDATA getClassloaderCount() {return _classLoaderCount;}
@@ -331,6 +393,21 @@ public:
 	 */
 	virtual GC_FinalizeJob *consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job);
 
+	/**
+	 * Pop up to maxJobs jobs to process, so that a finalizer thread acquires _mutex once per batch
+	 * rather than once per job.
+	 *
+	 * @note Must be called while holding this class' _mutex. The popped objects are no longer
+	 * reachable from the queue, so the caller must make them visible to the collector (e.g. by
+	 * creating local references) before releasing VM access.
+	 *
+	 * @param jobs[out] array receiving the jobs
+	 * @param maxJobs[in] capacity of jobs
+	 * @param includeClassLoaders[in] false if classloader jobs must be left for the primary worker
+	 * @return the number of jobs popped
+	 */
+	UDATA consumeJobs(J9VMThread *vmThread, GC_FinalizeJob *jobs, UDATA maxJobs, bool includeClassLoaders);
+
 
 	/**
 	 * Create a FinalizeListManager object
@@ -346,6 +423,11 @@ public:
 	    ,_referenceObjectCount(0)
 	    ,_classLoaders(NULL)
 	    ,_classLoaderCount(0)
+	    ,_maxJobCount(0)
+	    ,_jobsProcessed(0)
+	    ,_oldestPendingTime(0)
+	    ,_maxDrainLatency(0)
+	    ,_activeWorkerCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -34,6 +34,7 @@
 
 #include "AtomicOperations.hpp"
 #include "ClassLoaderIterator.hpp"
+#include "ClassLoaderManager.hpp"
 #include "EnvironmentBase.hpp"
 #include "FinalizeListManager.hpp"
 #include "FinalizableObjectBuffer.hpp"
@@ -177,10 +178,44 @@ struct finalizeWorkerData {
 	IDATA wakeUp;
 };
 
+/**
+ * Shared state of the assist workers, which help the primary worker drain a finalization backlog.
+ * Assist workers only process finalizable objects and references; classloaders, forced finalization
+ * and forced classloader unloading remain with the primary worker.
+ */
+struct finalizeAssistData {
+	omrthread_monitor_t monitor;
+	J9JavaVM *vm;
+	UDATA threadCount; /**< number of assist threads started and not yet exited */
+	UDATA activeCount; /**< number of assist threads currently draining the queue, not counting abandoned ones */
+	UDATA abandonedCount; /**< number of assist threads the main thread stopped waiting for because they made no progress */
+	UDATA epoch; /**< incremented each time the main thread abandons the active assist threads */
+	UDATA wakeTokens; /**< number of idle assist threads requested to start draining the queue */
+	UDATA references; /**< main thread plus started assist threads; the last one to release frees this structure */
+	bool die;
+};
+
+/**
+ * Jobs popped from the finalize list manager in one acquisition of its lock, with the local
+ * references keeping the popped objects alive until they are processed.
+ */
+struct finalizeJobBatch {
+	GC_FinalizeJob *jobs;
+	jobject *localRefs;
+	UDATA capacity;
+	GC_FinalizeJob singleJob; /**< used if the batch arrays could not be allocated */
+	jobject singleLocalRef;
+};
+
 static int J9THREAD_PROC FinalizeWorkerThread(void *arg);
 IDATA FinalizeMainRunFinalization(J9JavaVM * vm, omrthread_t * indirectWorkerThreadHandle, struct finalizeWorkerData **indirectWorkerData, IDATA finalizeCycleLimit, IDATA mode);
 static int J9THREAD_PROC FinalizeMainThread(void *javaVM);
 static int  J9THREAD_PROC gpProtectedFinalizeWorkerThread(void *entryArg);
+static int J9THREAD_PROC gpProtectedFinalizeAssistThread(void *entryArg);
+static struct finalizeAssistData *FinalizeMainCreateAssistData(J9JavaVM *vm);
+static void FinalizeMainRequestAssist(J9JavaVM *vm, struct finalizeAssistData *assistData, UDATA jobCount);
+static void FinalizeMainWaitForAssistIdle(J9JavaVM *vm, struct finalizeAssistData *assistData, IDATA finalizeCycleLimit);
+static void FinalizeMainShutdownAssist(J9JavaVM *vm, struct finalizeAssistData *assistData);
 
 static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 {
@@ -188,6 +223,7 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 	omrthread_t workerThreadHandle;
 	int noCycleWait;
 	struct finalizeWorkerData *workerData = NULL;
+	struct finalizeAssistData *assistData = NULL;
 	IDATA finalizeCycleInterval, finalizeCycleLimit, currentWaitTime, finalizableListUsed;
 	IDATA cycleIntervalWaitResult;
 	UDATA workerMode, savedFinalizeMainFlags;
@@ -208,6 +244,11 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 	finalizeCycleInterval = extensions->finalizeCycleInterval;
 	finalizeCycleLimit = extensions->finalizeCycleLimit;
 
+	/* Assist workers are only started once a backlog builds up, failure to set them up leaves the primary worker alone */
+	if (extensions->finalizeMaxWorkerThreads > 1) {
+		assistData = FinalizeMainCreateAssistData(vm);
+	}
+
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
 	if(NULL != vm->javaOffloadSwitchOnNoEnvWithReasonFunc) {
 		(*vm->javaOffloadSwitchOnNoEnvWithReasonFunc)(vm, vm->finalizeMainThread, J9_JNI_OFFLOAD_SWITCH_GC_FINALIZE_MAIN_THREAD);
@@ -271,6 +312,11 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 
 		savedFinalizeMainFlags = vm->finalizeMainFlags;
 
+		/* Wake up assist workers in proportion to the backlog */
+		if ((NULL != assistData) && (FINALIZE_WORKER_MODE_NORMAL == workerMode)) {
+			FinalizeMainRequestAssist(vm, assistData, (UDATA)finalizableListUsed);
+		}
+
 		IDATA result = FinalizeMainRunFinalization(vm, &workerThreadHandle, &workerData, finalizeCycleLimit, workerMode);
 		if(result < 0) {
 			/* give up this run and hope next time will be better */
@@ -289,6 +335,12 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 					currentWaitTime = 0;
 					if(savedFinalizeMainFlags & J9_FINALIZE_FLAGS_RUN_FINALIZATION) {
+						if (NULL != assistData) {
+							/* jobs popped by assist workers may still be running */
+							omrthread_monitor_exit(workerData->monitor);
+							FinalizeMainWaitForAssistIdle(vm, assistData, finalizeCycleLimit);
+							omrthread_monitor_enter(workerData->monitor);
+						}
 						vm->finalizeMainFlags &= ~J9_FINALIZE_FLAGS_RUN_FINALIZATION;
 						omrthread_monitor_enter(vm->finalizeRunFinalizationMutex);
 						omrthread_monitor_notify_all(vm->finalizeRunFinalizationMutex);
@@ -307,6 +359,11 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 	} while(!(vm->finalizeMainFlags & J9_FINALIZE_FLAGS_SHUTDOWN));
 
 	/* We've been told to die */
+	if (NULL != assistData) {
+		FinalizeMainShutdownAssist(vm, assistData);
+		assistData = NULL;
+	}
+
 	if(NULL != workerThreadHandle) {
 		omrthread_monitor_exit((omrthread_monitor_t)vm->finalizeMainMonitor);
 		omrthread_monitor_enter(workerData->monitor);
@@ -346,7 +403,7 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 }
 
 static void
-process_finalizable(J9VMThread *vmThread, j9object_t object, jclass j9VMInternalsClass, jmethodID runFinalizeMID)
+process_finalizable(J9VMThread *vmThread, jobject localRef, jclass j9VMInternalsClass, jmethodID runFinalizeMID)
 {
 	J9InternalVMFunctions* fns;
 	J9JavaVM *vm;
@@ -354,8 +411,6 @@ process_finalizable(J9VMThread *vmThread, j9object_t object, jclass j9VMInternal
 	vm = vmThread->javaVM;
 	fns = vm->internalVMFunctions;
 
-	jobject localRef = fns->j9jni_createLocalRef((JNIEnv *)vmThread, object);
-
 	fns->internalReleaseVMAccess(vmThread);
 
 	if((NULL != j9VMInternalsClass) && (NULL != runFinalizeMID)) {
@@ -375,7 +430,7 @@ process_finalizable(J9VMThread *vmThread, j9object_t object, jclass j9VMInternal
 }
 
 static void
-process_reference(J9VMThread *vmThread, j9object_t reference, jmethodID refMID)
+process_reference(J9VMThread *vmThread, jobject localRef, jmethodID refMID)
 {
 	J9InternalVMFunctions* fns;
 	J9JavaVM *vm;
@@ -383,8 +438,6 @@ process_reference(J9VMThread *vmThread, j9object_t reference, jmethodID refMID)
 	vm = vmThread->javaVM;
 	fns = vm->internalVMFunctions;
 
-	jobject localRef = fns->j9jni_createLocalRef((JNIEnv *)vmThread, reference);
-
 	fns->internalReleaseVMAccess(vmThread);
 
 	if (refMID) {
@@ -416,19 +469,27 @@ process_classloader(J9VMThread *vmThread, J9ClassLoader *classLoader)
 
 	fns->internalEnterVMFromJNI(vmThread);
 	Assert_MM_true(NULL == classLoader->classSegments);
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	U_64 startTime = j9time_hires_clock();
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	fns->freeClassLoader(classLoader, vm, vmThread, JNI_FALSE);
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	/* report the time so verbose GC can show how much unloading work was moved out of the pause */
+	MM_GCExtensions::getExtensions(vm)->classLoaderManager->addConcurrentCleanupTime(j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	fns->internalReleaseVMAccess(vmThread);
 
 	fns->internalEnterVMFromJNI(vmThread);
 }
 
 static void
-process(J9VMThread *vmThread, const GC_FinalizeJob *finalizeJob, jclass j9VMInternalsClass, jmethodID runFinalizeMID, jmethodID referenceEnqueueImplMID)
+process(J9VMThread *vmThread, const GC_FinalizeJob *finalizeJob, jobject localRef, jclass j9VMInternalsClass, jmethodID runFinalizeMID, jmethodID referenceEnqueueImplMID)
 {
 	if (FINALIZE_JOB_TYPE_OBJECT == (finalizeJob->type & FINALIZE_JOB_TYPE_OBJECT)) {
-		process_finalizable(vmThread, finalizeJob->object, j9VMInternalsClass, runFinalizeMID);
+		process_finalizable(vmThread, localRef, j9VMInternalsClass, runFinalizeMID);
 	} else if (FINALIZE_JOB_TYPE_REFERENCE == (finalizeJob->type & FINALIZE_JOB_TYPE_REFERENCE)) {
-		process_reference(vmThread, finalizeJob->reference, referenceEnqueueImplMID);
+		process_reference(vmThread, localRef, referenceEnqueueImplMID);
 	} else if (FINALIZE_JOB_TYPE_CLASSLOADER == (finalizeJob->type & FINALIZE_JOB_TYPE_CLASSLOADER)) {
 		process_classloader(vmThread, finalizeJob->classLoader);
 	} else {
@@ -436,6 +497,153 @@ process(J9VMThread *vmThread, const GC_FinalizeJob *finalizeJob, jclass j9VMInte
 	}
 }
 
+static void
+initializeJobBatch(MM_Forge *forge, struct finalizeJobBatch *batch, UDATA capacity)
+{
+	if (capacity <= 1) {
+		/* batching is disabled (the default), pop a single job at a time */
+		batch->jobs = &batch->singleJob;
+		batch->localRefs = &batch->singleLocalRef;
+		batch->capacity = 1;
+		return;
+	}
+
+	batch->jobs = (GC_FinalizeJob *)forge->allocate(capacity * sizeof(GC_FinalizeJob), MM_AllocationCategory::FINALIZE, J9_GET_CALLSITE());
+	batch->localRefs = (jobject *)forge->allocate(capacity * sizeof(jobject), MM_AllocationCategory::FINALIZE, J9_GET_CALLSITE());
+	batch->capacity = capacity;
+	if ((NULL == batch->jobs) || (NULL == batch->localRefs)) {
+		/* fall back to popping a single job at a time */
+		if (NULL != batch->jobs) {
+			forge->free(batch->jobs);
+		}
+		if (NULL != batch->localRefs) {
+			forge->free(batch->localRefs);
+		}
+		batch->jobs = &batch->singleJob;
+		batch->localRefs = &batch->singleLocalRef;
+		batch->capacity = 1;
+	}
+}
+
+static void
+tearDownJobBatch(MM_Forge *forge, struct finalizeJobBatch *batch)
+{
+	if (batch->jobs != &batch->singleJob) {
+		forge->free(batch->jobs);
+		forge->free(batch->localRefs);
+	}
+	batch->jobs = NULL;
+	batch->localRefs = NULL;
+	batch->capacity = 0;
+}
+
+/**
+ * Flag that references are being processed, so Reference.waitForReferenceProcessing() blocks until progress is made
+ */
+static void
+startReferenceProcessing(J9JavaVM *vm, GC_FinalizeListManager *finalizeListManager)
+{
+	if ((NULL != vm->processReferenceMonitor) && (0 != finalizeListManager->getReferenceCount())) {
+		omrthread_monitor_enter(vm->processReferenceMonitor);
+		vm->processReferenceActive = 1;
+		omrthread_monitor_exit(vm->processReferenceMonitor);
+	}
+}
+
+/**
+ * Notify waiters in Reference.waitForReferenceProcessing() that a job has been processed
+ */
+static void
+reportReferenceProcessingProgress(J9JavaVM *vm, GC_FinalizeListManager *finalizeListManager)
+{
+	if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
+		omrthread_monitor_enter(vm->processReferenceMonitor);
+		if (0 == finalizeListManager->getReferenceCount()) {
+			/* There is no more pending reference. */
+			vm->processReferenceActive = 0;
+		}
+		/*
+		 * Notify any waiters that progress has been made.
+		 * This improves latency for Reference.waitForReferenceProcessing() and try to
+		 * avoid the performance issue if there are many of pending references in the queue.
+		 */
+		omrthread_monitor_notify_all(vm->processReferenceMonitor);
+		omrthread_monitor_exit(vm->processReferenceMonitor);
+	}
+}
+
+/**
+ * Process a batch of jobs popped from the finalize list manager.
+ * @note Must be called with VM access; processing releases and reacquires it.
+ */
+static void
+processJobBatch(J9VMThread *vmThread, struct finalizeJobBatch *batch, UDATA jobCount, jclass j9VMInternalsClass, jmethodID runFinalizeMID, jmethodID referenceEnqueueImplMID)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	J9InternalVMFunctions *fns = vm->internalVMFunctions;
+	GC_FinalizeListManager *finalizeListManager = MM_GCExtensions::getExtensions(vm)->finalizeListManager;
+
+	/* Popped objects are no longer reachable from the finalize lists. Local references keep them
+	 * alive, and up to date if they move, while earlier jobs in the batch release VM access.
+	 */
+	for (UDATA i = 0; i < jobCount; i++) {
+		GC_FinalizeJob *finalizeJob = &batch->jobs[i];
+		if (FINALIZE_JOB_TYPE_OBJECT == (finalizeJob->type & FINALIZE_JOB_TYPE_OBJECT)) {
+			batch->localRefs[i] = fns->j9jni_createLocalRef((JNIEnv *)vmThread, finalizeJob->object);
+		} else if (FINALIZE_JOB_TYPE_REFERENCE == (finalizeJob->type & FINALIZE_JOB_TYPE_REFERENCE)) {
+			batch->localRefs[i] = fns->j9jni_createLocalRef((JNIEnv *)vmThread, finalizeJob->reference);
+		} else {
+			batch->localRefs[i] = NULL;
+		}
+	}
+
+	for (UDATA i = 0; i < jobCount; i++) {
+		/* processing will release/acquire VM access */
+		process(vmThread, &batch->jobs[i], batch->localRefs[i], j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
+		reportReferenceProcessingProgress(vm, finalizeListManager);
+	}
+
+	fns->jniResetStackReferences((JNIEnv *)vmThread);
+}
+
+/**
+ * Look up the Java methods invoked to run finalizers and enqueue references.
+ */
+static void
+lookupFinalizeMethods(J9VMThread *env, jclass *j9VMInternalsClassOut, jmethodID *runFinalizeMIDOut, jmethodID *referenceEnqueueImplMIDOut)
+{
+	J9JavaVM *vm = env->javaVM;
+	jclass referenceClazz = NULL;
+	jclass j9VMInternalsClass = NULL;
+	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
+
+	if(vm->jclFlags & J9_JCL_FLAG_FINALIZATION) {
+		/* Only look up finalization methods if the class library supports them */
+		j9VMInternalsClass = ((JNIEnv *)env)->FindClass("java/lang/J9VMInternals");
+		if (j9VMInternalsClass) {
+			j9VMInternalsClass = (jclass)((JNIEnv *)env)->NewGlobalRef(j9VMInternalsClass);
+			if (j9VMInternalsClass) {
+				runFinalizeMID = ((JNIEnv *)env)->GetStaticMethodID(j9VMInternalsClass, "runFinalize", "(Ljava/lang/Object;)V");
+			}
+		}
+		if (!runFinalizeMID) {
+			((JNIEnv *)env)->ExceptionClear();
+		}
+	
+		referenceClazz = ((JNIEnv *)env)->FindClass("java/lang/ref/Reference");
+		if (referenceClazz) {
+			referenceEnqueueImplMID  = ((JNIEnv *)env)->GetMethodID(referenceClazz, "enqueueImpl", "()Z");
+		}
+		if (!referenceEnqueueImplMID) {
+			((JNIEnv *)env)->ExceptionClear();
+		}
+	}
+
+	*j9VMInternalsClassOut = j9VMInternalsClass;
+	*runFinalizeMIDOut = runFinalizeMID;
+	*referenceEnqueueImplMIDOut = referenceEnqueueImplMID;
+}
+
 /**
  * Worker thread consumes jobs from Finalize List Manager and process them
  */
@@ -443,9 +651,8 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 {
 	struct finalizeWorkerData *workerData = (struct finalizeWorkerData *)arg;
 	J9VMThread *env;
-	const GC_FinalizeJob *finalizeJob;
-	GC_FinalizeJob localJob;
-	jclass referenceClazz, j9VMInternalsClass = NULL;
+	struct finalizeJobBatch batch;
+	jclass j9VMInternalsClass = NULL;
 	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
 	J9InternalVMFunctions* fns;
 	omrthread_monitor_t monitor;
@@ -482,27 +689,8 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 	/* Remember that the thread was gpProtected -- important for the JIT */
 	env->gpProtected = 1;
 
-	if(vm->jclFlags & J9_JCL_FLAG_FINALIZATION) {
-		/* Only look up finalization methods if the class library supports them */
-		j9VMInternalsClass = ((JNIEnv *)env)->FindClass("java/lang/J9VMInternals");
-		if (j9VMInternalsClass) {
-			j9VMInternalsClass = (jclass)((JNIEnv *)env)->NewGlobalRef(j9VMInternalsClass);
-			if (j9VMInternalsClass) {
-				runFinalizeMID = ((JNIEnv *)env)->GetStaticMethodID(j9VMInternalsClass, "runFinalize", "(Ljava/lang/Object;)V");
-			}
-		}
-		if (!runFinalizeMID) {
-			((JNIEnv *)env)->ExceptionClear();
-		}
-	
-		referenceClazz = ((JNIEnv *)env)->FindClass("java/lang/ref/Reference");
-		if (referenceClazz) {
-			referenceEnqueueImplMID  = ((JNIEnv *)env)->GetMethodID(referenceClazz, "enqueueImpl", "()Z");
-		}
-		if (!referenceEnqueueImplMID) {
-			((JNIEnv *)env)->ExceptionClear();
-		}
-	}		
+	lookupFinalizeMethods(env, &j9VMInternalsClass, &runFinalizeMID, &referenceEnqueueImplMID);
+	initializeJobBatch(forge, &batch, extensions->finalizeBatchSize);
 	workerData->vmThread = env;
 
 	/* Notify that the worker has come on line (We should check the result from above) */
@@ -524,26 +712,27 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 		fns->internalEnterVMFromJNI(env);
 		
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		/* Free any class segments the collector left behind for us (holding VM access keeps the GC from walking them meanwhile) */
+		extensions->classLoaderManager->flushDeferredSegments(MM_EnvironmentBase::getEnvironment(env->omrVMThread));
+
 		if(workerData->mode != FINALIZE_WORKER_MODE_CL_UNLOAD)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 		{
-			if ((NULL != vm->processReferenceMonitor) && (0 != finalizeListManager->getReferenceCount())) {
-				omrthread_monitor_enter(vm->processReferenceMonitor);
-				vm->processReferenceActive = 1;
-				omrthread_monitor_exit(vm->processReferenceMonitor);
-			}
+			startReferenceProcessing(vm, finalizeListManager);
 		}
 
+		finalizeListManager->workerActivated();
 		do {
+			UDATA jobCount = 0;
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 			if(workerData->mode == FINALIZE_WORKER_MODE_CL_UNLOAD) {
 				
-				if (NULL == (localJob.classLoader = (J9ClassLoader *)finalizeForcedClassLoaderUnload((J9VMThread *)env))) {
+				if (NULL == (batch.jobs[0].classLoader = (J9ClassLoader *)finalizeForcedClassLoaderUnload((J9VMThread *)env))) {
 					break;
 				} else {
-					localJob.type = FINALIZE_JOB_TYPE_CLASSLOADER;
-					finalizeJob = &localJob;
+					batch.jobs[0].type = FINALIZE_JOB_TYPE_CLASSLOADER;
+					jobCount = 1;
 				}
 
 			} else {
@@ -552,17 +741,17 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 
 				finalizeListManager->lock();
 				
-				finalizeJob = finalizeListManager->consumeJob(env, &localJob);
-				if(finalizeJob == NULL) {
+				jobCount = finalizeListManager->consumeJobs(env, batch.jobs, batch.capacity, true);
+				if(0 == jobCount) {
 					if(workerData->mode == FINALIZE_WORKER_MODE_FORCED) {
 						finalizeForcedUnfinalizedToFinalizable(env);
-						finalizeJob = finalizeListManager->consumeJob(env, &localJob);
+						jobCount = finalizeListManager->consumeJobs(env, batch.jobs, batch.capacity, true);
 					}
 				}
 
 				finalizeListManager->unlock();
 				
-				if(NULL != finalizeJob) {
+				if(0 != jobCount) {
 					workerData->noWorkDone = 0;
 				} else {
 					workerData->noWorkDone = 1;
@@ -574,30 +763,14 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
 			/* processing will release/acquire VM access */
-			process(env, finalizeJob, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
-
-			if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
-				omrthread_monitor_enter(vm->processReferenceMonitor);
-				if (0 == finalizeListManager->getReferenceCount()) {
-					/* There is no more pending reference. */
-					vm->processReferenceActive = 0;
-				}
-				/*
-				 * Notify any waiters that progress has been made.
-				 * This improves latency for Reference.waitForReferenceProcessing() and try to
-				 * avoid the performance issue if there are many of pending references in the queue.
-				 */
-				omrthread_monitor_notify_all(vm->processReferenceMonitor);
-				omrthread_monitor_exit(vm->processReferenceMonitor);
-			}
-
-			fns->jniResetStackReferences((JNIEnv *)env);
+			processJobBatch(env, &batch, jobCount, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
 
 			if(FINALIZE_WORKER_SHOULD_ABANDON == workerData->die) {
 				/* We've been abandoned, finish up */
 				break;
 			}
 		} while (true);
+		finalizeListManager->workerDeactivated();
 
 		fns->internalReleaseVMAccess(env);
 
@@ -611,6 +784,7 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 	if (j9VMInternalsClass) {
 		((JNIEnv *)env)->DeleteGlobalRef(j9VMInternalsClass);
 	}
+	tearDownJobBatch(forge, &batch);
 
 	((JavaVM *)vm)->DetachCurrentThread();
 
@@ -771,6 +945,273 @@ IDATA FinalizeMainRunFinalization(J9JavaVM * vm, omrthread_t * indirectWorkerThr
 	return workerWaitResult;
 }
 
+/**
+ * Drop a reference to the assist data, freeing it once neither the main thread nor any assist thread uses it.
+ * @note Must be called while holding assistData->monitor, which is released.
+ */
+static void
+releaseAssistData(struct finalizeAssistData *assistData)
+{
+	assistData->references -= 1;
+	if (0 == assistData->references) {
+		MM_Forge *forge = MM_GCExtensions::getExtensions(assistData->vm)->getForge();
+		omrthread_monitor_exit(assistData->monitor);
+		omrthread_monitor_destroy(assistData->monitor);
+		forge->free(assistData);
+	} else {
+		omrthread_monitor_exit(assistData->monitor);
+	}
+}
+
+/**
+ * Assist worker consumes batches of finalizable objects and references while woken up by the main finalizer thread
+ */
+static int J9THREAD_PROC FinalizeAssistThread(void *arg)
+{
+	struct finalizeAssistData *assistData = (struct finalizeAssistData *)arg;
+	J9JavaVM *vm = assistData->vm;
+	J9InternalVMFunctions *fns = vm->internalVMFunctions;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	MM_Forge *forge = extensions->getForge();
+	GC_FinalizeListManager *finalizeListManager = extensions->finalizeListManager;
+	J9VMThread *env = NULL;
+	struct finalizeJobBatch batch;
+	jclass j9VMInternalsClass = NULL;
+	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
+
+	if (JNI_OK != fns->attachSystemDaemonThread(vm, &env, "Finalizer assist thread")) {
+		omrthread_monitor_enter(assistData->monitor);
+		assistData->threadCount -= 1;
+		omrthread_monitor_notify_all(assistData->monitor);
+		releaseAssistData(assistData);
+		return 0;
+	}
+
+	fns->internalEnterVMFromJNI(env);
+	env->privateFlags |= (J9_PRIVATE_FLAGS_FINALIZE_WORKER | J9_PRIVATE_FLAGS_USE_BOOTSTRAP_LOADER);
+	fns->internalReleaseVMAccess(env);
+
+	/* Remember that the thread was gpProtected -- important for the JIT */
+	env->gpProtected = 1;
+
+	lookupFinalizeMethods(env, &j9VMInternalsClass, &runFinalizeMID, &referenceEnqueueImplMID);
+	initializeJobBatch(forge, &batch, extensions->finalizeBatchSize);
+
+	omrthread_monitor_enter(assistData->monitor);
+	while (!assistData->die) {
+		if (0 == assistData->wakeTokens) {
+			omrthread_monitor_wait(assistData->monitor);
+			continue;
+		}
+		assistData->wakeTokens -= 1;
+		assistData->activeCount += 1;
+		UDATA epoch = assistData->epoch;
+		omrthread_monitor_exit(assistData->monitor);
+
+		fns->internalEnterVMFromJNI(env);
+		startReferenceProcessing(vm, finalizeListManager);
+		finalizeListManager->workerActivated();
+		while (!assistData->die) {
+			finalizeListManager->lock();
+			UDATA jobCount = finalizeListManager->consumeJobs(env, batch.jobs, batch.capacity, false);
+			finalizeListManager->unlock();
+			if (0 == jobCount) {
+				break;
+			}
+			/* processing will release/acquire VM access */
+			processJobBatch(env, &batch, jobCount, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
+		}
+		finalizeListManager->workerDeactivated();
+		fns->internalReleaseVMAccess(env);
+
+		omrthread_monitor_enter(assistData->monitor);
+		if (epoch == assistData->epoch) {
+			assistData->activeCount -= 1;
+		} else {
+			/* the main thread gave up waiting for this thread while it was stuck in a finalizer */
+			assistData->abandonedCount -= 1;
+		}
+		omrthread_monitor_notify_all(assistData->monitor);
+	}
+	omrthread_monitor_exit(assistData->monitor);
+
+	if (j9VMInternalsClass) {
+		((JNIEnv *)env)->DeleteGlobalRef(j9VMInternalsClass);
+	}
+	tearDownJobBatch(forge, &batch);
+
+	((JavaVM *)vm)->DetachCurrentThread();
+
+	omrthread_monitor_enter(assistData->monitor);
+	assistData->threadCount -= 1;
+	omrthread_monitor_notify_all(assistData->monitor);
+	releaseAssistData(assistData);
+
+	return 0;
+}
+
+/**
+ * Allocate the state shared with the assist workers. Threads are started on demand by FinalizeMainRequestAssist().
+ * @return the assist data, or NULL if it could not be allocated
+ */
+static struct finalizeAssistData *
+FinalizeMainCreateAssistData(J9JavaVM *vm)
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(vm)->getForge();
+	struct finalizeAssistData *assistData = (struct finalizeAssistData *)forge->allocate(sizeof(struct finalizeAssistData), MM_AllocationCategory::FINALIZE, J9_GET_CALLSITE());
+	if (NULL != assistData) {
+		assistData->vm = vm;
+		assistData->threadCount = 0;
+		assistData->activeCount = 0;
+		assistData->abandonedCount = 0;
+		assistData->epoch = 0;
+		assistData->wakeTokens = 0;
+		assistData->references = 1;
+		assistData->die = false;
+		if (0 != omrthread_monitor_init_with_name(&assistData->monitor, 0, "Finalizer assist")) {
+			forge->free(assistData);
+			assistData = NULL;
+		}
+	}
+	return assistData;
+}
+
+/**
+ * Start and wake up assist workers in proportion to the finalization backlog. One assist worker
+ * is requested per finalizeBacklogPerWorker pending jobs, up to finalizeMaxWorkerThreads - 1,
+ * not counting abandoned assist workers.
+ *
+ * Preconditions:
+ * 	holds finalizeMainMonitor
+ * Postconditions:
+ * 	holds finalizeMainMonitor
+ */
+static void
+FinalizeMainRequestAssist(J9JavaVM *vm, struct finalizeAssistData *assistData, UDATA jobCount)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	UDATA desired = OMR_MIN(extensions->finalizeMaxWorkerThreads - 1, jobCount / extensions->finalizeBacklogPerWorker);
+
+	if (0 == desired) {
+		return;
+	}
+
+	omrthread_monitor_enter(assistData->monitor);
+	if ((assistData->threadCount - assistData->abandonedCount) < desired) {
+		/* the assist threads may need VM access to attach, which the main finalizer lock must not block */
+		omrthread_monitor_exit(assistData->monitor);
+		omrthread_monitor_exit(vm->finalizeMainMonitor);
+		omrthread_monitor_enter(assistData->monitor);
+		while ((assistData->threadCount - assistData->abandonedCount) < desired) {
+			assistData->threadCount += 1;
+			assistData->references += 1;
+			IDATA result = vm->internalVMFunctions->createThreadWithCategory(
+								NULL,
+								vm->defaultOSStackSize,
+								extensions->finalizeWorkerPriority,
+								0,
+								&gpProtectedFinalizeAssistThread,
+								assistData,
+								J9THREAD_CATEGORY_APPLICATION_THREAD);
+			if (0 != result) {
+				assistData->threadCount -= 1;
+				assistData->references -= 1;
+				break;
+			}
+		}
+		omrthread_monitor_exit(assistData->monitor);
+		omrthread_monitor_enter(vm->finalizeMainMonitor);
+		omrthread_monitor_enter(assistData->monitor);
+	}
+
+	UDATA idleCount = assistData->threadCount - assistData->activeCount - assistData->abandonedCount - assistData->wakeTokens;
+	if (desired > (assistData->activeCount + assistData->wakeTokens)) {
+		assistData->wakeTokens += OMR_MIN(idleCount, desired - (assistData->activeCount + assistData->wakeTokens));
+		omrthread_monitor_notify_all(assistData->monitor);
+	}
+	omrthread_monitor_exit(assistData->monitor);
+}
+
+/**
+ * Wait until the assist workers have processed the jobs they popped, so that runFinalization
+ * does not return while finalizers it is responsible for are still running.
+ *
+ * Like the primary worker, assist workers are only waited for while they make progress: if none
+ * of them goes idle within finalizeCycleLimit, the active ones are abandoned (they are no longer
+ * waited for, and rejoin the idle pool once their finalizer returns).
+ *
+ * Preconditions:
+ * 	holds finalizeMainMonitor
+ * Postconditions:
+ * 	holds finalizeMainMonitor
+ */
+static void
+FinalizeMainWaitForAssistIdle(J9JavaVM *vm, struct finalizeAssistData *assistData, IDATA finalizeCycleLimit)
+{
+	omrthread_monitor_exit(vm->finalizeMainMonitor);
+	omrthread_monitor_enter(assistData->monitor);
+	/* assist workers notify the monitor each time one of them goes idle */
+	while ((0 != assistData->activeCount) || (0 != assistData->wakeTokens)) {
+		if (J9THREAD_TIMED_OUT == omrthread_monitor_wait_timed(assistData->monitor, finalizeCycleLimit, 0)) {
+			assistData->abandonedCount += assistData->activeCount;
+			assistData->activeCount = 0;
+			assistData->epoch += 1;
+			/* tokens nobody picked up within the cycle limit are not waited for either */
+			assistData->wakeTokens = 0;
+			break;
+		}
+	}
+	omrthread_monitor_exit(assistData->monitor);
+	omrthread_monitor_enter(vm->finalizeMainMonitor);
+}
+
+/**
+ * Ask the assist workers to exit and release the main thread's reference to the assist data.
+ * Workers still running a finalizer after a bounded wait free the data when they exit.
+ *
+ * Preconditions:
+ * 	holds finalizeMainMonitor
+ * Postconditions:
+ * 	holds finalizeMainMonitor
+ */
+static void
+FinalizeMainShutdownAssist(J9JavaVM *vm, struct finalizeAssistData *assistData)
+{
+	UDATA waits = 0;
+
+	omrthread_monitor_exit(vm->finalizeMainMonitor);
+	omrthread_monitor_enter(assistData->monitor);
+	assistData->die = true;
+	omrthread_monitor_notify_all(assistData->monitor);
+	while ((0 != assistData->threadCount) && (waits < 10)) {
+		omrthread_monitor_wait_timed(assistData->monitor, 100, 0);
+		waits += 1;
+	}
+	releaseAssistData(assistData);
+	omrthread_monitor_enter(vm->finalizeMainMonitor);
+}
+
+static UDATA
+FinalizeAssistThreadGlue(J9PortLibrary* portLib, void* userData)
+{
+	return FinalizeAssistThread(userData);
+}
+
+static int J9THREAD_PROC
+gpProtectedFinalizeAssistThread(void *entryArg)
+{
+	struct finalizeAssistData *assistData = (struct finalizeAssistData *) entryArg;
+	PORT_ACCESS_FROM_PORT(assistData->vm->portLibrary);
+	UDATA rc;
+
+	j9sig_protect(FinalizeAssistThreadGlue, assistData,
+		assistData->vm->internalVMFunctions->structuredSignalHandlerVM, assistData->vm,
+		J9PORT_SIG_FLAG_SIGALLSYNC | J9PORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+
+	return 0;
+}
+
 static UDATA
 FinalizeWorkerThreadGlue(J9PortLibrary* portLib, void* userData)
 {
@@ -74,6 +74,10 @@ class MM_ReferenceObjectList;
 class MM_IdleGCManager;
 #endif
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+class MM_OffHeapArrayTable;
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+
 #define DEFAULT_SURVIVOR_MINIMUM_FREESIZE 	2048
 #define DEFAULT_SURVIVOR_THRESHOLD 			512
 #define MAXIMUM_SURVIVOR_MINIMUM_FREESIZE 	524288
@@ -91,6 +95,9 @@ private:
 	MM_ContinuationObjectList* continuationObjectLists; /**< The global linked list of continuation object lists. */
 public:
 	MM_StringTable* stringTable; /**< top level String Table structure (internally organized as a set of hash sub-tables */
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	MM_OffHeapArrayTable* offHeapArrayTable; /**< table of off heap data blocks backing large primitive arrays, keyed by data address */
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 
 	void* gcchkExtensions;
 
@@ -99,7 +106,7 @@ public:
 
 #if defined(J9VM_GC_FINALIZATION)
 	intptr_t finalizeCycleInterval;
-	intptr_t finalizeCycleLimit;
+	intptr_t finalizeCycleLimit; /**< milliseconds a finalizer worker may run without finishing before it is abandoned (0 for no limit) */
 #endif /* J9VM_GC_FINALIZATION */
 
 	MM_HookInterface hookInterface;
@@ -111,6 +118,20 @@ public:
 	MM_ScavengerJavaStats scavengerJavaStats;
 #endif /* J9VM_GC_MODRON_SCAVENGER */
 
+#if defined(J9VM_GC_MODRON_SCAVENGER) || defined(J9VM_GC_VLHGC)
+	bool adaptiveHotFieldCopyDepth; /**< if true, the depth hot fields are copied to is chosen per class from the dominance of its hottest field (dynamicBreadthFirstScanOrdering only) */
+	uintptr_t hotFieldDepthFirstDominance; /**< percentage of the hotness of a class its hottest field must account for to depth copy up to depthCopyMax */
+	uintptr_t hotFieldBreadthFirstDominance; /**< percentage of the hotness of a class below which its objects are copied breadth first */
+#endif /* J9VM_GC_MODRON_SCAVENGER || J9VM_GC_VLHGC */
+
+#if defined(J9VM_GC_VLHGC)
+	uintptr_t tarokPGCPauseGoal; /**< target PGC pause time in milliseconds which eden and collection set sizing try to meet (0 to size eden for CPU overhead instead) */
+	bool tarokConcurrentGlobalSweep; /**< if true, the regions marked by a completed GMP are swept by the main GC thread while mutators run, leaving only the unswept remainder to the next PGC */
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	bool tarokConcurrentClassUnloadCleanup; /**< if true, dead class loaders and their RAM class segments are freed by the finalizer thread after the pause rather than inside it */
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+#endif /* J9VM_GC_VLHGC */
+
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	enum DynamicClassUnloading {
 		DYNAMIC_CLASS_UNLOADING_NEVER,
@@ -151,6 +172,9 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 	uintptr_t finalizeMainPriority; /**< cmd line option to set finalize main thread priority */
 	uintptr_t finalizeWorkerPriority; /**< cmd line option to set finalize worker thread priority */
+	uintptr_t finalizeMaxWorkerThreads; /**< maximum number of finalizer worker threads, including the primary worker (1 disables the assist workers) */
+	uintptr_t finalizeBacklogPerWorker; /**< number of pending finalizer jobs per active worker before another worker is woken */
+	uintptr_t finalizeBatchSize; /**< number of jobs a finalizer worker pops each time it acquires the finalize list lock (jobs still in the batch of an abandoned worker are not run until it returns) */
 #endif /* J9VM_GC_FINALIZATION */
 
 	MM_ClassLoaderManager* classLoaderManager; /**< Pointer to the gc's classloader manager to process classloaders/classes */
@@ -207,6 +231,12 @@ public:
 
 	intptr_t _asyncCallbackKey; /**< the key for async callback used in Concurrent Marking for threads to scan their own stacks */
 	intptr_t _TLHAsyncCallbackKey; /**< the key for async callback used to support instrumentable allocations */
+#if defined(J9VM_GC_THREAD_LOCAL_HEAP)
+	bool tlhSizeClassPolicy; /**< if true, TLH refresh sizes are raised to fit the size classes that most often miss the TLH */
+	bool allocationSizeSampling; /**< if true, out-of-line allocations are recorded in per-thread size histograms even without the TLH size class policy (-Xtgc:allocation) */
+	uintptr_t tlhSizeClassPolicyInterval; /**< number of out-of-line allocations sampled by a thread between evaluations of its TLH refresh size */
+	uintptr_t tlhSizeClassPolicyMissPercentage; /**< percentage of sampled allocations a size class must miss the TLH by for the refresh size to be raised */
+#endif /* J9VM_GC_THREAD_LOCAL_HEAP */
 
 	bool _HeapManagementMXBeanBackCompatibilityEnabled;
 
@@ -386,12 +416,27 @@ public:
 		, ownableSynchronizerObjectLists(NULL)
 		, continuationObjectLists(NULL)
 		, stringTable(NULL)
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+		, offHeapArrayTable(NULL)
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 		, gcchkExtensions(NULL)
 		, tgcExtensions(NULL)
 #if defined(J9VM_GC_FINALIZATION)
 		, finalizeCycleInterval(J9_FINALIZABLE_INTERVAL)  /* 1/2 second */
 		, finalizeCycleLimit(0)  /* 0 seconds (i.e. no time limit) */
 #endif /* J9VM_GC_FINALIZATION */
+#if defined(J9VM_GC_MODRON_SCAVENGER) || defined(J9VM_GC_VLHGC)
+		, adaptiveHotFieldCopyDepth(false)
+		, hotFieldDepthFirstDominance(60)
+		, hotFieldBreadthFirstDominance(25)
+#endif /* J9VM_GC_MODRON_SCAVENGER || J9VM_GC_VLHGC */
+#if defined(J9VM_GC_VLHGC)
+		, tarokPGCPauseGoal(0)
+		, tarokConcurrentGlobalSweep(false)
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		, tarokConcurrentClassUnloadCleanup(false)
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+#endif /* J9VM_GC_VLHGC */
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 		, dynamicClassUnloadingSet(false)
 		, dynamicClassUnloadingKickoffThresholdForced(false)
@@ -405,6 +450,9 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 		, finalizeMainPriority(J9THREAD_PRIORITY_NORMAL)
 		, finalizeWorkerPriority(J9THREAD_PRIORITY_NORMAL)
+		, finalizeMaxWorkerThreads(1)
+		, finalizeBacklogPerWorker(1024)
+		, finalizeBatchSize(1)
 #endif /* J9VM_GC_FINALIZATION */
 		, classLoaderManager(NULL)
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
@@ -418,6 +466,12 @@ public:
 		, stringDedupPolicy(J9_JIT_STRING_DEDUP_POLICY_UNDEFINED)
 		, _asyncCallbackKey(-1)
 		, _TLHAsyncCallbackKey(-1)
+#if defined(J9VM_GC_THREAD_LOCAL_HEAP)
+		, tlhSizeClassPolicy(false)
+		, allocationSizeSampling(false)
+		, tlhSizeClassPolicyInterval(256)
+		, tlhSizeClassPolicyMissPercentage(10)
+#endif /* J9VM_GC_THREAD_LOCAL_HEAP */
 		, _HeapManagementMXBeanBackCompatibilityEnabled(false)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, idleGCManager(NULL)
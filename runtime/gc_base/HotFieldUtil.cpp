@@ -76,18 +76,24 @@ MM_HotFieldUtil::sortClassHotFieldList(J9JavaVM *javaVM, J9ClassHotFieldsInfo* h
 	uint8_t initialHotFieldOffset2 = hotFieldClassInfo->hotFieldOffset2;
 	uint8_t initialHotFieldOffset3 = hotFieldClassInfo->hotFieldOffset3;
 
+	/* share of the total hotness of the class held by its hottest field, in percent */
+	uint64_t hottestFieldDominance = 0;
+
 	/* compute and update the hot fields for each class */
 	if (1 == hotFieldClassInfo->hotFieldListLength) {
 		hotFieldClassInfo->hotFieldOffset1 = hotFieldClassInfo->hotFieldListHead->hotFieldOffset;
+		hottestFieldDominance = 100;
 	} else {
 		J9HotField* currentHotField = hotFieldClassInfo->hotFieldListHead;
 		uint64_t hottest = 0;
 		uint64_t secondHottest = 0;
 		uint64_t thirdHottest = 0;
 		uint64_t current = 0;
+		uint64_t totalHotness = 0;
 		while (NULL != currentHotField) {
 			if(currentHotField->cpuUtil > extensions->minCpuUtil) {
 				current = currentHotField->hotness;
+				totalHotness += current;
 				/* compute the three hottest fields if depthCopyThreePaths is enabled, or the two hottest fields if only depthCopyTwoPaths is enabled, otherwise, compute just the hottest field if both depthCopyTwoPaths and depthCopyThreePaths are disabled */
 				if (extensions->depthCopyThreePaths) {
 					if (current > hottest) {
@@ -126,6 +132,12 @@ MM_HotFieldUtil::sortClassHotFieldList(J9JavaVM *javaVM, J9ClassHotFieldsInfo* h
 		if (thirdHottest < MINIMUM_THIRD_HOT_FIELD_HOTNESS) { 
 			hotFieldClassInfo->hotFieldOffset3 = U_8_MAX;
 		}
+		if (0 != totalHotness) {
+			hottestFieldDominance = (hottest * 100) / totalHotness;
+		}
+	}
+	if (extensions->adaptiveHotFieldCopyDepth) {
+		hotFieldClassInfo->hotFieldCopyDepth = computeHotFieldCopyDepth(javaVM, hottestFieldDominance);
 	}
 	/* if permanantHotFields are allowed, update consecutiveHotFieldSelections counter if hot field offsets are the same as the previous time the class hot field list was sorted  */
 	if (extensions->allowPermanantHotFields) {
@@ -141,6 +153,32 @@ MM_HotFieldUtil::sortClassHotFieldList(J9JavaVM *javaVM, J9ClassHotFieldsInfo* h
 	hotFieldClassInfo->isClassHotFieldListDirty = false;
 }
 
+MMINLINE uint8_t
+MM_HotFieldUtil::computeHotFieldCopyDepth(J9JavaVM *javaVM, uint64_t hottestFieldDominance)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM);
+	uintptr_t depthFirstDominance = extensions->hotFieldDepthFirstDominance;
+	uintptr_t breadthFirstDominance = extensions->hotFieldBreadthFirstDominance;
+	uintptr_t copyDepth = 0;
+
+	if (0 == hottestFieldDominance) {
+		/* no usable profiling data, fall back to the global depth copy limit */
+		copyDepth = U_8_MAX;
+	} else if (hottestFieldDominance >= depthFirstDominance) {
+		/* accesses follow a single chain through objects of this class, copy it depth first as far as allowed */
+		copyDepth = extensions->depthCopyMax;
+	} else if (hottestFieldDominance < breadthFirstDominance) {
+		/* accesses are spread over many fields, depth copying would only split up siblings */
+		copyDepth = 0;
+	} else if (0 != extensions->depthCopyMax) {
+		/* scale the copy depth between one level and depthCopyMax with the dominance of the hottest field */
+		copyDepth = 1 + (((extensions->depthCopyMax - 1) * (uintptr_t)(hottestFieldDominance - breadthFirstDominance)) / (depthFirstDominance - breadthFirstDominance));
+	}
+	/* otherwise depth copying is disabled (-XXgc:dbfDepthCopyMax=0) and objects of this class are copied breadth first */
+
+	return (uint8_t)copyDepth;
+}
+
 /**
  * Reset all hot fields for all classes.
  * Used when dynamicBreadthFirstScanOrdering is enabled and hotFieldResettingEnabled is true.
@@ -62,6 +62,16 @@ public:
 	 */
 	MMINLINE static void sortClassHotFieldList(J9JavaVM *javaVM, J9ClassHotFieldsInfo* hotFieldClassInfo);
 
+	/**
+	 * Compute how many levels of hot fields to depth copy through objects of a class.
+	 * Used when adaptiveHotFieldCopyDepth is enabled.
+	 *
+	 * @param javaVM[in] pointer to the J9JavaVM
+	 * @param hottestFieldDominance[in] percentage of the hotness of the class accounted for by its hottest field
+	 * @return the copy depth, 0 to copy objects of the class breadth first, or U_8_MAX to use depthCopyMax
+	 */
+	MMINLINE static uint8_t computeHotFieldCopyDepth(J9JavaVM *javaVM, uint64_t hottestFieldDominance);
+
 	/**
 	 * Reset all hot fields for all classes.
 	 * Used when scavenger dynamicBreadthFirstScanOrdering is enabled and hotFieldResettingEnabled is true.
@@ -33,6 +33,8 @@
 #include "OMRVMInterface.hpp"
 #include "Heap.hpp"
 #include "VMAccess.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterChain.hpp"
 
 MM_IdleGCManager *
 MM_IdleGCManager::newInstance(MM_EnvironmentBase* env)
@@ -80,10 +82,31 @@ MM_IdleGCManager::manageFreeHeap(J9VMThread* currentThread)
 	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(currentThread->omrVMThread);
 	MM_GCExtensions* _extensions = MM_GCExtensions::getExtensions(env);
 
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t residentBefore = 0;
+	uint64_t residentAfter = 0;
+	/* report how much the process resident set shrank across the idle collection; this is an observation of the whole process, not an accounting of pages the collector released */
+	bool residentKnown = (0 == omrvmem_get_process_memory_size(OMRPORT_VMEM_PROCESS_PHYSICAL, &residentBefore));
+
 	_javaVM->internalVMFunctions->internalAcquireVMAccess(currentThread);
 	VM_VMAccess::setPublicFlags(currentThread, J9_PUBLIC_FLAGS_NOT_AT_SAFE_POINT);
 	_extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_EXPLICIT_GC_IDLE_GC);
 	VM_VMAccess::clearPublicFlags(currentThread, J9_PUBLIC_FLAGS_NOT_AT_SAFE_POINT);
+
+	residentKnown = residentKnown && (0 == omrvmem_get_process_memory_size(OMRPORT_VMEM_PROCESS_PHYSICAL, &residentAfter));
+	_idleCycleCount += 1;
+	_lastRSSReduction = 0;
+	if (residentKnown && (residentBefore > residentAfter)) {
+		_lastRSSReduction = residentBefore - residentAfter;
+		_totalRSSReduction += _lastRSSReduction;
+	}
+
+	/* still holding VM access, so no collection can interleave its verbose output with ours */
+	if (_extensions->verboseNewFormat && (NULL != _extensions->verboseGCManager)) {
+		MM_VerboseManager *verboseManager = (MM_VerboseManager *)_extensions->verboseGCManager;
+		verboseManager->getWriterChain()->formatAndOutput(env, 0, "<idle-rss cycle=\"%zu\" rssbefore=\"%llu\" rssafter=\"%llu\" reduction=\"%llu\" totalreduction=\"%llu\" />",
+			_idleCycleCount, residentBefore, residentAfter, _lastRSSReduction, _totalRSSReduction);
+	}
 	_javaVM->internalVMFunctions->internalReleaseVMAccess(currentThread);
 }
 
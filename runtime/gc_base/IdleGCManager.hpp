@@ -52,6 +52,9 @@ private:
 	 * reference to the language runtime
 	 */
 	J9JavaVM* _javaVM;
+	uintptr_t _idleCycleCount; /**< number of idle cycles serviced by manageFreeHeap() */
+	uint64_t _lastRSSReduction; /**< drop in process resident set size across the most recent idle cycle (0 if it grew) */
+	uint64_t _totalRSSReduction; /**< sum of the resident set size drops across all idle cycles */
 
 protected:
 public:
@@ -80,12 +83,30 @@ public:
 	  */
 	void manageFreeHeap(J9VMThread* currentThread);
 
+	/**
+	 * @return the number of idle cycles serviced so far
+	 */
+	MMINLINE uintptr_t getIdleCycleCount() { return _idleCycleCount; }
+
+	/**
+	 * @return bytes the process resident set size dropped by across the most recent idle cycle
+	 */
+	MMINLINE uint64_t getLastRSSReduction() { return _lastRSSReduction; }
+
+	/**
+	 * @return bytes the process resident set size dropped by across all idle cycles
+	 */
+	MMINLINE uint64_t getTotalRSSReduction() { return _totalRSSReduction; }
+
 	/**
 	 * construct the object
 	 */
 	MM_IdleGCManager(MM_EnvironmentBase* env)
 		: MM_BaseNonVirtual()
 		, _javaVM((J9JavaVM*)env->getOmrVM()->_language_vm)
+		, _idleCycleCount(0)
+		, _lastRSSReduction(0)
+		, _totalRSSReduction(0)
 	{
 		_typeId = __FUNCTION__;
 	}
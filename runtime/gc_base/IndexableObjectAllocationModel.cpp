@@ -25,6 +25,12 @@
 #include "IndexableObjectAllocationModel.hpp"
 #include "Math.hpp"
 #include "MemorySpace.hpp"
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "MemorySubSpaceTarok.hpp"
+#include "OffHeapArrayTable.hpp"
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 #include "ArrayletLeafIterator.hpp"
 #include "HeapRegionManager.hpp"
@@ -74,8 +80,19 @@ MM_IndexableObjectAllocationModel::initializeAllocateDescription(MM_EnvironmentB
 	case GC_ArrayletObjectModel::Discontiguous:
 		/* non-empty discontiguous arrays require slow-path allocate */
 		if (isGCAllowed() || (0 == _numberOfIndexedFields)) {
-			/* _numberOfArraylets discontiguous leaves, all contains leaf size bytes */
-			layoutSizeInBytes = _dataSize;
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+			if (_isOffHeapArray) {
+				/* only the spine is allocated in the heap, the data is reserved off heap up front */
+				if (!reserveOffHeapData(env)) {
+					break;
+				}
+				layoutSizeInBytes = 0;
+			} else
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+			{
+				/* _numberOfArraylets discontiguous leaves, all contains leaf size bytes */
+				layoutSizeInBytes = _dataSize;
+			}
 			_allocateDescription.setChunkedArray(true);
 			Trc_MM_allocateAndConnectNonContiguousArraylet_Entry(env->getLanguageVMThread(),
 					_numberOfIndexedFields, spineBytes, _numberOfArraylets);
@@ -164,7 +181,14 @@ MM_IndexableObjectAllocationModel::initializeIndexableObject(MM_EnvironmentBase
 			}
 			Trc_MM_allocateAndConnectNonContiguousArraylet_Summary(env->getLanguageVMThread(),
 					_numberOfIndexedFields, getAllocateDescription()->getContiguousBytes(), _numberOfArraylets);
-			spine = layoutDiscontiguousArraylet(env, spine);
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+			if (_isOffHeapArray) {
+				spine = layoutOffHeapArraylet(env, spine);
+			} else
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+			{
+				spine = layoutDiscontiguousArraylet(env, spine);
+			}
 			Trc_MM_allocateAndConnectNonContiguousArraylet_Exit(env->getLanguageVMThread(), spine);
 		} else {
 			Trc_MM_allocateAndConnectNonContiguousArraylet_spineFailure(env->getLanguageVMThread());
@@ -321,6 +345,88 @@ MM_IndexableObjectAllocationModel::layoutDiscontiguousArraylet(MM_EnvironmentBas
 	return spine;
 }
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+bool
+MM_IndexableObjectAllocationModel::reserveOffHeapData(MM_EnvironmentBase *env)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	MM_OffHeapArrayTable *offHeapArrayTable = extensions->offHeapArrayTable;
+
+	void *dataAddr = offHeapArrayTable->reserveData(env, _dataSize, &_offHeapReservation);
+	if (NULL == dataAddr) {
+		/* dead off heap arrays may still hold the memory; collect and retry, as a failed heap allocation would */
+		extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_IMPLICIT_GC_DEFAULT);
+		dataAddr = offHeapArrayTable->reserveData(env, _dataSize, &_offHeapReservation);
+		if (NULL == dataAddr) {
+			extensions->heap->systemGarbageCollect(env, J9MMCONSTANT_IMPLICIT_GC_AGGRESSIVE);
+			dataAddr = offHeapArrayTable->reserveData(env, _dataSize, &_offHeapReservation);
+		}
+	}
+
+	if (NULL != dataAddr) {
+		/* pay allocation tax for the off heap bytes, so that the next region replenish reaches the taxation point */
+		MM_MemorySubSpaceTarok *subspace = (MM_MemorySubSpaceTarok *)_allocateDescription.getMemorySpace()->getDefaultMemorySubSpace();
+		subspace->consumeFromTaxationThreshold(env, _offHeapReservation.size);
+	}
+
+	return NULL != dataAddr;
+}
+
+void
+MM_IndexableObjectAllocationModel::releaseUnusedOffHeapData(MM_EnvironmentBase *env)
+{
+	if (_isOffHeapArray && (NULL != _offHeapReservation.dataAddr)) {
+		MM_GCExtensions::getExtensions(env)->offHeapArrayTable->releaseReservedData(env, &_offHeapReservation);
+	}
+}
+
+/**
+ * For off heap arrays the spine has already been allocated in the heap (without leaves) and the data
+ * has been reserved outside the heap. Point the arrayoid at consecutive leaf sized chunks of the data,
+ * so that element access through the arrayoid is unchanged, while dataAddr exposes the whole block
+ * contiguously (e.g. for JNI critical access), and hand the data over to the spine.
+ *
+ * If the data cannot be registered with the spine it is released and the spine, which has not been
+ * published yet, is turned into a hole, so that no heap walker ever sees an off heap array without
+ * its data. NULL is returned in that case.
+ *
+ * @return initialized arraylet spine with its arraylet pointers initialized, or NULL
+ */
+MMINLINE J9IndexableObject *
+MM_IndexableObjectAllocationModel::layoutOffHeapArraylet(MM_EnvironmentBase *env, J9IndexableObject *spine)
+{
+	Assert_MM_true(_numberOfArraylets == _allocateDescription.getNumArraylets());
+	Assert_MM_true(NULL != _offHeapReservation.dataAddr);
+
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	GC_ArrayObjectModel *indexableObjectModel = &extensions->indexableObjectModel;
+	bool const compressed = env->compressObjectReferences();
+	const uintptr_t arrayletLeafSize = env->getOmrVM()->_arrayletLeafSize;
+
+	if (!extensions->offHeapArrayTable->registerData(env, &_offHeapReservation, (J9Object *)spine)) {
+		extensions->offHeapArrayTable->releaseReservedData(env, &_offHeapReservation);
+		MM_HeapLinkedFreeHeader::fillWithHoles(spine, _allocateDescription.getContiguousBytes(), compressed);
+		Trc_MM_allocateAndConnectNonContiguousArraylet_leafFailure(env->getLanguageVMThread());
+		_allocateDescription.setSpine(NULL);
+		return NULL;
+	}
+
+	uintptr_t dataAddr = (uintptr_t)_offHeapReservation.dataAddr;
+	/* the spine owns the data from now on */
+	_offHeapReservation.dataAddr = NULL;
+
+	fj9object_t *arrayoidPtr = indexableObjectModel->getArrayoidPointer(spine);
+	for (uintptr_t i = 0; i < _numberOfArraylets; i++) {
+		GC_SlotObject slotObject(env->getOmrVM(), GC_SlotObject::addToSlotAddress(arrayoidPtr, i, compressed));
+		slotObject.writeReferenceToSlot((omrobjectptr_t)(dataAddr + (i * arrayletLeafSize)));
+	}
+	indexableObjectModel->setDataAddrForDiscontiguous(spine, (void *)dataAddr);
+	indexableObjectModel->AssertArrayletIsDiscontiguous(spine);
+
+	return spine;
+}
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 #if !((defined(LINUX) || defined(OSX)) && defined(J9VM_ENV_DATA64))
 /* Double map is only supported on LINUX 64 bit Systems for now */
@@ -33,6 +33,9 @@
 #include "ArrayletObjectModel.hpp"
 #include "JavaObjectAllocationModel.hpp"
 #include "MemorySpace.hpp"
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+#include "OffHeapArrayTable.hpp"
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 
 /**
  * Class definition for the array object allocation model.
@@ -48,6 +51,10 @@ private:
 	const GC_ArrayletObjectModel::ArrayLayout _layout;
 	const bool _alignSpineDataSection;
 	const uintptr_t _numberOfArraylets;
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	const bool _isOffHeapArray; /**< true if the array data is to be allocated off heap, with only the spine in the heap */
+	MM_OffHeapArrayEntry _offHeapReservation; /**< off heap data reserved ahead of the spine, until it is registered with the spine */
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 
 protected:
 
@@ -71,6 +78,23 @@ private:
 	 */
 	MMINLINE J9IndexableObject *layoutDiscontiguousArraylet(MM_EnvironmentBase *env, J9IndexableObject *spine);
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	/**
+	 * For off heap arrays only the spine is allocated in the heap. The data is allocated as one
+	 * contiguous off heap block and the arrayoid pointers address consecutive leaf sized chunks of it.
+	 * @return initialized arraylet spine with its arraylet pointers initialized, or NULL
+	 */
+	MMINLINE J9IndexableObject *layoutOffHeapArraylet(MM_EnvironmentBase *env, J9IndexableObject *spine);
+
+	/**
+	 * Reserve the off heap data of the array before its spine is allocated, collecting and retrying
+	 * if the reservation fails. The reserved bytes are charged against the allocation taxation
+	 * threshold, so that off heap allocation paces and triggers collections like eden allocation.
+	 * @return true if the data was reserved
+	 */
+	bool reserveOffHeapData(MM_EnvironmentBase *env);
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+
 protected:
 
 public:
@@ -87,6 +111,13 @@ public:
 				_allocateDescription.getMemorySpace()->getDefaultMemorySubSpace()->largestDesirableArraySpine()))
 		, _alignSpineDataSection(env->getExtensions()->indexableObjectModel.shouldAlignSpineDataSection(_class))
 		, _numberOfArraylets(env->getExtensions()->indexableObjectModel.numArraylets(_dataSize))
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+		, _isOffHeapArray(env->getExtensions()->indexableObjectModel.isVirtualLargeObjectHeapEnabled()
+				&& (GC_ArrayletObjectModel::Discontiguous == _layout)
+				&& (0 != _numberOfIndexedFields)
+				&& (OBJECT_HEADER_SHAPE_POINTERS != J9GC_CLASS_SHAPE(_class)))
+		, _offHeapReservation()
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 	{
 		/* check for overflow of _dataSize in indexableObjectModel.getDataSizeInBytes() */
 		if (J9_MAXIMUM_INDEXABLE_DATA_SIZE < _dataSize) {
@@ -147,6 +178,15 @@ public:
 	 * Initializer.
 	 */
 	omrobjectptr_t initializeIndexableObject(MM_EnvironmentBase *env, void *allocatedBytes);
+
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	/**
+	 * Release off heap data reserved by initializeAllocateDescription() which was not handed
+	 * over to a spine, because the spine could not be allocated. Must be called once the
+	 * allocation has completed, whether or not it succeeded.
+	 */
+	void releaseUnusedOffHeapData(MM_EnvironmentBase *env);
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 };
 
 #endif /* INDEXABLEOBJECTALLOCATIONMODEL_HPP_ */
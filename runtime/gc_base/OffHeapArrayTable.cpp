@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "hashtable_api.h"
+
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+#include "Math.hpp"
+#include "OffHeapArrayTable.hpp"
+
+extern "C" {
+
+static UDATA
+offHeapArrayHashFn(void *key, void *userData)
+{
+	MM_OffHeapArrayEntry *entry = (MM_OffHeapArrayEntry *)key;
+	/* data is page aligned so the low bits carry no information */
+	return ((UDATA)entry->dataAddr) >> 12;
+}
+
+static UDATA
+offHeapArrayHashEqualFn(void *leftKey, void *rightKey, void *userData)
+{
+	return ((MM_OffHeapArrayEntry *)leftKey)->dataAddr == ((MM_OffHeapArrayEntry *)rightKey)->dataAddr;
+}
+
+} /* extern "C" */
+
+MM_OffHeapArrayTable *
+MM_OffHeapArrayTable::newInstance(MM_EnvironmentBase *env)
+{
+	MM_OffHeapArrayTable *offHeapArrayTable = (MM_OffHeapArrayTable *)env->getForge()->allocate(sizeof(MM_OffHeapArrayTable), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != offHeapArrayTable) {
+		new(offHeapArrayTable) MM_OffHeapArrayTable(env);
+		if (!offHeapArrayTable->initialize(env)) {
+			offHeapArrayTable->kill(env);
+			offHeapArrayTable = NULL;
+		}
+	}
+	return offHeapArrayTable;
+}
+
+bool
+MM_OffHeapArrayTable::initialize(MM_EnvironmentBase *env)
+{
+	J9JavaVM *javaVM = (J9JavaVM *)env->getOmrVM()->_language_vm;
+	PORT_ACCESS_FROM_JAVAVM(javaVM);
+
+	_pageSize = j9vmem_supported_page_sizes()[0];
+	if (0 == _pageSize) {
+		return false;
+	}
+
+	_table = hashTableNew(OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), 64, sizeof(MM_OffHeapArrayEntry), sizeof(void *), 0, OMRMEM_CATEGORY_MM, offHeapArrayHashFn, offHeapArrayHashEqualFn, NULL, NULL);
+	if (NULL == _table) {
+		return false;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_mutex, 0, "GC off heap array table")) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_OffHeapArrayTable::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _table) {
+		J9HashTableState walkState;
+		MM_OffHeapArrayEntry *entry = (MM_OffHeapArrayEntry *)hashTableStartDo(_table, &walkState);
+		while (NULL != entry) {
+			freeData(env, entry);
+			entry = (MM_OffHeapArrayEntry *)hashTableNextDo(&walkState);
+		}
+		hashTableFree(_table);
+		_table = NULL;
+	}
+
+	if (NULL != _mutex) {
+		omrthread_monitor_destroy(_mutex);
+		_mutex = NULL;
+	}
+}
+
+void
+MM_OffHeapArrayTable::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+void *
+MM_OffHeapArrayTable::reserveData(MM_EnvironmentBase *env, uintptr_t dataSizeInBytes, MM_OffHeapArrayEntry *entry)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	J9PortVmemParams params;
+
+	j9vmem_vmem_params_init(&params);
+	params.startAddress = (void *)_pageSize;
+	if (env->compressObjectReferences()) {
+		/* arrayoid leaf pointers are stored compressed, so the data must be addressable as a heap reference */
+		params.endAddress = (void *)MM_GCExtensions::getExtensions(env)->heapCeiling;
+		params.options = J9PORT_VMEM_ALLOC_QUICK;
+	}
+	params.byteAmount = MM_Math::roundToCeiling(_pageSize, dataSizeInBytes);
+	params.pageSize = _pageSize;
+	params.mode = J9PORT_VMEM_MEMORY_MODE_READ | J9PORT_VMEM_MEMORY_MODE_WRITE | J9PORT_VMEM_MEMORY_MODE_COMMIT;
+	params.category = OMRMEM_CATEGORY_MM_RUNTIME_HEAP;
+
+	/* freshly committed pages are zero filled, which satisfies array initialization */
+	void *dataAddr = j9vmem_reserve_memory_ex(&entry->identifier, &params);
+	entry->dataAddr = dataAddr;
+	entry->proxyObject = NULL;
+	entry->size = (NULL != dataAddr) ? params.byteAmount : 0;
+
+	return dataAddr;
+}
+
+bool
+MM_OffHeapArrayTable::registerData(MM_EnvironmentBase *env, MM_OffHeapArrayEntry *entry, J9Object *proxyObject)
+{
+	entry->proxyObject = proxyObject;
+
+	omrthread_monitor_enter(_mutex);
+	void *added = hashTableAdd(_table, entry);
+	omrthread_monitor_exit(_mutex);
+
+	if (NULL != added) {
+		MM_AtomicOperations::add(&_bytesInUse, entry->size);
+		MM_AtomicOperations::add(&_arrayCount, 1);
+	}
+
+	return NULL != added;
+}
+
+void
+MM_OffHeapArrayTable::releaseReservedData(MM_EnvironmentBase *env, MM_OffHeapArrayEntry *entry)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	j9vmem_free_memory(entry->dataAddr, entry->size, &entry->identifier);
+	entry->dataAddr = NULL;
+	entry->size = 0;
+}
+
+void
+MM_OffHeapArrayTable::freeData(MM_EnvironmentBase *env, MM_OffHeapArrayEntry *entry)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	j9vmem_free_memory(entry->dataAddr, entry->size, &entry->identifier);
+	MM_AtomicOperations::subtract(&_bytesInUse, entry->size);
+	MM_AtomicOperations::subtract(&_arrayCount, 1);
+}
+
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
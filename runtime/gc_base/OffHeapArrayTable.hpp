@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(OFFHEAPARRAYTABLE_HPP_)
+#define OFFHEAPARRAYTABLE_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Describes one block of off heap memory backing the data of a large primitive array.
+ * The in-heap spine of the array (proxyObject) owns the block; the block is released
+ * once the collector finds the spine dead.
+ */
+typedef struct MM_OffHeapArrayEntry {
+	void *dataAddr; /**< start of the off heap data (hash key) */
+	J9Object *proxyObject; /**< in-heap spine of the array owning this data */
+	uintptr_t size; /**< reserved size in bytes (rounded up to page size) */
+	J9PortVmemIdentifier identifier; /**< port library identifier used to release the memory */
+} MM_OffHeapArrayEntry;
+
+/**
+ * Tracks off heap data blocks of large primitive arrays in the balanced collector.
+ * Blocks are added by mutator threads at allocation time and released by the collector
+ * while clearing roots (see MM_RootScanner::scanOffHeapArrays).
+ * @ingroup GC_Base
+ */
+class MM_OffHeapArrayTable : public MM_BaseNonVirtual {
+private:
+	J9HashTable *_table; /**< hash table of MM_OffHeapArrayEntry keyed by data address */
+	omrthread_monitor_t _mutex; /**< protects _table against concurrent allocations */
+	uintptr_t _pageSize; /**< page size used to reserve off heap data */
+	volatile uintptr_t _bytesInUse; /**< total off heap bytes currently reserved */
+	volatile uintptr_t _arrayCount; /**< number of arrays currently backed by off heap data */
+
+private:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_OffHeapArrayTable *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Reserve and commit zeroed off heap memory for the data of an array. The memory is not
+	 * tracked until it is registered with the spine that owns it (see registerData()).
+	 * @param env[in] the current thread
+	 * @param dataSizeInBytes[in] size of the array data in bytes
+	 * @param entry[out] describes the reserved memory
+	 * @return address of the data or NULL if the memory could not be reserved
+	 */
+	void *reserveData(MM_EnvironmentBase *env, uintptr_t dataSizeInBytes, MM_OffHeapArrayEntry *entry);
+
+	/**
+	 * Start tracking reserved off heap memory as the data of the given spine.
+	 * @param env[in] the current thread
+	 * @param entry[in] memory returned by reserveData()
+	 * @param proxyObject[in] the in-heap spine which owns the data
+	 * @return true on success, false if the table could not grow (the memory is still reserved)
+	 */
+	bool registerData(MM_EnvironmentBase *env, MM_OffHeapArrayEntry *entry, J9Object *proxyObject);
+
+	/**
+	 * Release off heap memory returned by reserveData() which was never registered.
+	 * @param env[in] the current thread
+	 * @param entry[in] the reserved memory
+	 */
+	void releaseReservedData(MM_EnvironmentBase *env, MM_OffHeapArrayEntry *entry);
+
+	/**
+	 * Release the off heap memory described by entry. The caller is responsible for removing
+	 * the entry from the table (typically through GC_HashTableIterator::removeSlot()).
+	 * @param env[in] the current thread
+	 * @param entry[in] the entry to release
+	 */
+	void freeData(MM_EnvironmentBase *env, MM_OffHeapArrayEntry *entry);
+
+	/**
+	 * @return the underlying hash table (only safe to walk while mutators are stopped)
+	 */
+	MMINLINE J9HashTable *getTable() { return _table; }
+
+	/**
+	 * @return total off heap bytes currently reserved for array data
+	 */
+	MMINLINE uintptr_t getBytesInUse() { return _bytesInUse; }
+
+	/**
+	 * @return number of arrays currently backed by off heap data
+	 */
+	MMINLINE uintptr_t getArrayCount() { return _arrayCount; }
+
+	MM_OffHeapArrayTable(MM_EnvironmentBase *env)
+		: MM_BaseNonVirtual()
+		, _table(NULL)
+		, _mutex(NULL)
+		, _pageSize(0)
+		, _bytesInUse(0)
+		, _arrayCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+
+#endif /* OFFHEAPARRAYTABLE_HPP_ */
@@ -56,6 +56,9 @@
 #include "ObjectAccessBarrier.hpp"
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ObjectModel.hpp"
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+#include "OffHeapArrayTable.hpp"
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 #include "OwnableSynchronizerObjectList.hpp"
 #include "ContinuationObjectList.hpp"
 #include "VMHelpers.hpp"
@@ -250,6 +253,14 @@ MM_RootScanner::doDoubleMappedObjectSlot(J9Object *objectPtr, struct J9PortVmemI
 }
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+void
+MM_RootScanner::doOffHeapArraySlot(MM_OffHeapArrayEntry *entry, GC_HashTableIterator *offHeapArrayIterator)
+{
+	/* No need to call doSlot() here since the spine is not a root */
+}
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+
 /**
  * @Perform operation on the given string cache table slot.
  * @String table cache contains cached entries of string table, it's
@@ -622,7 +633,10 @@ MM_RootScanner::scanJNIGlobalReferences(MM_EnvironmentBase *env)
 		J9Object **slot;
 
 		while((slot = (J9Object **)jniGlobalReferenceIterator.nextSlot()) != NULL) {
-			doJNIGlobalReferenceSlot(slot, &jniGlobalReferenceIterator);
+			/* Slots cached by threads or deleted but not yet returned to the pool are NULL */
+			if (NULL != *slot) {
+				doJNIGlobalReferenceSlot(slot, &jniGlobalReferenceIterator);
+			}
 		}
 
 		reportScanningEnded(RootScannerEntity_JNIGlobalReferences);
@@ -935,6 +949,23 @@ MM_RootScanner::scanDoubleMappedObjects(MM_EnvironmentBase *env)
 }
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+void
+MM_RootScanner::scanOffHeapArrays(MM_EnvironmentBase *env)
+{
+	if (_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+		/* off heap arrays and double mapped arraylets are mutually exclusive, so they share a scanning entity */
+		reportScanningStarted(RootScannerEntity_DoubleMappedObjects);
+		GC_HashTableIterator offHeapArrayIterator(_extensions->offHeapArrayTable->getTable());
+		MM_OffHeapArrayEntry *entry = NULL;
+		while (NULL != (entry = (MM_OffHeapArrayEntry *)offHeapArrayIterator.nextSlot())) {
+			doOffHeapArraySlot(entry, &offHeapArrayIterator);
+		}
+		reportScanningEnded(RootScannerEntity_DoubleMappedObjects);
+	}
+}
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+
 /**
  * Scan all root set references from the VM into the heap.
  * For all slots that are hard root references into the heap, the appropriate slot handler will be called.
@@ -1073,6 +1104,12 @@ MM_RootScanner::scanClearable(MM_EnvironmentBase *env)
 		scanDoubleMappedObjects(env);
 	}
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	if (_includeOffHeapArrays) {
+		scanOffHeapArrays(env);
+	}
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 }
 
 /**
@@ -1128,6 +1165,12 @@ MM_RootScanner::scanAllSlots(MM_EnvironmentBase *env)
         }
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	if (_includeOffHeapArrays) {
+		scanOffHeapArrays(env);
+	}
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+
 	scanOwnableSynchronizerObjects(env);
 	scanContinuationObjects(env);
 }
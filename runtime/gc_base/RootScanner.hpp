@@ -46,6 +46,9 @@
 class GC_SlotObject;
 class MM_MemoryPool;
 class MM_CollectorLanguageInterfaceImpl;
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+struct MM_OffHeapArrayEntry;
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 
 /**
  * General interface for scanning all object and class slots in the system that are not part of the heap.
@@ -94,6 +97,9 @@ protected:
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 	bool _includeDoubleMap; /**< Enables doublemap should the GC policy be balanced. Default is false. */
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	bool _includeOffHeapArrays; /**< Enables scanning of off heap array data should the GC policy be balanced. Default is false. */
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 	bool _trackVisibleStackFrameDepth; /**< Should the stack walker be told to track the visible frame depth. Default false, should set to true when doing JVMTI walks that report stack slots */
 
 	U_64 _entityStartScanTime; /**< The start time of the scan of the current scanning entity, or 0 if no entity is being scanned.  Defaults to 0. */
@@ -311,6 +317,9 @@ public:
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 		, _includeDoubleMap(_extensions->indexableObjectModel.isDoubleMappingEnabled())
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+		, _includeOffHeapArrays(_extensions->indexableObjectModel.isVirtualLargeObjectHeapEnabled())
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 		, _trackVisibleStackFrameDepth(false)
 		, _entityStartScanTime(0)
 		, _entityIncrementStartTime(0)
@@ -472,6 +481,16 @@ public:
 	void scanDoubleMappedObjects(MM_EnvironmentBase *env);
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	/**
+	 * Scans the off heap array table for data blocks backing large primitive arrays.
+	 * Each entry is reported with the in-heap spine which owns it.
+	 *
+	 * @param env thread GC Environment
+	 */
+	void scanOffHeapArrays(MM_EnvironmentBase *env);
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+
 	virtual void doClassLoader(J9ClassLoader *classLoader);
 
 	virtual void scanWeakReferenceObjects(MM_EnvironmentBase *env);
@@ -538,6 +557,16 @@ public:
 	 */
 	virtual void doDoubleMappedObjectSlot(J9Object *objectPtr, struct J9PortVmemIdentifier *identifier);
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	/**
+	 * Frees off heap data associated to the entry's spine if the spine is not live,
+	 * or updates the entry if the spine has moved
+	 *
+	 * @param entry[in/out] off heap array table entry
+	 * @param offHeapArrayIterator[in] iterator over the off heap array table, used to remove the entry
+	 */
+	virtual void doOffHeapArraySlot(MM_OffHeapArrayEntry *entry, GC_HashTableIterator *offHeapArrayIterator);
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 	
 	/**
 	 * Called for each object stack slot. Subclasses may override.
@@ -30,6 +30,9 @@
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
+#if defined(J9VM_GC_VLHGC)
+#include "IncrementalGenerationalGC.hpp"
+#endif /* defined(J9VM_GC_VLHGC) */
 #include "MemorySpace.hpp"
 #include "OMRVMInterface.hpp"
 
@@ -45,6 +48,13 @@ j9gc_all_object_and_vm_slots_do(J9JavaVM *javaVM, void *function, void *userData
 void 
 j9gc_flush_caches_for_walk(J9JavaVM *javaVM)
 {
+#if defined(J9VM_GC_VLHGC)
+	/* a concurrent global sweep writes free entries without VM access, so it must be stopped before the heap is walked */
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM);
+	if (extensions->isVLHGC()) {
+		((MM_IncrementalGenerationalGC *)extensions->getGlobalCollector())->stopConcurrentGlobalSweep();
+	}
+#endif /* defined(J9VM_GC_VLHGC) */
 	GC_OMRVMInterface::flushCachesForWalk(javaVM->omrVM);
 }
 
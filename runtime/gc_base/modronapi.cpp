@@ -38,6 +38,9 @@
 #include "HeapRegionDescriptor.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+#include "IdleGCManager.hpp"
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 #include "GlobalCollector.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectModel.hpp"
@@ -839,6 +842,33 @@ j9gc_get_maximum_heap_size(J9JavaVM *javaVM)
 	return size;
 }
 
+/**
+ * API to return the drop in process resident set size observed across idle cycles
+ * (-XX:+IdleTuningGcOnIdle, gencon only) to interested parties
+ * @param[out] cycleCount the number of idle cycles serviced
+ * @param[out] lastRSSReduction the resident set size drop across the most recent idle cycle, in bytes
+ * @param[out] totalRSSReduction the sum of the resident set size drops across all idle cycles, in bytes
+ * @return 1 if idle cycles are enabled for the current policy, 0 otherwise (all outputs are zeroed)
+ */
+UDATA
+j9gc_get_idle_rss_statistics(J9JavaVM *javaVM, U_64 *cycleCount, U_64 *lastRSSReduction, U_64 *totalRSSReduction)
+{
+	UDATA result = 0;
+	*cycleCount = 0;
+	*lastRSSReduction = 0;
+	*totalRSSReduction = 0;
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	MM_IdleGCManager *idleGCManager = MM_GCExtensions::getExtensions(javaVM)->idleGCManager;
+	if (NULL != idleGCManager) {
+		*cycleCount = idleGCManager->getIdleCycleCount();
+		*lastRSSReduction = idleGCManager->getLastRSSReduction();
+		*totalRSSReduction = idleGCManager->getTotalRSSReduction();
+		result = 1;
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+	return result;
+}
+
 /**
  * API to return a string representing the current GC mode.
  * Examples of the string returned are "optthruput", and "gencon".
@@ -35,6 +35,7 @@
 #include "GCExtensions.hpp"
 
 class GC_CheckEngine;
+class MM_EnvironmentBase;
 
 /**
  * GC_Check - abstract class for defining types of check
@@ -80,6 +81,16 @@ public:
 	UDATA getBitId() { return _bitId; }
 	
 	void run(bool shouldCheck, bool shouldPrint);   /**< run gc_check on the structure */
+
+	/**
+	 * Run the check on a GC worker thread, as part of GC_CheckEngine::runParallelCheck().
+	 * Work is divided with J9MODRON_HANDLE_NEXT_WORK_UNIT and every error goes to the worker's engine.
+	 * Only checks which call runParallelCheck() need to implement this.
+	 * @param env the worker thread
+	 * @param workerEngine the engine owned by the worker
+	 */
+	virtual void checkParallel(MM_EnvironmentBase *env, GC_CheckEngine *workerEngine) {}
+
 	virtual const char *getCheckName() = 0; /**< get a string representing this check-type */
 
 	GC_Check(J9JavaVM *javaVM, GC_CheckEngine *engine)
@@ -103,6 +103,7 @@
 #define J9MODRON_GCCHK_MISC_MIDSCAVENGE ((UDATA)0x00010000)
 #define J9MODRON_GCCHK_MISC_OWNABLESYNCHRONIZER_CONSISTENCY ((UDATA)0x00020000)
 #define J9MODRON_GCCHK_VALID_INDEXABLE_DATA_ADDRESS ((UDATA)0x00040000)
+#define J9MODRON_GCCHK_MISC_PARALLEL ((UDATA)0x00080000)
 /** @} */
 
 /**
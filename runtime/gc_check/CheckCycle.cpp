@@ -112,6 +112,7 @@ GC_CheckCycle::printHelp(J9PortLibrary *portLib)
 	j9tty_printf(PORTLIB, "  check\n");
 	j9tty_printf(PORTLIB, "  nocheck\n");
 	j9tty_printf(PORTLIB, "  maxErrors=X\n");
+	j9tty_printf(PORTLIB, "  parallel          verify the object heap, remembered set and thread stacks on the GC worker threads\n");
 
 	j9tty_printf(PORTLIB, "  abort\n");
 	j9tty_printf(PORTLIB, "  noabort\n");
@@ -310,6 +311,11 @@ top:
 						}
 #endif /* J9VM_GC_MODRON_SCAVENGER  || defined(J9VM_GC_VLHGC) */
 
+						if (try_scan(&scan_start, "parallel")) {
+							miscFlags |= J9MODRON_GCCHK_MISC_PARALLEL;
+							continue;
+						}
+
 						if (try_scan(&scan_start, "abort")) {
 							miscFlags |= J9MODRON_GCCHK_MISC_ABORT;
 							continue;
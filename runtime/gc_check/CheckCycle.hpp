@@ -33,6 +33,7 @@
 #include "j9cfg.h"
 
 #include "Base.hpp"
+#include "AtomicOperationsAPI.hpp"
 #include "CheckBase.hpp"
 
 class GC_Check;
@@ -56,7 +57,7 @@ private:
 	UDATA _miscFlags;
 	GCCheckInvokedBy _invokedBy; /**< What stage of GC invoked the check */
 	UDATA _manualCheckInvocation; /**< Allow user to identify which installed GCCheck triggered message */
-	UDATA _errorCount; /**< Number of errors encountered  */
+	volatile UDATA _errorCount; /**< Number of errors encountered  */
 	
 	GC_Check *_checks; /**< Pointer to head of linked list of checks to run in this cycle */
 	
@@ -85,7 +86,8 @@ public:
 	GCCheckInvokedBy getInvoker() { return _invokedBy; };
 	UDATA getManualCheckNumber() { return _manualCheckInvocation; };
 	
-	UDATA nextErrorCount() { return ++_errorCount; };
+	/* errors can be found by several GC worker threads at once, see J9MODRON_GCCHK_MISC_PARALLEL */
+	UDATA nextErrorCount() { return MM_AtomicOperations::add(&_errorCount, 1); };
 	
 	/**
 	 * Run the checks
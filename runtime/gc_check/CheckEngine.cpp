@@ -39,22 +39,59 @@
 #include "ArrayletLeafIterator.hpp"
 #include "CheckEngine.hpp"
 #include "Base.hpp"
+#include "Check.hpp"
 #include "CheckBase.hpp"
 #include "CheckCycle.hpp"
 #include "CheckError.hpp"
 #include "CheckReporter.hpp"
+#include "CheckReporterBuffered.hpp"
 #include "CheckReporterTTY.hpp"
 #include "ClassModel.hpp"
+#include "EnvironmentBase.hpp"
 #include "ForwardedHeader.hpp"
 #include "GCExtensions.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "ModronTypes.hpp"
 #include "ObjectModel.hpp"
 #include "ObjectAccessBarrier.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelTask.hpp"
 #include "ScanFormatter.hpp"
 #include "SublistPool.hpp"
 #include "SublistPuddle.hpp"
 
+/**
+ * Task used by GC_CheckEngine::runParallelCheck(): every GC worker thread runs the check
+ * against its own engine.
+ */
+class GC_CheckParallelTask : public MM_ParallelTask
+{
+	/* Data Members */
+private:
+	GC_Check *_check; /**< the check being run */
+	GC_CheckEngine *_engine; /**< the engine owning the worker engines */
+protected:
+public:
+
+	/* Member Functions */
+private:
+protected:
+public:
+	virtual UDATA getVMStateID(void) { return J9VMSTATE_GC; }
+	virtual void run(MM_EnvironmentBase *env)
+	{
+		_check->checkParallel(env, _engine->getWorkerEngine(env->getWorkerID()));
+	}
+
+	GC_CheckParallelTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, GC_Check *check, GC_CheckEngine *engine)
+		: MM_ParallelTask(env, dispatcher)
+		, _check(check)
+		, _engine(engine)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 /**
  * Private struct used as the user data for object slot iterator callbacks.
  */
@@ -1392,12 +1429,195 @@ void
 GC_CheckEngine::kill()
 {
 	MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+	tearDownWorkerEngines();
 	if(_reporter) {
 		_reporter->kill();
 	}
 	forge->free(this);
 }
 
+/**
+ * Allocate an engine, reporting to a buffer, for each GC worker thread.
+ * @param workerCount the maximum number of GC worker threads
+ * @return true on success, false if any allocation failed (the caller tears down what was built)
+ */
+bool
+GC_CheckEngine::initializeWorkerEngines(UDATA workerCount)
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+
+	_workerEngines = (GC_CheckEngine **)forge->allocate(workerCount * sizeof(GC_CheckEngine *), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL == _workerEngines) {
+		return false;
+	}
+	memset(_workerEngines, 0, workerCount * sizeof(GC_CheckEngine *));
+	_workerReporters = (GC_CheckReporterBuffered **)forge->allocate(workerCount * sizeof(GC_CheckReporterBuffered *), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL == _workerReporters) {
+		return false;
+	}
+	memset(_workerReporters, 0, workerCount * sizeof(GC_CheckReporterBuffered *));
+	_workerEngineCount = workerCount;
+
+	if (0 != omrthread_monitor_init_with_name(&_workerOutputMonitor, 0, "GC check worker output")) {
+		_workerOutputMonitor = NULL;
+		return false;
+	}
+
+	for (UDATA i = 0; i < workerCount; i++) {
+		GC_CheckReporterBuffered *reporter = GC_CheckReporterBuffered::newInstance(_javaVM);
+		if (NULL == reporter) {
+			return false;
+		}
+		GC_CheckEngine *engine = GC_CheckEngine::newInstance(_javaVM, reporter);
+		if (NULL == engine) {
+			reporter->kill();
+			return false;
+		}
+		_workerReporters[i] = reporter;
+		_workerEngines[i] = engine;
+	}
+	return true;
+}
+
+/**
+ * Free the worker engines (their reporters go with them) and the worker output monitor.
+ * Worker engines never own workers of their own, so this does nothing for them.
+ */
+void
+GC_CheckEngine::tearDownWorkerEngines()
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+
+	if (NULL != _workerEngines) {
+		for (UDATA i = 0; i < _workerEngineCount; i++) {
+			if (NULL != _workerEngines[i]) {
+				_workerEngines[i]->kill();
+			}
+		}
+		forge->free(_workerEngines);
+		_workerEngines = NULL;
+
+		if (NULL != _workerReporters) {
+			forge->free(_workerReporters);
+			_workerReporters = NULL;
+		}
+		if (NULL != _workerOutputMonitor) {
+			omrthread_monitor_destroy(_workerOutputMonitor);
+			_workerOutputMonitor = NULL;
+		}
+	}
+	_workerEngineCount = 0;
+}
+
+/**
+ * Reset a worker engine for the check about to be run on it by the given main engine.
+ */
+void
+GC_CheckEngine::prepareWorkerEngine(GC_CheckEngine *mainEngine)
+{
+	_cycle = mainEngine->_cycle;
+	_currentCheck = mainEngine->_currentCheck;
+#if defined(J9VM_GC_MODRON_SCAVENGER)
+	_scavengerBackout = mainEngine->_scavengerBackout;
+	_rsOverflowState = mainEngine->_rsOverflowState;
+#endif /* J9VM_GC_MODRON_SCAVENGER */
+	_workerOutputMonitor = mainEngine->_workerOutputMonitor;
+	clearPreviousObjects();
+	clearRegionDescription(&_regionDesc);
+	clearCheckedCache();
+	_ownableSynchronizerObjectCountOnHeap = 0;
+
+	GC_CheckReporterBuffered *reporter = (GC_CheckReporterBuffered *)_reporter;
+	reporter->reset();
+	reporter->setMaxErrorsToReport(mainEngine->_reporter->getMaxErrorsToReport());
+}
+
+/**
+ * Determine whether the current check can be handed to the GC worker threads.
+ * The dispatcher may only be driven by a thread holding exclusive access which is not
+ * itself running a task, and only while no concurrent GC work owns it. Debugger
+ * invocations do not have a dispatcher at all.
+ */
+bool
+GC_CheckEngine::isParallelCheckPossible()
+{
+	if ((NULL == _cycle) || (J9MODRON_GCCHK_MISC_PARALLEL != (_cycle->getMiscFlags() & J9MODRON_GCCHK_MISC_PARALLEL))) {
+		return false;
+	}
+	if (invocation_debugger == _cycle->getInvoker()) {
+		return false;
+	}
+
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(_javaVM);
+	if ((NULL == extensions->dispatcher) || extensions->isMetronomeGC() || (extensions->dispatcher->threadCountMaximum() < 2)) {
+		return false;
+	}
+
+	J9VMThread *vmThread = _javaVM->internalVMFunctions->currentVMThread(_javaVM);
+	if ((NULL == vmThread) || (J9_XACCESS_EXCLUSIVE != _javaVM->exclusiveAccessState)) {
+		return false;
+	}
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+	if (NULL != env->_currentTask) {
+		return false;
+	}
+
+	/* concurrent GC work (concurrent scavenge, concurrent global mark or sweep) owns the dispatcher */
+	return TRUE == _javaVM->memoryManagerFunctions->j9mm_is_parallel_walk_possible(vmThread);
+}
+
+bool
+GC_CheckEngine::startParallelCheck()
+{
+	if (!isParallelCheckPossible()) {
+		return false;
+	}
+
+	UDATA workerCount = MM_GCExtensions::getExtensions(_javaVM)->dispatcher->threadCountMaximum();
+	if (workerCount > _workerEngineCount) {
+		tearDownWorkerEngines();
+		if (!initializeWorkerEngines(workerCount)) {
+			tearDownWorkerEngines();
+			return false;
+		}
+	}
+
+	for (UDATA i = 0; i < _workerEngineCount; i++) {
+		_workerEngines[i]->prepareWorkerEngine(this);
+	}
+	return true;
+}
+
+void
+GC_CheckEngine::endParallelCheck()
+{
+	_reporter->reportBuffered(_workerReporters, _workerEngineCount);
+
+	if (UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER != _ownableSynchronizerObjectCountOnHeap) {
+		for (UDATA i = 0; i < _workerEngineCount; i++) {
+			_ownableSynchronizerObjectCountOnHeap += _workerEngines[i]->_ownableSynchronizerObjectCountOnHeap;
+		}
+	}
+	clearPreviousObjects();
+}
+
+bool
+GC_CheckEngine::runParallelCheck(GC_Check *check)
+{
+	if (!startParallelCheck()) {
+		return false;
+	}
+
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(_javaVM);
+	J9VMThread *vmThread = _javaVM->internalVMFunctions->currentVMThread(_javaVM);
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+	GC_CheckParallelTask checkTask(env, extensions->dispatcher, check, this);
+	extensions->dispatcher->run(env, &checkTask);
+
+	endParallelCheck();
+	return true;
+}
+
 /**
  * Determine whether or not the a verbose stack dump should always be displayed.
  *
@@ -1413,6 +1633,25 @@ GC_CheckEngine::isStackDumpAlwaysDisplayed()
 	return (J9MODRON_GCCHK_MISC_ALWAYS_DUMP_STACK == (_cycle->getMiscFlags() & J9MODRON_GCCHK_MISC_ALWAYS_DUMP_STACK));
 }
 
+/**
+ * Print the stack of a thread whose slots were just verified.
+ * When called on a GC worker thread the dumps of different workers are serialized.
+ *
+ * @param walkThread the thread to dump
+ * @param reason message printed with the dump
+ */
+void
+GC_CheckEngine::verboseStackDump(J9VMThread *walkThread, const char *reason)
+{
+	if (NULL != _workerOutputMonitor) {
+		omrthread_monitor_enter(_workerOutputMonitor);
+	}
+	_javaVM->verboseStackDump(walkThread, reason);
+	if (NULL != _workerOutputMonitor) {
+		omrthread_monitor_exit(_workerOutputMonitor);
+	}
+}
+
 /**
  * Copy the information from one regionDescription to the other.
  * @param from - the source region
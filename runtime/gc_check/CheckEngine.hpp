@@ -31,6 +31,7 @@
 
 #include "j9.h"
 #include "j9cfg.h"
+#include "omrthread.h"
 
 #include "Base.hpp"
 #include "CheckBase.hpp"
@@ -40,6 +41,7 @@
 #include "MemorySpace.hpp"
 
 class GC_CheckCycle;
+class GC_CheckReporterBuffered;
 class GC_FinalizeList;
 class GC_ScanFormatter;
 class GC_VMThreadIterator;
@@ -76,6 +78,11 @@ private:
 	#define UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER ((UDATA)-1)
 	UDATA	_ownableSynchronizerObjectCountOnList; /**< the count of ownableSynchronizerObjects on the ownableSynchronizerLists, =UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER indicates that the count has not been calculated */
 	UDATA	_ownableSynchronizerObjectCountOnHeap; /**< the count of ownableSynchronizerObjects on the heap, =UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER indicates that the count has not been calculated */
+
+	GC_CheckEngine **_workerEngines; /**< one engine per GC worker thread for parallel checks, indexed by worker ID */
+	GC_CheckReporterBuffered **_workerReporters; /**< the reporters of _workerEngines, replayed to _reporter after each parallel check */
+	UDATA _workerEngineCount; /**< the number of entries in _workerEngines */
+	omrthread_monitor_t _workerOutputMonitor; /**< serializes output which cannot be buffered (stack dumps) while workers run */
 	
 protected:
 
@@ -119,6 +126,11 @@ private:
 	
 	bool initialize(void);
 
+	bool isParallelCheckPossible();
+	bool initializeWorkerEngines(UDATA workerCount);
+	void tearDownWorkerEngines();
+	void prepareWorkerEngine(GC_CheckEngine *mainEngine);
+
 protected:
 
 public:
@@ -162,6 +174,30 @@ public:
 	void endCheckCycle(J9JavaVM *javaVM);
 	void startNewCheck(GC_Check *check);	
 	bool isStackDumpAlwaysDisplayed();
+	void verboseStackDump(J9VMThread *walkThread, const char *reason);
+
+	/**
+	 * Prepare the worker engines for a check that runs on the GC worker threads.
+	 * This fails, and the caller runs the check serially, if the parallel misc option was not
+	 * given, the dispatcher cannot be used from the current thread, or concurrent GC work owns it.
+	 * Every successful call must be matched with endParallelCheck().
+	 * @return true if the check may be run in parallel
+	 */
+	bool startParallelCheck();
+
+	/**
+	 * Complete a parallel check: report the errors the workers collected, in error number
+	 * order, and fold their ownable synchronizer counts into this engine.
+	 */
+	void endParallelCheck();
+
+	/**
+	 * Run a check on all GC worker threads by calling its checkParallel() on each of them.
+	 * @return true if the check was run, false if it must be run serially
+	 */
+	bool runParallelCheck(GC_Check *check);
+
+	MMINLINE GC_CheckEngine *getWorkerEngine(UDATA workerID) { return _workerEngines[workerID]; };
 	void copyRegionDescription(J9MM_IterateRegionDescriptor* from, J9MM_IterateRegionDescriptor* to);
 	void clearRegionDescription(J9MM_IterateRegionDescriptor* toClear);
 	
@@ -184,6 +220,10 @@ public:
 		, _lastHeapObject3()
 		, _ownableSynchronizerObjectCountOnList(UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER)
 		, _ownableSynchronizerObjectCountOnHeap(UNINITIALIZED_SIZE_FOR_OWNABLESYNCHRONIER)
+		, _workerEngines(NULL)
+		, _workerReporters(NULL)
+		, _workerEngineCount(0)
+		, _workerOutputMonitor(NULL)
 #if defined(J9VM_GC_MODRON_SCAVENGER)	
 		, _scavengerBackout(false)
 		, _rsOverflowState(false)
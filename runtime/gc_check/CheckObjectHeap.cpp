@@ -44,6 +44,7 @@ static jvmtiIterationControl check_heapIteratorCallback(J9JavaVM* vm, J9MM_Itera
 static jvmtiIterationControl check_spaceIteratorCallback(J9JavaVM* vm, J9MM_IterateSpaceDescriptor* spaceDesc, void* userData);
 static jvmtiIterationControl check_regionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, void* userData);
 static jvmtiIterationControl check_objectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* userData);
+static jvmtiIterationControl check_parallelRegionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, UDATA workerID, void* userData);
 
 GC_Check *
 GC_CheckObjectHeap::newInstance(J9JavaVM *javaVM, GC_CheckEngine *engine)
@@ -72,6 +73,15 @@ GC_CheckObjectHeap::check()
 	userData.engine = _engine;
 	userData.portLibrary = _portLibrary;
 	userData.regionDesc = NULL;
+
+	if (_engine->startParallelCheck()) {
+		/* regions are handed out to the GC worker threads, each verifying with its own engine */
+		J9VMThread *vmThread = _javaVM->internalVMFunctions->currentVMThread(_javaVM);
+		_javaVM->memoryManagerFunctions->j9mm_iterate_regions_parallel(vmThread, _portLibrary, 0, check_parallelRegionIteratorCallback, &userData);
+		_engine->endParallelCheck();
+		return;
+	}
+
 	_javaVM->memoryManagerFunctions->j9mm_iterate_heaps(_javaVM, _portLibrary, 0, check_heapIteratorCallback, &userData);
 }
 
@@ -107,6 +117,21 @@ check_regionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionD
 	return JVMTI_ITERATION_CONTINUE;
 }
 
+static jvmtiIterationControl
+check_parallelRegionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, UDATA workerID, void* userData)
+{
+	ObjectIteratorCallbackUserData* castUserData = (ObjectIteratorCallbackUserData*)userData;
+	ObjectIteratorCallbackUserData workerUserData;
+	workerUserData.engine = castUserData->engine->getWorkerEngine(workerID);
+	workerUserData.portLibrary = castUserData->portLibrary;
+	workerUserData.regionDesc = regionDesc;
+
+	/* the regions a worker visits are not adjacent, so the previous objects of the last one mean nothing here */
+	workerUserData.engine->clearPreviousObjects();
+	vm->memoryManagerFunctions->j9mm_iterate_region_objects(vm, workerUserData.portLibrary, regionDesc, j9mm_iterator_flag_include_holes, check_objectIteratorCallback, &workerUserData);
+	return JVMTI_ITERATION_CONTINUE;
+}
+
 static jvmtiIterationControl
 check_objectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* userData)
 {
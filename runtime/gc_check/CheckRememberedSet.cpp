@@ -22,8 +22,10 @@
 
 #include "CheckEngine.hpp"
 #include "CheckRememberedSet.hpp"
+#include "EnvironmentBase.hpp"
 #include "ModronTypes.hpp"
 #include "ScanFormatter.hpp"
+#include "Task.hpp"
 
 #if defined(J9VM_GC_GENERATIONAL)
 
@@ -58,6 +60,10 @@ GC_CheckRememberedSet::check()
 		return;
 	}
 
+	if (_engine->runParallelCheck(this)) {
+		return;
+	}
+
 	while((puddle = remSetIterator.nextList()) != NULL) {
 		GC_RememberedSetSlotIterator remSetSlotIterator(puddle);
 
@@ -69,6 +75,27 @@ GC_CheckRememberedSet::check()
 	}
 }
 
+void
+GC_CheckRememberedSet::checkParallel(MM_EnvironmentBase *env, GC_CheckEngine *workerEngine)
+{
+	J9Object **slotPtr = NULL;
+	MM_SublistPuddle *puddle = NULL;
+	GC_RememberedSetIterator remSetIterator(&_extensions->rememberedSet);
+
+	/* each puddle is a work unit; a worker stops at its first failure, like the serial check */
+	while (NULL != (puddle = remSetIterator.nextList())) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			GC_RememberedSetSlotIterator remSetSlotIterator(puddle);
+
+			while (NULL != (slotPtr = (J9Object **)remSetSlotIterator.nextSlot())) {
+				if (J9MODRON_SLOT_ITERATOR_OK != workerEngine->checkSlotRememberedSet(_javaVM, slotPtr, puddle)) {
+					return;
+				}
+			}
+		}
+	}
+}
+
 void
 GC_CheckRememberedSet::print()
 {
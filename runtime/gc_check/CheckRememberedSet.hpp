@@ -47,6 +47,7 @@ private:
 public:
 	static GC_Check *newInstance(J9JavaVM *javaVM, GC_CheckEngine *engine);
 	virtual void kill();
+	virtual void checkParallel(MM_EnvironmentBase *env, GC_CheckEngine *workerEngine); /**< verify the puddles on a GC worker thread */
 
 	virtual const char *getCheckName() { return "REMEMBERED SET"; };
 
@@ -27,6 +27,7 @@
  */
 
 #include "CheckReporter.hpp"
+#include "CheckReporterBuffered.hpp"
 
 void 
 GC_CheckReporter::reportGenericType(GC_CheckError *error, GC_CheckElement reference, const char *prefix)
@@ -44,3 +45,59 @@ GC_CheckReporter::reportGenericType(GC_CheckError *error, GC_CheckElement refere
 			break;
 	}	
 }
+
+void
+GC_CheckReporter::reportBuffered(GC_CheckReporterBuffered **buffers, UDATA bufferCount)
+{
+	UDATA droppedCount = 0;
+
+	for (UDATA i = 0; i < bufferCount; i++) {
+		droppedCount += buffers[i]->getDroppedCount();
+	}
+
+	while (true) {
+		/* find the buffer holding the lowest error number not yet replayed */
+		GC_CheckReporterBuffered *next = NULL;
+		UDATA errorNumber = 0;
+		for (UDATA i = 0; i < bufferCount; i++) {
+			GC_CheckReporterBuffered::Entry *entry = buffers[i]->peekEntry();
+			if ((NULL != entry) && ((NULL == next) || (entry->error._errorNumber < errorNumber))) {
+				next = buffers[i];
+				errorNumber = entry->error._errorNumber;
+			}
+		}
+		if (NULL == next) {
+			break;
+		}
+
+		/* replay every entry of that error (the report and its object, class or heap walk details) */
+		GC_CheckReporterBuffered::Entry *entry = NULL;
+		while ((NULL != (entry = next->peekEntry())) && (errorNumber == entry->error._errorNumber)) {
+			switch (entry->type) {
+			case GC_CheckReporterBuffered::entry_report:
+				report(&entry->error);
+				break;
+			case GC_CheckReporterBuffered::entry_object_header:
+				reportObjectHeader(&entry->error, (J9Object *)entry->subject, entry->prefix);
+				break;
+			case GC_CheckReporterBuffered::entry_class:
+				reportClass(&entry->error, (J9Class *)entry->subject, entry->prefix);
+				break;
+			case GC_CheckReporterBuffered::entry_fatal_error:
+				reportFatalError(&entry->error);
+				break;
+			case GC_CheckReporterBuffered::entry_heap_walk_error:
+				reportHeapWalkError(&entry->error, entry->previous1, entry->previous2, entry->previous3);
+				break;
+			default:
+				break;
+			}
+			next->nextReplayEntry();
+		}
+	}
+
+	if (0 != droppedCount) {
+		PORT_ACCESS_FROM_PORT(_portLibrary);
+		j9tty_printf(PORTLIB, "  <gc check: %zu reports of the parallel check were lost, out of memory>\n", droppedCount);
+	}
+}
@@ -36,6 +36,8 @@
 #include "CheckError.hpp"
 #include "CheckElement.hpp"
 
+class GC_CheckReporterBuffered;
+
 /**
  * Output reports.
  * Accepts an GC_CheckError object and outputs the contents of the error report
@@ -105,7 +107,17 @@ public:
 		GC_CheckElement previousObjectPtr2, 
 		GC_CheckElement previousObjectPtr3) = 0;
 
+	/**
+	 * Replay the entries collected by the workers of a parallel check.
+	 * Each buffer holds its errors in increasing error number order; the buffers are merged
+	 * so that the errors come out in the order in which their numbers were handed out.
+	 * @param buffers the per-worker buffers
+	 * @param bufferCount the number of buffers
+	 */
+	void reportBuffered(GC_CheckReporterBuffered **buffers, UDATA bufferCount);
+
 	void setMaxErrorsToReport(UDATA count) { _maxErrorsToReport = count; }
+	UDATA getMaxErrorsToReport() { return _maxErrorsToReport; }
 	bool shouldReport(GC_CheckError *error) { 
 		return (_maxErrorsToReport == 0) || (error->_errorNumber <= _maxErrorsToReport);
 	}
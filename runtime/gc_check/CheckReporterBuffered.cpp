@@ -0,0 +1,136 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Check
+ */
+
+#include "CheckReporterBuffered.hpp"
+
+#include "GCExtensions.hpp"
+
+GC_CheckReporterBuffered *
+GC_CheckReporterBuffered::newInstance(J9JavaVM *javaVM)
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(javaVM)->getForge();
+
+	GC_CheckReporterBuffered *reporter = (GC_CheckReporterBuffered *)forge->allocate(sizeof(GC_CheckReporterBuffered), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (reporter) {
+		reporter = new(reporter) GC_CheckReporterBuffered(javaVM);
+	}
+	return reporter;
+}
+
+void
+GC_CheckReporterBuffered::kill()
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+	if (NULL != _entries) {
+		forge->free(_entries);
+	}
+	forge->free(this);
+}
+
+/**
+ * Reserve the next entry, growing the buffer if required.
+ * Errors beyond the maximum number to report are not recorded at all, since the
+ * reporter they are replayed to would drop them anyway.
+ * @return the entry to fill in, or NULL if nothing should be recorded
+ */
+GC_CheckReporterBuffered::Entry *
+GC_CheckReporterBuffered::nextEntry(GC_CheckError *error, EntryType type)
+{
+	if (!shouldReport(error)) {
+		return NULL;
+	}
+
+	if (_entryCount == _entryCapacity) {
+		MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+		UDATA newCapacity = (0 == _entryCapacity) ? INITIAL_ENTRY_COUNT : (_entryCapacity * 2);
+		Entry *newEntries = (Entry *)forge->allocate(newCapacity * sizeof(Entry), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+		if (NULL == newEntries) {
+			_droppedCount += 1;
+			return NULL;
+		}
+		if (NULL != _entries) {
+			memcpy(newEntries, _entries, _entryCount * sizeof(Entry));
+			forge->free(_entries);
+		}
+		_entries = newEntries;
+		_entryCapacity = newCapacity;
+	}
+
+	Entry *entry = &_entries[_entryCount];
+	_entryCount += 1;
+	entry->error = *error;
+	entry->type = type;
+	entry->subject = NULL;
+	entry->prefix = NULL;
+	entry->previous1 = GC_CheckElement();
+	entry->previous2 = GC_CheckElement();
+	entry->previous3 = GC_CheckElement();
+	return entry;
+}
+
+void
+GC_CheckReporterBuffered::report(GC_CheckError *error)
+{
+	nextEntry(error, entry_report);
+}
+
+void
+GC_CheckReporterBuffered::reportObjectHeader(GC_CheckError *error, J9Object *objectPtr, const char *prefix)
+{
+	Entry *entry = nextEntry(error, entry_object_header);
+	if (NULL != entry) {
+		entry->subject = (void *)objectPtr;
+		entry->prefix = prefix;
+	}
+}
+
+void
+GC_CheckReporterBuffered::reportClass(GC_CheckError *error, J9Class *clazz, const char *prefix)
+{
+	Entry *entry = nextEntry(error, entry_class);
+	if (NULL != entry) {
+		entry->subject = (void *)clazz;
+		entry->prefix = prefix;
+	}
+}
+
+void
+GC_CheckReporterBuffered::reportFatalError(GC_CheckError *error)
+{
+	nextEntry(error, entry_fatal_error);
+}
+
+void
+GC_CheckReporterBuffered::reportHeapWalkError(GC_CheckError *error, GC_CheckElement previousObjectPtr1, GC_CheckElement previousObjectPtr2, GC_CheckElement previousObjectPtr3)
+{
+	Entry *entry = nextEntry(error, entry_heap_walk_error);
+	if (NULL != entry) {
+		entry->previous1 = previousObjectPtr1;
+		entry->previous2 = previousObjectPtr2;
+		entry->previous3 = previousObjectPtr3;
+	}
+}
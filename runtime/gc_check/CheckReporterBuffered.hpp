@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Check
+ */
+
+#if !defined(CHECKREPORTERBUFFERED_HPP_)
+#define CHECKREPORTERBUFFERED_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "CheckError.hpp"
+#include "CheckReporter.hpp"
+
+/**
+ * Collect reports made on a GC worker thread during a parallel check.
+ * Nothing is written while the check runs; the entries are kept in the order they were
+ * made and handed to the cycle's reporter once the workers are done (see GC_CheckReporter::reportBuffered).
+ * @ingroup GC_Check
+ */
+class GC_CheckReporterBuffered : public GC_CheckReporter
+{
+public:
+	enum EntryType {
+		entry_report = 0,
+		entry_object_header,
+		entry_class,
+		entry_fatal_error,
+		entry_heap_walk_error
+	};
+
+	/**
+	 * A recorded call on the reporter. The error is copied, everything it points to stays
+	 * valid until the parallel check has been replayed.
+	 */
+	struct Entry {
+		GC_CheckError error;
+		EntryType type;
+		void *subject; /**< the object or class reported by reportObjectHeader / reportClass */
+		const char *prefix;
+		GC_CheckElement previous1;
+		GC_CheckElement previous2;
+		GC_CheckElement previous3;
+	};
+
+private:
+	enum { INITIAL_ENTRY_COUNT = 64 };
+	Entry *_entries; /**< recorded entries, in the order they were made */
+	UDATA _entryCount; /**< number of valid entries */
+	UDATA _entryCapacity; /**< number of entries _entries has room for */
+	UDATA _droppedCount; /**< entries which could not be recorded because the buffer could not grow */
+	UDATA _replayIndex; /**< next entry to hand out while the buffer is being replayed */
+
+	Entry *nextEntry(GC_CheckError *error, EntryType type);
+
+public:
+	static GC_CheckReporterBuffered *newInstance(J9JavaVM *javaVM);
+	virtual void kill();
+	virtual void report(GC_CheckError *error);
+	virtual void reportObjectHeader(GC_CheckError *error, J9Object *objectPtr, const char *prefix);
+	virtual void reportClass(GC_CheckError *error, J9Class *clazz, const char *prefix);
+	virtual void reportFatalError(GC_CheckError *error);
+	virtual void reportHeapWalkError(GC_CheckError *error, GC_CheckElement previousObjectPtr1, GC_CheckElement previousObjectPtr2, GC_CheckElement previousObjectPtr3);
+
+	/**
+	 * Forget all recorded entries; called before each parallel check.
+	 */
+	void reset() { _entryCount = 0; _droppedCount = 0; _replayIndex = 0; }
+
+	/**
+	 * @return the next entry to be replayed, or NULL if all entries have been replayed
+	 */
+	Entry *peekEntry() { return (_replayIndex < _entryCount) ? &_entries[_replayIndex] : NULL; }
+	void nextReplayEntry() { _replayIndex += 1; }
+	UDATA getDroppedCount() { return _droppedCount; }
+
+	/**
+	 * Create a new CheckReporterBuffered object
+	 */
+	GC_CheckReporterBuffered(J9JavaVM *javaVM)
+		: GC_CheckReporter(javaVM)
+		, _entries(NULL)
+		, _entryCount(0)
+		, _entryCapacity(0)
+		, _droppedCount(0)
+		, _replayIndex(0)
+	{}
+};
+
+#endif /* CHECKREPORTERBUFFERED_HPP_ */
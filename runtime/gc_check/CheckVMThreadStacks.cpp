@@ -22,8 +22,10 @@
 
 #include "CheckEngine.hpp"
 #include "CheckVMThreadStacks.hpp"
+#include "EnvironmentBase.hpp"
 #include "ModronTypes.hpp"
 #include "ScanFormatter.hpp"
+#include "Task.hpp"
 
 /**
  * Wrapper for GC_CheckEngine::checkSlot being used by GC_VMThreadStackSlotIterator::scanSlots
@@ -89,26 +91,44 @@ GC_CheckVMThreadStacks::check()
 {
 	GC_VMThreadListIterator vmThreadListIterator(_javaVM);			
 	J9VMThread *walkThread;
-#if defined(J9VM_INTERP_VERBOSE)
 	bool doStackDump = _engine->isStackDumpAlwaysDisplayed();
-#endif /* J9VM_INTERP_VERBOSE */
+
+	if (_engine->runParallelCheck(this)) {
+		return;
+	}
 		
 	while((walkThread = vmThreadListIterator.nextVMThread()) != NULL) {
-		J9VMThread *toScanWalkThread;
-		checkStackIteratorData localData = { _engine, walkThread, 0 };
-		toScanWalkThread = walkThread;
-		if (NULL != toScanWalkThread) {
-			GC_VMThreadStackSlotIterator::scanSlots(toScanWalkThread, toScanWalkThread, (void *)&localData, checkStackSlotIterator, false, false);	
+		checkThreadStack(_engine, walkThread, doStackDump);
+	}
+}
 
-#if defined(J9VM_INTERP_VERBOSE)
-			if (_javaVM->verboseStackDump && (doStackDump || (localData.numberOfErrors > 0))) {
-				_javaVM->verboseStackDump(toScanWalkThread, "bad object detected on stack");
-			}
-#endif /* J9VM_INTERP_VERBOSE */
+void
+GC_CheckVMThreadStacks::checkParallel(MM_EnvironmentBase *env, GC_CheckEngine *workerEngine)
+{
+	GC_VMThreadListIterator vmThreadListIterator(_javaVM);
+	J9VMThread *walkThread = NULL;
+	bool doStackDump = workerEngine->isStackDumpAlwaysDisplayed();
+
+	while (NULL != (walkThread = vmThreadListIterator.nextVMThread())) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			checkThreadStack(workerEngine, walkThread, doStackDump);
 		}
 	}
 }
 
+void
+GC_CheckVMThreadStacks::checkThreadStack(GC_CheckEngine *engine, J9VMThread *walkThread, bool doStackDump)
+{
+	checkStackIteratorData localData = { engine, walkThread, 0 };
+	GC_VMThreadStackSlotIterator::scanSlots(walkThread, walkThread, (void *)&localData, checkStackSlotIterator, false, false);
+
+#if defined(J9VM_INTERP_VERBOSE)
+	if (_javaVM->verboseStackDump && (doStackDump || (localData.numberOfErrors > 0))) {
+		engine->verboseStackDump(walkThread, "bad object detected on stack");
+	}
+#endif /* J9VM_INTERP_VERBOSE */
+}
+
 void
 GC_CheckVMThreadStacks::print()
 {
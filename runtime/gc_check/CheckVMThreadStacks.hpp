@@ -43,6 +43,7 @@ class GC_CheckVMThreadStacks : public GC_Check
 private:
 	virtual void check(); /**< run the check */
 	virtual void print(); /**< dump the check structure to tty */
+	void checkThreadStack(GC_CheckEngine *engine, J9VMThread *walkThread, bool doStackDump); /**< verify the slots of one thread */
 
 	/**
 	 * Structure to be passed as user data to the stack walker.
@@ -62,6 +63,7 @@ private:
 public:
 	static GC_Check *newInstance(J9JavaVM *javaVM, GC_CheckEngine *engine);
 	virtual void kill();
+	virtual void checkParallel(MM_EnvironmentBase *env, GC_CheckEngine *workerEngine); /**< verify the threads on a GC worker thread */
 
 	virtual const char *getCheckName() { return "THREAD STACKS"; };
 
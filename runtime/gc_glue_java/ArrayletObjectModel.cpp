@@ -47,10 +47,18 @@ GC_ArrayletObjectModel::AssertBadElementSize()
 void
 GC_ArrayletObjectModel::AssertArrayletIsDiscontiguous(J9IndexableObject *objPtr)
 {
+	bool remainderMayFitInSpine = true;
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
-	if (!isDoubleMappingEnabled())
+	if (isDoubleMappingEnabled()) {
+		remainderMayFitInSpine = false;
+	}
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
-	{
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	if (isVirtualLargeObjectHeapEnabled() && isOffHeapDataArray(objPtr)) {
+		remainderMayFitInSpine = false;
+	}
+#endif /* defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION) */
+	if (remainderMayFitInSpine) {
 		MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
 		UDATA arrayletLeafSize = _omrVM->_arrayletLeafSize;
 		UDATA remainderBytes = getDataSizeInBytes(objPtr) % arrayletLeafSize;
@@ -103,6 +111,12 @@ GC_ArrayletObjectModel::getArrayletLayout(J9Class* clazz, UDATA numberOfElements
 		UDATA arrayletLeafSize = _omrVM->_arrayletLeafSize;
 		UDATA lastArrayletBytes = dataSizeInBytes & (arrayletLeafSize - 1);
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+		if (isVirtualLargeObjectHeapEnabled() && (OBJECT_HEADER_SHAPE_POINTERS != J9GC_CLASS_SHAPE(clazz))) {
+			/* the data of large primitive arrays is stored off heap, the spine only holds the arrayoid */
+			layout = Discontiguous;
+		} else
+#endif /* defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION) */
 		if (lastArrayletBytes > 0) {
 			/* determine how large the spine would be if this were a hybrid array */
 			UDATA numberArraylets = numArraylets(dataSizeInBytes);
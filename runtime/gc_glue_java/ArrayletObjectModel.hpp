@@ -983,6 +983,27 @@ public:
 		return dataAddr;
 	}
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	/**
+	 * Checks if the data of the given indexable object is stored off heap. In
+	 * that case the spine is only a proxy for the data: the arrayoid points into
+	 * the off heap block at leaf size strides and dataAddr points to its beginning.
+	 *
+	 * @param arrayPtr      Pointer to the indexable object
+	 * @return true if the data of the indexable object resides off heap
+	 */
+	MMINLINE bool
+	isOffHeapDataArray(J9IndexableObject *arrayPtr)
+	{
+		bool isOffHeap = false;
+		if (isVirtualLargeObjectHeapEnabled() && (InlineContiguous != getArrayLayout(arrayPtr))) {
+			void *dataAddr = *dataAddrSlotForDiscontiguous(arrayPtr);
+			isOffHeap = (NULL != dataAddr) && (dataAddr != (void *)((uintptr_t)arrayPtr + discontiguousIndexableHeaderSize()));
+		}
+		return isOffHeap;
+	}
+#endif /* defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION) */
+
 	/**
 	 * Returns data pointer associated with the Indexable object.
 	 * Data pointer will always be pointing at the arraylet data. In all
@@ -1039,7 +1060,15 @@ public:
 		} else if (dataSizeInBytes < _omrVM->_arrayletLeafSize) {
 			isValidDataAddress = (dataAddr == (void *)((uintptr_t)arrayPtr + contiguousIndexableHeaderSize()));
 		} else {
-			isValidDataAddress = (dataAddr == NULL);
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+			if (isVirtualLargeObjectHeapEnabled() && (OBJECT_HEADER_SHAPE_POINTERS != J9GC_CLASS_SHAPE(J9GC_J9OBJECT_CLAZZ(arrayPtr, this)))) {
+				/* large primitive arrays always point to their off heap data */
+				isValidDataAddress = (dataAddr != NULL);
+			} else
+#endif /* defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION) */
+			{
+				isValidDataAddress = (dataAddr == NULL);
+			}
 		}
 
 		return isValidDataAddress;
@@ -1064,7 +1093,13 @@ public:
 		if (InlineContiguous == getPreservedArrayLayout(forwardedHeader)) {
 			setDataAddrForContiguous(j9ArrayPtr);
 		} else {
-			setDataAddrForDiscontiguous(j9ArrayPtr, NULL);
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+			/* off heap data does not move with the spine, its dataAddr was copied along with the header */
+			if (!isOffHeapDataArray(j9ArrayPtr))
+#endif /* defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION) */
+			{
+				setDataAddrForDiscontiguous(j9ArrayPtr, NULL);
+			}
 		}
 #endif /* J9VM_ENV_DATA64 */
 	}
@@ -1085,7 +1120,13 @@ public:
 		if (InlineContiguous == getArrayLayout(j9ArrayPtr)) {
 			setDataAddrForContiguous(j9ArrayPtr);
 		} else {
-			setDataAddrForDiscontiguous(j9ArrayPtr, NULL);
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+			/* off heap data does not move with the spine, its dataAddr was copied along with the header */
+			if (!isOffHeapDataArray(j9ArrayPtr))
+#endif /* defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION) */
+			{
+				setDataAddrForDiscontiguous(j9ArrayPtr, NULL);
+			}
 		}
 #endif /* J9VM_ENV_DATA64 */
 	}
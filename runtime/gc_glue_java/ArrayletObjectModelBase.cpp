@@ -36,6 +36,9 @@ GC_ArrayletObjectModelBase::initialize(MM_GCExtensionsBase * extensions)
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 	_enableDoubleMapping = false;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	_enableVirtualLargeObjectHeap = false;
+#endif /* defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION) */
 	_largestDesirableArraySpineSize = UDATA_MAX;
 #if defined(J9VM_ENV_DATA64)
 	_isIndexableDataAddrPresent = false;
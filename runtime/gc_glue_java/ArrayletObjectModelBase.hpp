@@ -44,6 +44,9 @@ private:
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 	bool _enableDoubleMapping; /** Allows arraylets to be double mapped */
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	bool _enableVirtualLargeObjectHeap; /** Allows the data of large primitive arrays to be stored off heap */
+#endif /* defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION) */
 protected:
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
 	bool _compressObjectReferences;
@@ -185,6 +188,30 @@ public:
 	}
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	/**
+	 * Sets the off heap allocation status for large primitive arrays.
+	 *
+	 * @param enableVirtualLargeObjectHeap
+	 */
+	MMINLINE void
+	setEnableVirtualLargeObjectHeap(bool enableVirtualLargeObjectHeap)
+	{
+		_enableVirtualLargeObjectHeap = enableVirtualLargeObjectHeap;
+	}
+
+	/**
+	 * Returns the off heap allocation status for large primitive arrays.
+	 *
+	 * @return true if the data of large primitive arrays is stored off heap, false otherwise.
+	 */
+	MMINLINE bool
+	isVirtualLargeObjectHeapEnabled()
+	{
+		return _enableVirtualLargeObjectHeap;
+	}
+#endif /* defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION) */
+
 	/**
 	 * Sets size in elements of a discontiguous indexable object .
 	 * @param arrayPtr Pointer to the indexable object whose size is required
@@ -185,7 +185,11 @@ MM_ConcurrentMarkingDelegate::collectJNIRoots(MM_EnvironmentBase *env, bool *com
 		if (_collector->isExclusiveAccessRequestWaitingSparseSample(env, slotNum)) {
 			goto quitTracingJNIRefs;
 		} else {
-			_markingScheme->markObject(env, *slotPtr);
+			/* Threads clear deleted slots without holding the mutex */
+			omrobjectptr_t object = *slotPtr;
+			if (NULL != object) {
+				_markingScheme->markObject(env, object);
+			}
 		}
 	}
 
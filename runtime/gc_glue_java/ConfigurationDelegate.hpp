@@ -44,6 +44,9 @@
 #include "HeapRegionIterator.hpp"
 #include "ObjectAccessBarrier.hpp"
 #include "ObjectAllocationInterface.hpp"
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+#include "OffHeapArrayTable.hpp"
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 #include "StringTable.hpp"
 
 class MM_ConfigurationDelegate
@@ -139,6 +142,13 @@ public:
 			_extensions->stringTable->kill(env);
 			_extensions->stringTable = NULL;
 		}
+
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+		if (NULL != _extensions->offHeapArrayTable) {
+			_extensions->offHeapArrayTable->kill(env);
+			_extensions->offHeapArrayTable = NULL;
+		}
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 	}
 
 	OMR_SizeClasses *getSegregatedSizeClasses(MM_EnvironmentBase *env)
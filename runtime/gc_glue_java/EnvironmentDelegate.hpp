@@ -26,6 +26,7 @@
 
 #include "objectdescription.h"
 
+#include "AllocationSizeHistogram.hpp"
 #include "MarkJavaStats.hpp"
 #include "ScavengerJavaStats.hpp"
 #include "GCExtensionsBase.hpp"
@@ -61,6 +62,7 @@ public:
 	MM_UnfinalizedObjectBuffer *_unfinalizedObjectBuffer; /**< The thread-specific buffer of recently allocated unfinalized objects */
 	MM_OwnableSynchronizerObjectBuffer *_ownableSynchronizerObjectBuffer; /**< The thread-specific buffer of recently allocated ownable synchronizer objects */
 	MM_ContinuationObjectBuffer *_continuationObjectBuffer; /**< The thread-specific buffer of recently allocated continuation objects */
+	MM_AllocationSizeHistogram _allocationSizeHistogram; /**< Sizes of the thread's out-of-line allocations, used to size its TLH */
 
 	struct GCmovedObjectHashCode movedObjectHashCodeCache; /**< Structure to aid on object movement and hashing */
 
@@ -278,19 +278,33 @@ MM_MarkingSchemeRootClearer::scanOwnableSynchronizerObjects(MM_EnvironmentBase *
 				MM_OwnableSynchronizerObjectList *list = &regionExtension->_ownableSynchronizerObjectLists[i];
 				if (!list->wasEmpty()) {
 					if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+						/* marking doesn't move objects so survivors are kept linked in place, only relinking around cleared objects */
+						omrobjectptr_t survivorHead = NULL;
+						omrobjectptr_t survivorTail = NULL;
+						bool clearedSinceTail = false;
 						omrobjectptr_t object = list->getPriorList();
 						while (NULL != object) {
 							gcEnv->_markJavaStats._ownableSynchronizerCandidates += 1;
 							omrobjectptr_t next = _extensions->accessBarrier->getOwnableSynchronizerLink(object);
 							if (_markingScheme->isMarked(object)) {
 								/* object was already marked. */
-								gcEnv->_ownableSynchronizerObjectBuffer->add(env, object);
+								if (NULL == survivorHead) {
+									survivorHead = object;
+								} else if (clearedSinceTail) {
+									_extensions->accessBarrier->setOwnableSynchronizerLink(survivorTail, object);
+								}
+								survivorTail = object;
+								clearedSinceTail = false;
 							} else {
 								/* object was not previously marked */
 								gcEnv->_markJavaStats._ownableSynchronizerCleared += 1;
+								clearedSinceTail = true;
 							}
 							object = next;
 						}
+						if (NULL != survivorHead) {
+							list->addAll(env, survivorHead, survivorTail);
+						}
 					}
 				}
 			}
@@ -325,20 +339,34 @@ MM_MarkingSchemeRootClearer::scanContinuationObjects(MM_EnvironmentBase *env)
 				MM_ContinuationObjectList *list = &regionExtension->_continuationObjectLists[i];
 				if (!list->wasEmpty()) {
 					if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+						/* marking doesn't move objects so survivors are kept linked in place, only relinking around cleared objects */
+						omrobjectptr_t survivorHead = NULL;
+						omrobjectptr_t survivorTail = NULL;
+						bool clearedSinceTail = false;
 						omrobjectptr_t object = list->getPriorList();
 						while (NULL != object) {
 							gcEnv->_markJavaStats._continuationCandidates += 1;
 							omrobjectptr_t next = _extensions->accessBarrier->getContinuationLink(object);
 							if (_markingScheme->isMarked(object) && !VM_ContinuationHelpers::isFinished(*VM_ContinuationHelpers::getContinuationStateAddress((J9VMThread *)env->getLanguageVMThread() , object))) {
 								/* object was already marked. */
-								gcEnv->_continuationObjectBuffer->add(env, object);
+								if (NULL == survivorHead) {
+									survivorHead = object;
+								} else if (clearedSinceTail) {
+									_extensions->accessBarrier->setContinuationLink(survivorTail, object);
+								}
+								survivorTail = object;
+								clearedSinceTail = false;
 							} else {
 								/* object was not previously marked */
 								gcEnv->_markJavaStats._continuationCleared += 1;
 								_extensions->releaseNativesForContinuationObject(env, object);
+								clearedSinceTail = true;
 							}
 							object = next;
 						}
+						if (NULL != survivorHead) {
+							list->addAll(env, survivorHead, survivorTail);
+						}
 					}
 				}
 			}
@@ -373,6 +401,9 @@ MM_MarkingSchemeRootClearer::doMonitorReference(J9ObjectMonitor *objectMonitor,
 		/* We must call objectMonitorDestroy (as opposed to omrthread_monitor_destroy) when the
 		 * monitor is not internal to the GC */
 		static_cast<J9JavaVM*>(_omrVM->_language_vm)->internalVMFunctions->objectMonitorDestroy(static_cast<J9JavaVM*>(_omrVM->_language_vm), (J9VMThread *)_env->getLanguageVMThread(), (omrthread_monitor_t)monitor);
+	} else if (0 != static_cast<J9JavaVM*>(_omrVM->_language_vm)->thrDeflateIdleMonitors) {
+		/* The object does not move until after clearing, so an idle inflated monitor can be deflated in place */
+		static_cast<J9JavaVM*>(_omrVM->_language_vm)->internalVMFunctions->objectMonitorDeflateIdle(static_cast<J9JavaVM*>(_omrVM->_language_vm), (J9VMThread *)_env->getLanguageVMThread(), objectMonitor);
 	}
 }
 
@@ -377,6 +377,25 @@ public:
 		return size;
 	}
 
+	/**
+	 * Returns the hot field information of the class of the object referred to by the forwarded header, unless
+	 * the class has chosen to have its objects copied breadth first.
+	 * Valid if scavenger dynamicBreadthFirstScanOrdering is enabled.
+	 *
+	 * @param forwardedHeader pointer to the MM_ForwardedHeader instance encapsulating the object
+	 * @return the hot field information to depth copy the object with, or NULL
+	 */
+	MMINLINE J9ClassHotFieldsInfo *
+	getDepthCopyHotFieldsInfo(MM_ForwardedHeader *forwardedHeader)
+	{
+		J9Class* hotClass = ((J9Class *)(((uintptr_t)(forwardedHeader->getPreservedSlot())) & ~(UDATA)_delegateHeaderSlotFlagsMask));
+		J9ClassHotFieldsInfo *hotFieldsInfo = hotClass->hotFieldsInfo;
+		if ((NULL != hotFieldsInfo) && (0 == hotFieldsInfo->hotFieldCopyDepth)) {
+			hotFieldsInfo = NULL;
+		}
+		return hotFieldsInfo;
+	}
+
 	/**
 	 * Returns the field offset of the hottest field of the object referred to by the forwarded header.
 	 * Valid if scavenger dynamicBreadthFirstScanOrdering is enabled.
@@ -387,9 +406,9 @@ public:
 	MMINLINE uint8_t
 	getHotFieldOffset(MM_ForwardedHeader *forwardedHeader)
 	{
-		J9Class* hotClass = ((J9Class *)(((uintptr_t)(forwardedHeader->getPreservedSlot())) & ~(UDATA)_delegateHeaderSlotFlagsMask));
-		if (hotClass->hotFieldsInfo != NULL) {
-			return hotClass->hotFieldsInfo->hotFieldOffset1;
+		J9ClassHotFieldsInfo *hotFieldsInfo = getDepthCopyHotFieldsInfo(forwardedHeader);
+		if (NULL != hotFieldsInfo) {
+			return hotFieldsInfo->hotFieldOffset1;
 		}
 		
 		return U_8_MAX;
@@ -405,9 +424,9 @@ public:
 	MMINLINE uint8_t
 	getHotFieldOffset2(MM_ForwardedHeader *forwardedHeader)
 	{
-		J9Class* hotClass = ((J9Class *)(((uintptr_t)(forwardedHeader->getPreservedSlot())) & ~(UDATA)_delegateHeaderSlotFlagsMask));
-		if (hotClass->hotFieldsInfo != NULL) {
-			return hotClass->hotFieldsInfo->hotFieldOffset2;
+		J9ClassHotFieldsInfo *hotFieldsInfo = getDepthCopyHotFieldsInfo(forwardedHeader);
+		if (NULL != hotFieldsInfo) {
+			return hotFieldsInfo->hotFieldOffset2;
 		}
 		
 		return U_8_MAX;	
@@ -423,9 +442,9 @@ public:
 	MMINLINE uint8_t
 	getHotFieldOffset3(MM_ForwardedHeader *forwardedHeader)
 	{
-		J9Class* hotClass = ((J9Class *)(((uintptr_t)(forwardedHeader->getPreservedSlot())) & ~(UDATA)_delegateHeaderSlotFlagsMask));
-		if (hotClass->hotFieldsInfo != NULL) {
-			return hotClass->hotFieldsInfo->hotFieldOffset3;
+		J9ClassHotFieldsInfo *hotFieldsInfo = getDepthCopyHotFieldsInfo(forwardedHeader);
+		if (NULL != hotFieldsInfo) {
+			return hotFieldsInfo->hotFieldOffset3;
 		}
 		
 		return U_8_MAX;	
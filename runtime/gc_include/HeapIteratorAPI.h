@@ -263,6 +263,63 @@ j9mm_initialize_object_descriptor(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor
 jvmtiIterationControl
 j9mm_iterate_all_objects(J9JavaVM *vn, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData), void *userData);
 
+/**
+ * Walk all objects for the given VM on the GC worker threads, call user provided function.
+ * Regions are distributed as work units: each region is walked in address order by a single worker,
+ * but different regions are walked concurrently, so func must only touch state private to workerID
+ * (or synchronize). Objects are not delivered in any particular global order.
+ *
+ * The caller must have exclusive VM access. If j9mm_is_parallel_walk_possible is false the objects are
+ * walked serially on the calling thread, as worker 0.
+ *
+ * @param vmThread The calling thread; it participates in the walk as worker 0
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each object descriptor. workerID is in [0, j9mm_get_parallel_walk_thread_count()).
+ * @param userData Pointer to storage for userData, shared by all workers.
+ * @return JVMTI_ITERATION_ABORT if func aborted on any worker (remaining regions are skipped), JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_iterate_all_objects_parallel(J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData), void *userData);
+
+/**
+ * Walk all regions of the default memory space on the GC worker threads, call user provided function.
+ * Regions are handed out as work units in the same order j9mm_iterate_regions reports them, so a
+ * worker never claims a region before all earlier regions have been claimed. func is free to walk
+ * the region (e.g. with j9mm_iterate_region_objects) but, as for j9mm_iterate_all_objects_parallel,
+ * must only touch state private to workerID (or synchronize).
+ *
+ * The caller must have exclusive VM access. If j9mm_is_parallel_walk_possible is false the regions are
+ * walked serially on the calling thread, as worker 0.
+ *
+ * @param vmThread The calling thread; it participates in the walk as worker 0
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_regions_read_only)
+ * @param func The function to call on each region descriptor. workerID is in [0, j9mm_get_parallel_walk_thread_count()).
+ * @param userData Pointer to storage for userData, shared by all workers.
+ * @return JVMTI_ITERATION_ABORT if func aborted on any worker (remaining regions are skipped), JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_iterate_regions_parallel(J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateRegionDescriptor *regionDesc, UDATA workerID, void *userData), void *userData);
+
+/**
+ * Return the number of workers j9mm_iterate_all_objects_parallel and j9mm_iterate_regions_parallel may use, i.e. the bound on the workerID
+ * passed to its callback. Callers use it to size per-worker state.
+ */
+UDATA
+j9mm_get_parallel_walk_thread_count(J9JavaVM *vm);
+
+/**
+ * Answer whether j9mm_iterate_all_objects_parallel and j9mm_iterate_regions_parallel can hand the walk to
+ * the GC worker threads. This is not the case while a concurrent GC phase (concurrent scavenge, concurrent
+ * global mark or sweep) is in progress, since it owns the dispatcher and the heap may be in an intermediate state.
+ *
+ * The caller must have exclusive VM access.
+ *
+ * @param vmThread The calling thread
+ * @return TRUE if the walk can run on the GC worker threads, FALSE if it would be done serially
+ */
+BOOLEAN
+j9mm_is_parallel_walk_possible(J9VMThread *vmThread);
+
 /**
  * Walk all ownable synchronizer object, call user provided function.
  * @param flags The flags describing the walk (unused currently)
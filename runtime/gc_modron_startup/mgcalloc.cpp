@@ -37,10 +37,12 @@
 #include "rommeth.h"
 
 #include "AllocateDescription.hpp"
+#include "AllocationSizeHistogram.hpp"
 #include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "GlobalCollector.hpp"
 #include "IndexableObjectAllocationModel.hpp"
+#include "Math.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "MixedObjectAllocationModel.hpp"
@@ -62,6 +64,9 @@ static void dumpStackFrames(J9VMThread *currentThread);
 static void traceAllocateIndexableObject(J9VMThread *vmThread, J9Class* clazz, uintptr_t objSize, uintptr_t numberOfIndexedFields);
 static J9Object * traceAllocateObject(J9VMThread *vmThread, J9Object * object, J9Class* clazz, uintptr_t objSize, uintptr_t numberOfIndexedFields=0);
 static bool traceObjectCheck(J9VMThread *vmThread, bool *shouldTriggerAllocationSampling = NULL);
+#if defined(J9VM_GC_THREAD_LOCAL_HEAP)
+static void sampleAllocationSize(MM_EnvironmentBase *env, J9VMThread *vmThread, uintptr_t sizeInBytes, bool completedFromTlh, uintptr_t allocateFlags);
+#endif /* J9VM_GC_THREAD_LOCAL_HEAP */
 
 #define STACK_FRAMES_TO_DUMP	8
 
@@ -120,6 +125,9 @@ J9AllocateObjectNoGC(J9VMThread *vmThread, J9Class *clazz, uintptr_t allocateFla
 				Assert_GC_true_with_message4(env, allocatedBytes == actuallyAllocatedBytes,
 						"Mixed object allocation sanity failure: object %p, requested %zu bytes, but read %zu, MM_MixedObjectAllocationModel %p\n",
 						objectPtr, allocatedBytes, actuallyAllocatedBytes, &mixedOAM);
+#if defined(J9VM_GC_THREAD_LOCAL_HEAP)
+				sampleAllocationSize(env, vmThread, allocatedBytes, mixedOAM.getAllocateDescription()->isCompletedFromTlh(), allocateFlags);
+#endif /* J9VM_GC_THREAD_LOCAL_HEAP */
 
 				if (LN_HAS_LOCKWORD(vmThread, objectPtr)) {
 					j9objectmonitor_t initialLockword = VM_ObjectMonitor::getInitialLockword(vmThread->javaVM, clazz);
@@ -292,6 +300,66 @@ traceAllocateObject(J9VMThread *vmThread, J9Object * object, J9Class* clazz, uin
  *
  * Returns true if we should trace the object
  *  */
+#if defined(J9VM_GC_THREAD_LOCAL_HEAP)
+/**
+ * Record an out-of-line allocation in the allocation size histogram of the thread and periodically
+ * apply the TLH size class policy: the TLH is only refreshed for requests of up to half of the refresh size,
+ * larger requests are allocated outside of the TLH and only grow the refresh size by tlhIncrementSize.
+ * If a size class frequently misses the TLH, raise the refresh size straight to one that can hold it.
+ * Nothing is recorded unless the policy (-Xgc:enableTLHSizeClassPolicy) or -Xtgc:allocation is enabled.
+ *
+ * @param env the allocating thread
+ * @param vmThread the allocating thread
+ * @param sizeInBytes size of the allocation
+ * @param completedFromTlh true if the allocation was satisfied from the TLH
+ * @param allocateFlags the allocation flags, selecting the TLH
+ */
+static void
+sampleAllocationSize(MM_EnvironmentBase *env, J9VMThread *vmThread, uintptr_t sizeInBytes, bool completedFromTlh, uintptr_t allocateFlags)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	if (!extensions->tlhSizeClassPolicy && !extensions->allocationSizeSampling) {
+		return;
+	}
+
+	MM_AllocationSizeHistogram *histogram = &env->getGCEnvironment()->_allocationSizeHistogram;
+	histogram->record(sizeInBytes, completedFromTlh);
+
+	if (extensions->tlhSizeClassPolicy && (histogram->_recentSampleCount >= extensions->tlhSizeClassPolicyInterval)) {
+		uintptr_t missThreshold = (histogram->_recentSampleCount * extensions->tlhSizeClassPolicyMissPercentage) / 100;
+		uintptr_t desiredRefreshSize = 0;
+
+		/* pick the largest size class which misses often enough and still fits in half of the largest TLH */
+		for (uintptr_t sizeClass = 0; sizeClass < ALLOCATION_HISTOGRAM_SIZE_CLASSES; sizeClass++) {
+			uintptr_t refreshSize = 2 * MM_AllocationSizeHistogram::getSizeClassLimit(sizeClass);
+			if (refreshSize > extensions->tlhMaximumSize) {
+				break;
+			}
+			if ((0 != histogram->_recentNonTLHCounts[sizeClass]) && (histogram->_recentNonTLHCounts[sizeClass] >= missThreshold)) {
+				desiredRefreshSize = refreshSize;
+			}
+		}
+
+		if (0 != desiredRefreshSize) {
+			J9ModronThreadLocalHeap *tlh = &vmThread->allocateThreadLocalHeap;
+#if defined(J9VM_GC_NON_ZERO_TLH)
+			if (OMR_GC_ALLOCATE_OBJECT_NON_ZERO_TLH == (allocateFlags & OMR_GC_ALLOCATE_OBJECT_NON_ZERO_TLH)) {
+				tlh = &vmThread->nonZeroAllocateThreadLocalHeap;
+			}
+#endif /* defined(J9VM_GC_NON_ZERO_TLH) */
+			desiredRefreshSize = MM_Math::roundToCeiling(extensions->tlhIncrementSize, desiredRefreshSize);
+			desiredRefreshSize = OMR_MIN(desiredRefreshSize, extensions->tlhMaximumSize);
+			if (tlh->refreshSize < desiredRefreshSize) {
+				tlh->refreshSize = desiredRefreshSize;
+				histogram->_tlhRefreshAdjustments += 1;
+			}
+		}
+
+		histogram->decay();
+	}
+}
+#endif /* J9VM_GC_THREAD_LOCAL_HEAP */
+
 static bool
 traceObjectCheck(J9VMThread *vmThread, bool *shouldTriggerAllocationSampling)
 {
@@ -367,6 +435,9 @@ J9AllocateIndexableObjectNoGC(J9VMThread *vmThread, J9Class *clazz, uint32_t num
 				Assert_GC_true_with_message4(env, allocatedBytes == actuallyAllocatedBytes,
 						"Indexable object allocation sanity failure: object %p, requested %zu bytes, but read %zu, MM_IndexableObjectAllocationModel %p\n",
 						objectPtr, allocatedBytes, actuallyAllocatedBytes, &indexableOAM);
+#if defined(J9VM_GC_THREAD_LOCAL_HEAP)
+				sampleAllocationSize(env, vmThread, allocatedBytes, indexableOAM.getAllocateDescription()->isCompletedFromTlh(), allocateFlags);
+#endif /* J9VM_GC_THREAD_LOCAL_HEAP */
 			}
 			env->_isInNoGCAllocationCall = false;
 		}
@@ -433,6 +504,9 @@ J9AllocateObject(J9VMThread *vmThread, J9Class *clazz, uintptr_t allocateFlags)
 			Assert_GC_true_with_message4(env, allocatedBytes == actuallyAllocatedBytes,
 					"Mixed object allocation sanity failure: object %p, requested %zu bytes, but read %zu, MM_MixedObjectAllocationModel %p\n",
 					objectPtr, allocatedBytes, actuallyAllocatedBytes, &mixedOAM);
+#if defined(J9VM_GC_THREAD_LOCAL_HEAP)
+			sampleAllocationSize(env, vmThread, allocatedBytes, mixedOAM.getAllocateDescription()->isCompletedFromTlh(), allocateFlags);
+#endif /* J9VM_GC_THREAD_LOCAL_HEAP */
 
 			if (LN_HAS_LOCKWORD(vmThread, objectPtr)) {
 				j9objectmonitor_t initialLockword = VM_ObjectMonitor::getInitialLockword(vmThread->javaVM, clazz);
@@ -601,8 +675,15 @@ J9AllocateIndexableObject(J9VMThread *vmThread, J9Class *clazz, uint32_t numberO
 			Assert_GC_true_with_message4(env, allocatedBytes == actuallyAllocatedBytes,
 					"Indexable object allocation sanity failure: object %p, requested %zu bytes, but read %zu, MM_IndexableObjectAllocationModel %p\n",
 					objectPtr, allocatedBytes, actuallyAllocatedBytes, &indexableOAM);
+#if defined(J9VM_GC_THREAD_LOCAL_HEAP)
+			sampleAllocationSize(env, vmThread, allocatedBytes, indexableOAM.getAllocateDescription()->isCompletedFromTlh(), allocateFlags);
+#endif /* J9VM_GC_THREAD_LOCAL_HEAP */
 		}
 	}
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	/* off heap data is reserved ahead of the spine; release it if the spine could not be allocated */
+	indexableOAM.releaseUnusedOffHeapData(env);
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 	
 	if (env->_failAllocOnExcessiveGC && (NULL != objectPtr)) {
 		/* If we have garbage collected too much, return NULL as if we had failed to allocate the object (effectively triggering an OOM).
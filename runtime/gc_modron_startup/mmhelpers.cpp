@@ -165,19 +165,20 @@ j9gc_hot_reference_field_required(J9JavaVM *javaVM)
 }
 
 /**
- * Query if off heap allocation for large objects is enabled.
+ * Query if the JIT should access array data through the contiguous off heap dataAddr.
+ *
+ * Off heap arrays (-Xgc:enableVirtualLargeObjectHeap) keep the discontiguous arraylet layout, with
+ * the arrayoid pointing into the off heap data, so compiled code reaches their elements through the
+ * existing arraylet paths. The JIT off heap paths instead load dataAddr from the contiguous header
+ * of every array, which does not match this layout, so they are never enabled.
  *
  * @param javaVM pointer to J9JavaVM
- * @return true if extensions flag isVirtualLargeObjectHeapEnabled is set, 0 otherwise
+ * @return FALSE
  */
 BOOLEAN
 j9gc_off_heap_allocation_enabled(J9JavaVM *javaVM)
 {
-#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
-	return MM_GCExtensions::getExtensions(javaVM)->isVirtualLargeObjectHeapEnabled;
-#else /* defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION) */
 	return FALSE;
-#endif /* defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION) */
 }
 
 /**
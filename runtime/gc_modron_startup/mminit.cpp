@@ -101,6 +101,9 @@
 #if defined(J9VM_GC_REALTIME)
 #include "RememberedSetSATB.hpp"
 #endif /* J9VM_GC_REALTIME */
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+#include "OffHeapArrayTable.hpp"
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 #include "Scavenger.hpp"
 #include "StringTable.hpp"
 #include "Validator.hpp"
@@ -508,6 +511,15 @@ j9gc_initialize_heap(J9JavaVM *vm, IDATA *memoryParameterTable, UDATA heapBytesR
 		goto error_no_memory;
 	}
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	if (extensions->isVirtualLargeObjectHeapEnabled) {
+		extensions->offHeapArrayTable = MM_OffHeapArrayTable::newInstance(&env);
+		if (NULL == extensions->offHeapArrayTable) {
+			goto error_no_memory;
+		}
+	}
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+
 	/* Initialize statistic locks */
 	if (omrthread_monitor_init_with_name(&extensions->gcStatsMutex, 0, "MM_GCExtensions::gcStats")) {
 		vm->internalVMFunctions->setErrorJ9dll(
@@ -1898,6 +1898,16 @@ gcParseCommandLineAndInitializeWithValues(J9JavaVM *vm, IDATA *memoryParameters)
 		xxGCColonIndex = FIND_NEXT_ARG_IN_VMARGS_FORWARD( STARTSWITH_MATCH, OPT_XXGC_COLON, NULL, xxGCColonIndex);
 	}
 
+#if defined(J9VM_GC_MODRON_SCAVENGER) || defined(J9VM_GC_VLHGC)
+	/* The dominance thresholds may be given in any order (or in separate -XXgc: options), so they are only
+	 * validated against each other once all of them have been parsed.
+	 */
+	if (extensions->hotFieldBreadthFirstDominance >= extensions->hotFieldDepthFirstDominance) {
+		j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "dbfHotFieldBreadthFirstDominance=", (UDATA)0, extensions->hotFieldDepthFirstDominance - 1);
+		return JNI_EINVAL;
+	}
+#endif /* defined(J9VM_GC_MODRON_SCAVENGER) || defined(J9VM_GC_VLHGC) */
+
 	xGCColonIndex = FIND_ARG_IN_VMARGS_FORWARD( STARTSWITH_MATCH, OPT_XGC_COLON, NULL );
 	while (xGCColonIndex >= 0) {
 		CONSUME_ARG(vmArgs, xGCColonIndex);
@@ -374,6 +374,33 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->tarokPGCShouldCopyForward = false;
 			continue;
 		}
+#if defined(J9VM_GC_VLHGC)
+		if (try_scan(&scan_start, "tarokPGCPauseGoal=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokPGCPauseGoal, "tarokPGCPauseGoal=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+		if (try_scan(&scan_start, "tarokEnableConcurrentClassUnloadCleanup")) {
+			extensions->tarokConcurrentClassUnloadCleanup = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableConcurrentClassUnloadCleanup")) {
+			extensions->tarokConcurrentClassUnloadCleanup = false;
+			continue;
+		}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+		if (try_scan(&scan_start, "tarokEnableConcurrentGlobalSweep")) {
+			extensions->tarokConcurrentGlobalSweep = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableConcurrentGlobalSweep")) {
+			extensions->tarokConcurrentGlobalSweep = false;
+			continue;
+		}
+#endif /* J9VM_GC_VLHGC */
 		if (try_scan(&scan_start, "tarokEnableDynamicCollectionSetSelection")) {
 			extensions->tarokEnableDynamicCollectionSetSelection = true;
 			continue;
@@ -855,6 +882,46 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->minCpuUtil = value;
 			continue;
 		}
+
+		if(try_scan(&scan_start, "dbfEnableAdaptiveHotFieldCopyDepth")) {
+			extensions->adaptiveHotFieldCopyDepth = true;
+			continue;
+		}
+
+		if(try_scan(&scan_start, "dbfDisableAdaptiveHotFieldCopyDepth")) {
+			extensions->adaptiveHotFieldCopyDepth = false;
+			continue;
+		}
+
+		if(try_scan(&scan_start, "dbfHotFieldDepthFirstDominance=")) {
+			UDATA value;
+			if(!scan_udata_helper(vm, &scan_start, &value, "dbfHotFieldDepthFirstDominance=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(value > 100) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "dbfHotFieldDepthFirstDominance=", (UDATA)1, (UDATA)100);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			extensions->hotFieldDepthFirstDominance = value;
+			continue;
+		}
+
+		if(try_scan(&scan_start, "dbfHotFieldBreadthFirstDominance=")) {
+			UDATA value;
+			if(!scan_udata_helper(vm, &scan_start, &value, "dbfHotFieldBreadthFirstDominance=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(value > 99) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "dbfHotFieldBreadthFirstDominance=", (UDATA)0, (UDATA)99);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			extensions->hotFieldBreadthFirstDominance = value;
+			continue;
+		}
 #endif /* defined(J9VM_GC_MODRON_SCAVENGER) || defined (J9VM_GC_VLHGC) */
 /* End of options relating to dynamicBreadthFirstScanOrdering */
 
@@ -93,6 +93,34 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 		}
 		goto _exit;
 	}
+	if(try_scan(scan_start, "tlhSizeClassPolicyInterval=")) {
+		if(!scan_udata_helper(javaVM, scan_start, &extensions->tlhSizeClassPolicyInterval, "tlhSizeClassPolicyInterval=")) {
+			goto _error;
+		}
+		if(0 == extensions->tlhSizeClassPolicyInterval) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "-Xgc:tlhSizeClassPolicyInterval=", (UDATA)0);
+			goto _error;
+		}
+		goto _exit;
+	}
+	if(try_scan(scan_start, "tlhSizeClassPolicyMissPercentage=")) {
+		if(!scan_udata_helper(javaVM, scan_start, &extensions->tlhSizeClassPolicyMissPercentage, "tlhSizeClassPolicyMissPercentage=")) {
+			goto _error;
+		}
+		if(100 < extensions->tlhSizeClassPolicyMissPercentage) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "-Xgc:tlhSizeClassPolicyMissPercentage=", (UDATA)0, (UDATA)100);
+			goto _error;
+		}
+		goto _exit;
+	}
+	if(try_scan(scan_start, "enableTLHSizeClassPolicy")) {
+		extensions->tlhSizeClassPolicy = true;
+		goto _exit;
+	}
+	if(try_scan(scan_start, "disableTLHSizeClassPolicy")) {
+		extensions->tlhSizeClassPolicy = false;
+		goto _exit;
+	}
 
 #endif /* defined(J9VM_GC_THREAD_LOCAL_HEAP) */
 #if defined(J9VM_GC_SEGREGATED_HEAP)
@@ -1288,6 +1316,13 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "finalizeCycleLimit=")) {
+			if(!scan_udata_helper(vm, &scan_start, (UDATA *)&extensions->finalizeCycleLimit, "finalizeCycleLimit=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 		if (try_scan(&scan_start, "finalizeMainPriority=")) {
 			if(!scan_udata_helper(vm, &scan_start, &extensions->finalizeMainPriority, "finalizeMainPriority=")) {
 				returnValue = JNI_EINVAL;
@@ -1312,6 +1347,42 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "finalizeWorkerThreads=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->finalizeMaxWorkerThreads, "finalizeWorkerThreads=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(0 == extensions->finalizeMaxWorkerThreads) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "-Xgc:finalizeWorkerThreads=", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "finalizeBacklogPerWorker=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->finalizeBacklogPerWorker, "finalizeBacklogPerWorker=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(0 == extensions->finalizeBacklogPerWorker) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "-Xgc:finalizeBacklogPerWorker=", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "finalizeBatchSize=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->finalizeBatchSize, "finalizeBatchSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(0 == extensions->finalizeBatchSize) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "-Xgc:finalizeBatchSize=", (UDATA)0);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* J9VM_GC_FINALIZATION */
 
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
@@ -1484,6 +1555,18 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 #endif /* defined(J9VM_GC_ENABLE_DOUBLE_MAP) */
 			continue;
 		}
+		if (try_scan(&scan_start, "enableVirtualLargeObjectHeap")) {
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+			extensions->isVirtualLargeObjectHeapRequested = true;
+#endif /* defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION) */
+			continue;
+		}
+		if (try_scan(&scan_start, "disableVirtualLargeObjectHeap")) {
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+			extensions->isVirtualLargeObjectHeapRequested = false;
+#endif /* defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION) */
+			continue;
+		}
 
 #if defined (J9VM_GC_VLHGC)
 		if (try_scan(&scan_start, "fvtest_tarokForceNUMANode=")) {
@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "j9port.h"
+#include "modronopt.h"
+
+#include "AllocationSizeHistogram.hpp"
+
+void
+MM_AllocationSizeHistogram::clear()
+{
+	clearIntervalCounts();
+	_recentSampleCount = 0;
+	for (uintptr_t i = 0; i < ALLOCATION_HISTOGRAM_SIZE_CLASSES; i++) {
+		_recentNonTLHCounts[i] = 0;
+	}
+}
+
+void
+MM_AllocationSizeHistogram::clearIntervalCounts()
+{
+	_sampleCount = 0;
+	_sampledBytes = 0;
+	_nonTLHCount = 0;
+	_tlhRefreshAdjustments = 0;
+	for (uintptr_t i = 0; i < ALLOCATION_HISTOGRAM_SIZE_CLASSES; i++) {
+		_counts[i] = 0;
+		_nonTLHCounts[i] = 0;
+	}
+}
+
+void
+MM_AllocationSizeHistogram::merge(MM_AllocationSizeHistogram *statsToMerge)
+{
+	_sampleCount += statsToMerge->_sampleCount;
+	_sampledBytes += statsToMerge->_sampledBytes;
+	_nonTLHCount += statsToMerge->_nonTLHCount;
+	_tlhRefreshAdjustments += statsToMerge->_tlhRefreshAdjustments;
+	for (uintptr_t i = 0; i < ALLOCATION_HISTOGRAM_SIZE_CLASSES; i++) {
+		_counts[i] += statsToMerge->_counts[i];
+		_nonTLHCounts[i] += statsToMerge->_nonTLHCounts[i];
+	}
+}
+
+void
+MM_AllocationSizeHistogram::decay()
+{
+	_recentSampleCount = 0;
+	for (uintptr_t i = 0; i < ALLOCATION_HISTOGRAM_SIZE_CLASSES; i++) {
+		_recentNonTLHCounts[i] >>= 1;
+	}
+}
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(ALLOCATIONSIZEHISTOGRAM_HPP_)
+#define ALLOCATIONSIZEHISTOGRAM_HPP_
+
+#include "j9port.h"
+#include "modronopt.h"
+
+#include "Base.hpp"
+
+/* Size classes are powers of two, the first class holding everything smaller than 2^ALLOCATION_HISTOGRAM_MIN_SHIFT bytes
+ * and the last class holding everything of 2^(ALLOCATION_HISTOGRAM_MIN_SHIFT + ALLOCATION_HISTOGRAM_SIZE_CLASSES - 2) bytes or larger.
+ */
+#define ALLOCATION_HISTOGRAM_SIZE_CLASSES 16
+#define ALLOCATION_HISTOGRAM_MIN_SHIFT 5
+
+/**
+ * Histogram of allocation sizes sampled on the out-of-line allocation path of a thread, recording
+ * which size classes could not be satisfied from the thread local heap.
+ * @ingroup GC_Stats
+ */
+class MM_AllocationSizeHistogram : public MM_Base {
+	/* data members */
+private:
+protected:
+public:
+	uintptr_t _sampleCount; /**< number of out-of-line allocations sampled */
+	uintptr_t _sampledBytes; /**< bytes requested by the sampled allocations */
+	uintptr_t _nonTLHCount; /**< number of sampled allocations which were not satisfied from a TLH */
+	uintptr_t _tlhRefreshAdjustments; /**< number of times the TLH refresh size was raised based on this histogram */
+	uintptr_t _counts[ALLOCATION_HISTOGRAM_SIZE_CLASSES]; /**< sampled allocations per size class */
+	uintptr_t _nonTLHCounts[ALLOCATION_HISTOGRAM_SIZE_CLASSES]; /**< sampled allocations per size class which were not satisfied from a TLH */
+
+	uintptr_t _recentSampleCount; /**< allocations sampled since the TLH refresh policy was last applied */
+	uintptr_t _recentNonTLHCounts[ALLOCATION_HISTOGRAM_SIZE_CLASSES]; /**< decaying per size class count of allocations not satisfied from a TLH, used by the TLH refresh policy */
+
+	/* function members */
+private:
+protected:
+public:
+	void clear();
+	void merge(MM_AllocationSizeHistogram *statsToMerge);
+
+	/**
+	 * Clear the counts accumulated since the last report, leaving the decaying counts used by the TLH refresh policy intact.
+	 */
+	void clearIntervalCounts();
+
+	/**
+	 * Halve the counts used by the TLH refresh policy so that they track the recent allocation behaviour of the thread.
+	 */
+	void decay();
+
+	/**
+	 * @param size the allocation size in bytes
+	 * @return the size class of an allocation of the given size
+	 */
+	static MMINLINE uintptr_t
+	getSizeClass(uintptr_t size)
+	{
+		uintptr_t sizeClass = 0;
+		size >>= ALLOCATION_HISTOGRAM_MIN_SHIFT;
+		while ((0 != size) && (sizeClass < (ALLOCATION_HISTOGRAM_SIZE_CLASSES - 1))) {
+			size >>= 1;
+			sizeClass += 1;
+		}
+		return sizeClass;
+	}
+
+	/**
+	 * @param sizeClass a size class
+	 * @return the exclusive upper bound, in bytes, of the allocation sizes in the size class
+	 */
+	static MMINLINE uintptr_t
+	getSizeClassLimit(uintptr_t sizeClass)
+	{
+		return (uintptr_t)1 << (sizeClass + ALLOCATION_HISTOGRAM_MIN_SHIFT);
+	}
+
+	/**
+	 * Record a sampled allocation.
+	 * @param size the allocation size in bytes
+	 * @param completedFromTLH true if the allocation was satisfied from a TLH
+	 */
+	MMINLINE void
+	record(uintptr_t size, bool completedFromTLH)
+	{
+		uintptr_t sizeClass = getSizeClass(size);
+		_sampleCount += 1;
+		_sampledBytes += size;
+		_counts[sizeClass] += 1;
+		_recentSampleCount += 1;
+		if (!completedFromTLH) {
+			_nonTLHCount += 1;
+			_nonTLHCounts[sizeClass] += 1;
+			_recentNonTLHCounts[sizeClass] += 1;
+		}
+	}
+
+	MM_AllocationSizeHistogram() :
+		MM_Base()
+	{
+		clear();
+	}
+};
+
+#endif /* ALLOCATIONSIZEHISTOGRAM_HPP_ */
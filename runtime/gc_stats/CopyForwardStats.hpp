@@ -74,6 +74,10 @@ public:
 	uintptr_t _doubleMappedArrayletsCleared; /**< The number of double mapped arraylets that have been cleared durign marking */
 	uintptr_t _doubleMappedArrayletsCandidates; /**< The number of double mapped arraylets that have been visited during marking */
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	uintptr_t _offHeapArraysCleared; /**< The number of off heap arrays whose data has been released during copy forward */
+	uintptr_t _offHeapArraysCandidates; /**< The number of off heap arrays that have been visited during copy forward */
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 
 	uint64_t _cycleStartTime; /**< The start time of a copy forward cycle */
 
@@ -111,6 +115,10 @@ public:
 		_doubleMappedArrayletsCleared = 0;
 		_doubleMappedArrayletsCandidates = 0;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+		_offHeapArraysCleared = 0;
+		_offHeapArraysCandidates = 0;
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 	}
 	
 	/**
@@ -140,6 +148,10 @@ public:
 		_doubleMappedArrayletsCleared += stats->_doubleMappedArrayletsCleared;
 		_doubleMappedArrayletsCandidates += stats->_doubleMappedArrayletsCandidates;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+		_offHeapArraysCleared += stats->_offHeapArraysCleared;
+		_offHeapArraysCandidates += stats->_offHeapArraysCandidates;
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 	}
 
 	MM_CopyForwardStats() :
@@ -161,6 +173,10 @@ public:
 		, _doubleMappedArrayletsCleared(0)
 		, _doubleMappedArrayletsCandidates(0)
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+		, _offHeapArraysCleared(0)
+		, _offHeapArraysCandidates(0)
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 	{}
 };
 
@@ -78,6 +78,10 @@ public:
 	uintptr_t _doubleMappedArrayletsCleared; /**< The number of double mapped arraylets that have been cleared durign marking */
 	uintptr_t _doubleMappedArrayletsCandidates; /**< The number of double mapped arraylets that have been visited during marking */
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */	
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	uintptr_t _offHeapArraysCleared; /**< The number of off heap arrays whose data has been released during marking */
+	uintptr_t _offHeapArraysCandidates; /**< The number of off heap arrays that have been visited during marking */
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t _splitArraysProcessed; /**< The number of array chunks (not counting parts smaller than the split size) processed by this thread */
@@ -118,6 +122,10 @@ public:
 		_doubleMappedArrayletsCleared = 0;
 		_doubleMappedArrayletsCandidates = 0;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */	
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+		_offHeapArraysCleared = 0;
+		_offHeapArraysCandidates = 0;
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		_splitArraysProcessed = 0;
@@ -156,6 +164,10 @@ public:
 		_doubleMappedArrayletsCleared += statsToMerge->_doubleMappedArrayletsCleared;
 		_doubleMappedArrayletsCandidates += statsToMerge->_doubleMappedArrayletsCandidates;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */	
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+		_offHeapArraysCleared += statsToMerge->_offHeapArraysCleared;
+		_offHeapArraysCandidates += statsToMerge->_offHeapArraysCandidates;
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 
 		_concurrentGCThreadsCPUStartTimeSum += statsToMerge->_concurrentGCThreadsCPUStartTimeSum;
 		_concurrentGCThreadsCPUEndTimeSum += statsToMerge->_concurrentGCThreadsCPUEndTimeSum;
@@ -187,6 +199,10 @@ public:
 		,_doubleMappedArrayletsCleared(0)
 		,_doubleMappedArrayletsCandidates(0)
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+		,_offHeapArraysCleared(0)
+		,_offHeapArraysCandidates(0)
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		,_splitArraysProcessed(0)
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
@@ -26,6 +26,7 @@
 #include "modronopt.h"
 #include "mmhook.h"
 
+#include "AllocationSizeHistogram.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 #include "VMThreadListIterator.hpp"
@@ -34,6 +35,61 @@
 #include "TgcAllocation.hpp"
 #include "HeapStats.hpp"
 
+#if defined(J9VM_GC_THREAD_LOCAL_HEAP)
+/**
+ * Report the out-of-line allocation size histograms of all threads since the previous report, along with the
+ * rate of out-of-line allocations per MB allocated for this and the previous interval.
+ */
+static void
+tgcAllocationPrintSizeHistogram(OMR_VMThread* omrVMThread, UDATA bytesAllocated)
+{
+	J9JavaVM *javaVM = (J9JavaVM *)omrVMThread->_vm->_language_vm;
+	MM_GCExtensions *ext = MM_GCExtensions::getExtensions(omrVMThread);
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(ext);
+	TgcAllocationExtensions *allocationExtensions = &tgcExtensions->_allocation;
+	MM_AllocationSizeHistogram histogram;
+
+	GC_VMThreadListIterator vmThreadListIterator(javaVM);
+	J9VMThread *walkThread = NULL;
+	while (NULL != (walkThread = vmThreadListIterator.nextVMThread())) {
+		MM_EnvironmentBase *walkEnv = MM_EnvironmentBase::getEnvironment(walkThread->omrVMThread);
+		MM_AllocationSizeHistogram *threadHistogram = &walkEnv->getGCEnvironment()->_allocationSizeHistogram;
+		histogram.merge(threadHistogram);
+		threadHistogram->clearIntervalCounts();
+	}
+
+	UDATA previousRate = 0;
+	if (0 != allocationExtensions->previousBytesAllocated) {
+		previousRate = (allocationExtensions->previousSlowPathCount * 1024 * 1024) / allocationExtensions->previousBytesAllocated;
+	}
+	UDATA currentRate = 0;
+	if (0 != bytesAllocated) {
+		currentRate = (histogram._sampleCount * 1024 * 1024) / bytesAllocated;
+	}
+
+	tgcExtensions->printf("Slow Path Allocations:         %12zu\n", histogram._sampleCount);
+	tgcExtensions->printf("Slow Path Non-TLH Allocations: %12zu\n", histogram._nonTLHCount);
+	tgcExtensions->printf("Slow Path Rate (per MB):       %12zu (previous %zu)\n", currentRate, previousRate);
+	tgcExtensions->printf("TLH Refresh Size Adjustments:  %12zu\n", histogram._tlhRefreshAdjustments);
+	if (0 != histogram._sampleCount) {
+		tgcExtensions->printf("  Size Class      Slow Path      Non-TLH\n");
+		for (UDATA sizeClass = 0; sizeClass < ALLOCATION_HISTOGRAM_SIZE_CLASSES; sizeClass++) {
+			if (0 != histogram._counts[sizeClass]) {
+				if (sizeClass < (ALLOCATION_HISTOGRAM_SIZE_CLASSES - 1)) {
+					tgcExtensions->printf("  <%10zu %12zu %12zu\n", MM_AllocationSizeHistogram::getSizeClassLimit(sizeClass), histogram._counts[sizeClass], histogram._nonTLHCounts[sizeClass]);
+				} else {
+					tgcExtensions->printf("  >=%9zu %12zu %12zu\n", MM_AllocationSizeHistogram::getSizeClassLimit(sizeClass - 1), histogram._counts[sizeClass], histogram._nonTLHCounts[sizeClass]);
+				}
+			}
+		}
+	}
+
+	allocationExtensions->previousSlowPathCount = histogram._sampleCount;
+	allocationExtensions->previousNonTLHCount = histogram._nonTLHCount;
+	allocationExtensions->previousBytesAllocated = bytesAllocated;
+}
+#endif /* defined (J9VM_GC_THREAD_LOCAL_HEAP) */
+
 static void
 tgcAllocationPrintStats(OMR_VMThread* omrVMThread)
 {
@@ -58,6 +114,9 @@ tgcAllocationPrintStats(OMR_VMThread* omrVMThread)
 #endif /* defined (J9VM_GC_THREAD_LOCAL_HEAP) */
 	tgcExtensions->printf("Normal Allocated Count:        %12zu\n", allocStats->_allocationCount);
 	tgcExtensions->printf("Normal Allocated Bytes:        %12zu\n", allocStats->_allocationBytes);
+#if defined(J9VM_GC_THREAD_LOCAL_HEAP)
+	tgcAllocationPrintSizeHistogram(omrVMThread, tlhAllocatedTotal + allocStats->_allocationBytes);
+#endif /* defined (J9VM_GC_THREAD_LOCAL_HEAP) */
 }
 
 static void
@@ -83,6 +142,10 @@ tgcAllocationInitialize(J9JavaVM *javaVM)
 	J9HookInterface** omrHooks = J9_HOOK_INTERFACE(extensions->omrHookInterface);
 	(*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, tgcHookAllocationGlobalPrintStats, OMR_GET_CALLSITE(), NULL);
 	(*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_LOCAL_GC_START, tgcHookAllocationLocalPrintStats, OMR_GET_CALLSITE(), NULL);
+#if defined(J9VM_GC_THREAD_LOCAL_HEAP)
+	/* the size histogram report needs the out-of-line allocations to be sampled */
+	extensions->allocationSizeSampling = true;
+#endif /* defined (J9VM_GC_THREAD_LOCAL_HEAP) */
 
 	return result;
 }
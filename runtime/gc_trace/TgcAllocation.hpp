@@ -23,6 +23,15 @@
 #if !defined(TGCALLOCATION_HPP_)
 #define TGCALLOCATION_HPP_
 
+/**
+ * Structure holding information relating to tgc tracing for allocation.
+ */
+typedef struct TgcAllocationExtensions {
+	UDATA previousSlowPathCount; /**< out-of-line allocations sampled in the previous interval */
+	UDATA previousNonTLHCount; /**< out-of-line allocations not satisfied from a TLH in the previous interval */
+	UDATA previousBytesAllocated; /**< bytes allocated in the previous interval */
+} TgcAllocationExtensions;
+
 bool tgcAllocationInitialize(J9JavaVM *javaVM);
 
 #endif /* TGCALLOCATION_HPP_ */
@@ -127,6 +127,7 @@ public:
 	bool _interRegionReferencesRequested; /**< true if "interRegionReferences" option is parsed */
 	bool _sizeClassesRequested; /**< true if "sizeClasses" option is parsed */
 
+	TgcAllocationExtensions _allocation;
 	TgcBacktraceExtensions _backtrace;
 	TgcDumpExtensions _dump;
 	TgcExclusiveAccessExtensions _exclusiveAccess;
@@ -49,14 +49,14 @@ tgcHookCompactEndWriteOnceCompactTiming(J9HookInterface** hook, UDATA eventNum,
 	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(vmThread);
 	PORT_ACCESS_FROM_VMC(vmThread);
 
-	tgcExtensions->printf("WriteOnceCompact timing details (times in microseconds):\nThread flush leaftag datainit clearmap remsetclear planning reportmove     move (   stall) fixuppacket fixupleaf fixuproots recyclebits  rebuild (   stall) clearmap rebuildnext\n");
+	tgcExtensions->printf("WriteOnceCompact timing details (times in microseconds):\nThread flush leaftag datainit clearmap remsetclear planning reportmove     move (   stall) fixuplists fixuppacket fixupleaf fixuproots recyclebits  rebuild (   stall) clearmap rebuildnext\n");
 
 	J9VMThread *walkThread = NULL;
 	GC_VMThreadListIterator markThreadListIterator(vmThread);
 	while ((walkThread = markThreadListIterator.nextVMThread()) != NULL) {
 		MM_EnvironmentVLHGC *env = (MM_EnvironmentVLHGC*)walkThread->gcExtensions;
 		if ((walkThread == vmThread) || (env->getThreadType() == GC_WORKER_THREAD)) {
-			tgcExtensions->printf("%5zu: %5llu %7llu %8llu %8llu %11llu %8llu %8llu (%8llu) %11llu %9llu %10llu %11llu", env->getWorkerID(),
+			tgcExtensions->printf("%5zu: %5llu %7llu %8llu %8llu %11llu %8llu %8llu (%8llu) %10llu %11llu %9llu %10llu %11llu", env->getWorkerID(),
 					j9time_hires_delta(env->_compactVLHGCStats._flushStartTime, env->_compactVLHGCStats._flushEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
 					j9time_hires_delta(env->_compactVLHGCStats._leafTaggingStartTime, env->_compactVLHGCStats._leafTaggingEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
 					j9time_hires_delta(env->_compactVLHGCStats._regionCompactDataInitStartTime, env->_compactVLHGCStats._regionCompactDataInitEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
@@ -65,6 +65,7 @@ tgcHookCompactEndWriteOnceCompactTiming(J9HookInterface** hook, UDATA eventNum,
 					j9time_hires_delta(env->_compactVLHGCStats._planningStartTime, env->_compactVLHGCStats._planningEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
 					j9time_hires_delta(env->_compactVLHGCStats._moveStartTime, env->_compactVLHGCStats._moveEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
 					j9time_hires_delta(0, env->_compactVLHGCStats._moveStallTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
+					j9time_hires_delta(env->_compactVLHGCStats._fixupStartTime, env->_compactVLHGCStats._fixupEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
 					j9time_hires_delta(env->_compactVLHGCStats._fixupExternalPacketsStartTime, env->_compactVLHGCStats._fixupExternalPacketsEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
 					j9time_hires_delta(env->_compactVLHGCStats._fixupArrayletLeafStartTime, env->_compactVLHGCStats._fixupArrayletLeafEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
 					j9time_hires_delta(env->_compactVLHGCStats._rootFixupStartTime, env->_compactVLHGCStats._rootFixupEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
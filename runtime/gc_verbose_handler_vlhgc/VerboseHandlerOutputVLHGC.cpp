@@ -22,6 +22,7 @@
 
 #include "VerboseHandlerOutputVLHGC.hpp"
 
+#include "ClassLoaderManager.hpp"
 #include "CollectionStatisticsVLHGC.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "CopyForwardStats.hpp"
@@ -59,6 +60,7 @@ static void verboseHandlerGlobalGCMarkStart(J9HookInterface** hook, UDATA eventN
 static void verboseHandlerGlobalGCMarkEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerPGCMarkStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerPGCMarkEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+static void verboseHandlerPartialGCCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerReclaimSweepStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerReclaimSweepEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerReclaimCompactStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
@@ -145,6 +147,7 @@ MM_VerboseHandlerOutputVLHGC::enableVerbose()
 	/* Copy Forward */
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_START, verboseHandlerCopyForwardStart, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_END, verboseHandlerCopyForwardEnd, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_VLHGC_GARBAGE_COLLECT_COMPLETED, verboseHandlerPartialGCCompleted, OMR_GET_CALLSITE(), (void *)this);
 	
 	/* Concurrent GMP */
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_START, verboseHandlerConcurrentStart, OMR_GET_CALLSITE(), this);
@@ -204,6 +207,7 @@ MM_VerboseHandlerOutputVLHGC::disableVerbose()
 	/* Copy Forward */
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_START, verboseHandlerCopyForwardStart, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_END, verboseHandlerCopyForwardEnd, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_VLHGC_GARBAGE_COLLECT_COMPLETED, verboseHandlerPartialGCCompleted, NULL);
 	
 	/* Concurrent GMP */
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_START, verboseHandlerConcurrentStart, NULL);
@@ -463,6 +467,30 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 	exitAtomicReportingBlock();
 }
 
+void
+MM_VerboseHandlerOutputVLHGC::handlePartialGCCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData)
+{
+	MM_VlhgcGarbageCollectCompletedEvent* event = (MM_VlhgcGarbageCollectCompletedEvent *)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+	MM_CycleStateVLHGC *cycleState = static_cast<MM_CycleStateVLHGC*>(env->_cycleState);
+
+	/* a prediction is only made for copy-forward PGCs once a pause goal is set and the prediction has been calibrated */
+	if (0 != cycleState->_predictedPgcTime) {
+		U_64 predictedTime = cycleState->_predictedPgcTime;
+		U_64 actualTime = cycleState->_actualPgcTime;
+		MM_VerboseWriterChain* writer = _manager->getWriterChain();
+
+		enterAtomicReportingBlock();
+		writer->formatAndOutput(env, 0, "<pgc-pause-goal id=\"%zu\" goalms=\"%zu\" predictedms=\"%llu.%03.3llu\" actualms=\"%llu.%03.3llu\" />",
+				_manager->getIdAndIncrement(), extensions->tarokPGCPauseGoal,
+				predictedTime / 1000, predictedTime % 1000,
+				actualTime / 1000, actualTime % 1000);
+		writer->flush(env);
+		exitAtomicReportingBlock();
+	}
+}
+
 void
 MM_VerboseHandlerOutputVLHGC::handleConcurrentStartInternal(J9HookInterface** hook, UDATA eventNum, void* eventData)
 {
@@ -725,6 +753,19 @@ MM_VerboseHandlerOutputVLHGC::handleClassUnloadEnd(J9HookInterface** hook, UDATA
 			scanTime / 1000, scanTime % 1000,
 			postTime / 1000, postTime % 1000);
 
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	MM_ClassLoaderManager *classLoaderManager = MM_GCExtensions::getExtensions(env)->classLoaderManager;
+	if (classLoaderManager->isConcurrentCleanupEnabled()) {
+		/* the cleanup time is the finalizer thread's work on loaders and segments deferred by earlier unloading passes */
+		U_64 concurrentCleanupTime = classLoaderManager->consumeConcurrentCleanupTime();
+		writer->formatAndOutput(
+				env, 1,
+				"<classunload-deferred classloaders=\"%zu\" segmentbytes=\"%zu\" previouscleanupms=\"%llu.%03.3llu\" />",
+				classLoaderManager->getDeferredClassLoaderCount(), classLoaderManager->getDeferredSegmentsTotalSize(),
+				concurrentCleanupTime / 1000, concurrentCleanupTime % 1000);
+	}
+#endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
+
 	if (!partialTimeSuccess) {
 		writer->formatAndOutput(env, 1, "<warning details=\"clock error detected, previous timing may be inaccurate\" />");
 	}
@@ -787,6 +828,12 @@ verboseHandlerTaxationEntryPoint(J9HookInterface** hook, UDATA eventNum, void* e
 	((MM_VerboseHandlerOutputVLHGC *)userData)->handleTaxationEntryPoint(hook, eventNum, eventData);
 }
 
+void
+verboseHandlerPartialGCCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputVLHGC *)userData)->handlePartialGCCompleted(hook, eventNum, eventData);
+}
+
 void
 verboseHandlerGCStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
 {
@@ -156,6 +156,14 @@ public:
 	 * @param eventData hook specific event data.
 	 */
 	void handleCopyForwardEnd(J9HookInterface** hook, UDATA eventNum, void* eventData);
+
+	/**
+	 * Write the verbose stanza comparing the predicted and actual time of a PGC, when sizing for a PGC pause goal.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handlePartialGCCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData);
 	
 	virtual	void handleConcurrentStartInternal(J9HookInterface** hook, UDATA eventNum, void* eventData);
 	virtual void handleConcurrentEndInternal(J9HookInterface** hook, UDATA eventNum, void* eventData);
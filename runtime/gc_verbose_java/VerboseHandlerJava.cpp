@@ -49,6 +49,13 @@ MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_Envi
 	if((0 != systemCount) || (0 != defaultCount) || (0 != referenceCount) || (0 != classloaderCount)) {
 		manager->getWriterChain()->formatAndOutput(env, indent, "<pending-finalizers system=\"%zu\" default=\"%zu\" reference=\"%zu\" classloader=\"%zu\" />", systemCount, defaultCount, referenceCount, classloaderCount);
 	}
+
+	UDATA maxJobCount = finalizeListManager->getMaxJobCount();
+	UDATA jobsProcessed = finalizeListManager->getJobsProcessed();
+	if((0 != maxJobCount) || (0 != jobsProcessed)) {
+		manager->getWriterChain()->formatAndOutput(env, indent, "<finalizer-queue maxdepth=\"%zu\" processed=\"%zu\" activeworkers=\"%zu\" oldestpendingus=\"%llu\" maxdrainlatencyus=\"%llu\" />",
+			maxJobCount, jobsProcessed, finalizeListManager->getActiveWorkerCount(), finalizeListManager->getOldestPendingAge(), finalizeListManager->getMaxDrainLatency());
+	}
 }
 
 bool
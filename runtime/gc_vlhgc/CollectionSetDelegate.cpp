@@ -533,8 +533,14 @@ MM_CollectionSetDelegate::rateOfReturnCalculationBeforeSweep(MM_EnvironmentVLHGC
 				if(!region->_sweepData._alreadySwept) {
 					stats->_reclaimStats._reclaimableRegionCountBefore += 1;
 
-					stats->_reclaimStats._regionBytesFreeBefore += memoryPool->getActualFreeMemorySize();
-					stats->_reclaimStats._regionDarkMatterBefore +=  memoryPool->getDarkMatterBytes();
+					if (region->_sweepData._poolResetConcurrently) {
+						/* a concurrent sweep already reset the pool so use the statistics it recorded before doing so */
+						stats->_reclaimStats._regionBytesFreeBefore += region->_sweepData._freeBytesBeforeSweep;
+						stats->_reclaimStats._regionDarkMatterBefore += region->_sweepData._darkMatterBytesBeforeSweep;
+					} else {
+						stats->_reclaimStats._regionBytesFreeBefore += memoryPool->getActualFreeMemorySize();
+						stats->_reclaimStats._regionDarkMatterBefore +=  memoryPool->getDarkMatterBytes();
+					}
 				}
 				if(!region->getRememberedSetCardList()->isAccurate()) {
 					stats->_reclaimStats._regionCountOverflow += 1;
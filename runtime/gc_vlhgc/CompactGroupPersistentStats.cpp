@@ -536,7 +536,13 @@ MM_CompactGroupPersistentStats::updateStatsBeforeSweep(MM_EnvironmentVLHGC *env,
 			UDATA compactGroup = MM_CompactGroupManager::getCompactGroupNumber(env, region);
 
 			if (!persistentStats[compactGroup]._statsHaveBeenUpdatedThisCycle) {
-				UDATA completeFreeMemory = region->getMemoryPool()->getFreeMemoryAndDarkMatterBytes();
+				UDATA completeFreeMemory = 0;
+				if (region->_sweepData._poolResetConcurrently) {
+					/* a concurrent sweep already reset the pool so use the statistics it recorded before doing so */
+					completeFreeMemory = region->_sweepData._freeBytesBeforeSweep + region->_sweepData._darkMatterBytesBeforeSweep;
+				} else {
+					completeFreeMemory = region->getMemoryPool()->getFreeMemoryAndDarkMatterBytes();
+				}
 				Assert_MM_true(completeFreeMemory <= regionSize);
 				UDATA measuredLiveBytes = regionSize - completeFreeMemory;
 				UDATA projectedLiveBytes = region->_projectedLiveBytes;
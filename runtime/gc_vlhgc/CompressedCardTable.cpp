@@ -31,6 +31,7 @@
 #include "j9modron.h"
 #include "ModronAssertions.h"
 
+#include "Bits.hpp"
 #include "CardCleaner.hpp"
 #include "CardTable.hpp"
 #include "CompressedCardTable.hpp"
@@ -68,6 +69,12 @@
  */
 #define COMPRESSED_CARD_TABLE_DIV	1
 
+/*
+ * A word of the card table in which every card is CARD_CLEAN.
+ * Used to skip clean stretches of the card table a word at a time rather than card by card
+ */
+#define AllCardsInWordClean		((UDATA_MAX / 0xFF) * (UDATA)CARD_CLEAN)
+
 MM_CompressedCardTable *
 MM_CompressedCardTable::newInstance(MM_EnvironmentBase *env, MM_Heap *heap)
 {
@@ -183,6 +190,24 @@ MM_CompressedCardTable::rebuildCompressedCardTableForPartialCollect(MM_Environme
 
 #if (1 == COMPRESSED_CARD_TABLE_DIV)
 
+		if (1 == mask) {
+			/*
+			 * Starting a new compressed word - most cards are clean so check the cards it summarizes a word at a time
+			 * and only fall back to inspecting each card if one of them is not CARD_CLEAN
+			 */
+			Assert_MM_true(0 == ((UDATA)card % sizeof(UDATA)));
+			UDATA *cardWord = (UDATA *)card;
+			UDATA *cardWordLast = (UDATA *)(card + COMPRESSED_CARDS_PER_WORD);
+			while ((cardWord < cardWordLast) && (AllCardsInWordClean == *cardWord)) {
+				cardWord += 1;
+			}
+			if (cardWord == cardWordLast) {
+				*compressedCard++ = AllCompressedCardsInWordClean;
+				card += COMPRESSED_CARDS_PER_WORD;
+				continue;
+			}
+		}
+
 		Card state = *card++;
 		if (isDirtyCardForPartialCollect(state)) {
 			/* invert bit */
@@ -281,28 +306,29 @@ MM_CompressedCardTable::cleanCardsInRange(MM_EnvironmentBase *env, MM_CardCleane
 	for (UDATA i = compressedCardStartIndex; i < compressedCardEndIndex; i++) {
 		UDATA compressedCardWord = _compressedCardTable[i];
 		if (AllCompressedCardsInWordClean != compressedCardWord) {
-			/* search for dirty cards - iterate bits */
-			for (UDATA j = 0; j < COMPRESSED_CARDS_PER_WORD; j++) {
-				if (CompressedCardDirty == (compressedCardWord & 1)) {
-					for (UDATA k = 0; k < COMPRESSED_CARD_TABLE_DIV; k++) {
-						/* clean card */
-						cardCleaner->clean(env, address, address + CARD_SIZE, card);
-						card += 1;
-						address += CARD_SIZE;
-						cardsCleaned += 1;
-					}
-				} else {
-					/* skip cards this bit responsible for */
-					card += COMPRESSED_CARD_TABLE_DIV;
-					address += (CARD_SIZE * COMPRESSED_CARD_TABLE_DIV);
+#if defined(COMPRESSED_CARD_TABLE_INVERTED)
+			UDATA dirtyBits = ~compressedCardWord;
+#else /* defined(COMPRESSED_CARD_TABLE_INVERTED) */
+			UDATA dirtyBits = compressedCardWord;
+#endif /* defined(COMPRESSED_CARD_TABLE_INVERTED) */
+			/* search for dirty cards - jump straight to each dirty bit rather than testing every bit in the word */
+			while (0 != dirtyBits) {
+				UDATA bit = MM_Bits::leadingZeroes(dirtyBits);
+				dirtyBits &= ~((UDATA)1 << bit);
+				Card *dirtyCard = card + (bit * COMPRESSED_CARD_TABLE_DIV);
+				U_8 *dirtyAddress = address + (bit * CARD_SIZE * COMPRESSED_CARD_TABLE_DIV);
+				for (UDATA k = 0; k < COMPRESSED_CARD_TABLE_DIV; k++) {
+					/* clean card */
+					cardCleaner->clean(env, dirtyAddress, dirtyAddress + CARD_SIZE, dirtyCard);
+					dirtyCard += 1;
+					dirtyAddress += CARD_SIZE;
+					cardsCleaned += 1;
 				}
-				compressedCardWord >>= 1;
 			}
-		} else {
-			/* skip cards this word responsible for */
-			card += (COMPRESSED_CARD_TABLE_DIV * COMPRESSED_CARDS_PER_WORD);
-			address += (CARD_SIZE * COMPRESSED_CARD_TABLE_DIV * COMPRESSED_CARDS_PER_WORD);
 		}
+		/* move on to the cards the next word is responsible for */
+		card += (COMPRESSED_CARD_TABLE_DIV * COMPRESSED_CARDS_PER_WORD);
+		address += (CARD_SIZE * COMPRESSED_CARD_TABLE_DIV * COMPRESSED_CARDS_PER_WORD);
 	}
 
 	env->_cardCleaningStats._cardsCleaned += cardsCleaned;
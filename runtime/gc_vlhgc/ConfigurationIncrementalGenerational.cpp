@@ -120,6 +120,19 @@ MM_ConfigurationIncrementalGenerational::createHeapWithManager(MM_EnvironmentBas
 	}
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	/* Large primitive arrays keep only their spine in the heap and place their data off heap.
+	 * Off heap data is already contiguous, so double mapping of arraylet leaves is redundant.
+	 */
+	if (extensions->isVirtualLargeObjectHeapRequested) {
+		extensions->isVirtualLargeObjectHeapEnabled = true;
+		extensions->indexableObjectModel.setEnableVirtualLargeObjectHeap(true);
+#if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
+		extensions->indexableObjectModel.setEnableDoubleMapping(false);
+#endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+	}
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+
 	/* when we try to attach this heap to a region manager, we will need the card table since it needs to be NUMA-affinitized using the same logic as the heap so initialize it here */
 	extensions->cardTable = MM_IncrementalCardTable::newInstance(MM_EnvironmentVLHGC::getEnvironment(env), heap);
 	if (NULL == extensions->cardTable) {
@@ -83,6 +83,9 @@
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ObjectIteratorState.hpp"
 #include "ObjectModel.hpp"
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+#include "OffHeapArrayTable.hpp"
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 #include "ParallelDispatcher.hpp"
 #include "PacketSlotIterator.hpp"
 #include "ParallelTask.hpp"
@@ -2116,9 +2119,9 @@ MM_CopyForwardScheme::copyLeafChildren(MM_EnvironmentVLHGC* env, MM_AllocationCo
 
 MMINLINE void
 MM_CopyForwardScheme::depthCopyHotFields(MM_EnvironmentVLHGC *env, J9Class *clazz, J9Object *destinationObjectPtr, MM_AllocationContextTarok *reservingContext) {
-	/* depth copy the hot fields of an object up to a depth specified by depthCopyMax */
+	/* depth copy the hot fields of an object up to a depth specified by depthCopyMax, or by the class if it has chosen a smaller depth */
 	J9ClassHotFieldsInfo* hotFieldsInfo = clazz->hotFieldsInfo;
-	if (env->_hotFieldCopyDepthCount < _extensions->depthCopyMax && NULL != hotFieldsInfo) {
+	if (env->_hotFieldCopyDepthCount < _extensions->depthCopyMax && NULL != hotFieldsInfo && env->_hotFieldCopyDepthCount < hotFieldsInfo->hotFieldCopyDepth) {
 		U_8 hotFieldOffset = hotFieldsInfo->hotFieldOffset1;
 		if (U_8_MAX != hotFieldOffset) {
 			copyHotField(env, destinationObjectPtr, hotFieldOffset, reservingContext);
@@ -4088,6 +4091,27 @@ private:
 	}
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	virtual void doOffHeapArraySlot(MM_OffHeapArrayEntry *entry, GC_HashTableIterator *offHeapArrayIterator) {
+		MM_EnvironmentVLHGC *env = MM_EnvironmentVLHGC::getEnvironment(_env);
+		J9Object *objectPtr = entry->proxyObject;
+		env->_copyForwardStats._offHeapArraysCandidates += 1;
+		if (!_copyForwardScheme->isLiveObject(objectPtr)) {
+			Assert_MM_true(_copyForwardScheme->isObjectInEvacuateMemory(objectPtr));
+			MM_ForwardedHeader forwardedHeader(objectPtr, _extensions->compressObjectReferences());
+			objectPtr = forwardedHeader.getForwardedObject();
+			if (NULL == objectPtr) {
+				Assert_MM_mustBeClass(_extensions->objectModel.getPreservedClass(&forwardedHeader));
+				env->_copyForwardStats._offHeapArraysCleared += 1;
+				_extensions->offHeapArrayTable->freeData(env, entry);
+				offHeapArrayIterator->removeSlot();
+			} else {
+				entry->proxyObject = objectPtr;
+			}
+		}
+	}
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+
 	/**
 	 * @Clear the string table cache slot if the object is not marked
 	 */
@@ -43,6 +43,8 @@ public:
 	uintptr_t _desiredCompactWork; /**< Stats for desired amount of work to be compacted during a particular PGC cycle */
 	bool _useSlidingCompactor; /**< Stats to indicate If we surpassed survivor free memory. If so it's set to true, false otherwise */
 	bool _abortFlagRaisedDuringPGC; /**< Stats that indicate if PGC cycle aborted or not */
+	uint64_t _predictedPgcTime; /**< PGC time predicted from the collection set when a pause goal is set, in microseconds (0 if no prediction was made) */
+	uint64_t _actualPgcTime; /**< PGC time the predicted PGC actually took, in microseconds */
 
 	MM_CycleStateVLHGC()
 		: MM_CycleState()
@@ -52,6 +54,8 @@ public:
 		, _desiredCompactWork(0)
 		, _useSlidingCompactor(false)
 		, _abortFlagRaisedDuringPGC(false)
+		, _predictedPgcTime(0)
+		, _actualPgcTime(0)
 	{
 	}
 };
@@ -69,6 +69,9 @@
 #include "ModronTypes.hpp"
 #include "ObjectAccessBarrier.hpp"
 #include "ObjectModel.hpp"
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+#include "OffHeapArrayTable.hpp"
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 #include "PacketSlotIterator.hpp"
 #include "ParallelDispatcher.hpp"
 #include "ParallelTask.hpp"
@@ -1076,20 +1079,38 @@ MM_GlobalMarkingScheme::scanOwnableSynchronizerObjects(MM_EnvironmentVLHGC *env)
 		if (region->containsObjects()) {
 			if (!region->getOwnableSynchronizerObjectList()->wasEmpty()) {
 				if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-					J9Object *object = region->getOwnableSynchronizerObjectList()->getPriorList();
+					MM_OwnableSynchronizerObjectList *list = region->getOwnableSynchronizerObjectList();
+					/* marking doesn't move objects so survivors are kept linked in place, only relinking around cleared objects */
+					J9Object *survivorHead = NULL;
+					J9Object *survivorTail = NULL;
+					UDATA survivorCount = 0;
+					bool clearedSinceTail = false;
+					J9Object *object = list->getPriorList();
 					while (NULL != object) {
 						Assert_MM_true(region->isAddressInRegion(object));
 						env->_markVLHGCStats._ownableSynchronizerCandidates += 1;
 
-						/* read the next link before we add it to the buffer */
+						/* read the next link before we relink around this object */
 						J9Object* next = _extensions->accessBarrier->getOwnableSynchronizerLink(object);
 						if (isMarked(object)) {
-							env->getGCEnvironment()->_ownableSynchronizerObjectBuffer->add(env, object);
+							if (NULL == survivorHead) {
+								survivorHead = object;
+							} else if (clearedSinceTail) {
+								_extensions->accessBarrier->setOwnableSynchronizerLink(survivorTail, object);
+							}
+							survivorTail = object;
+							survivorCount += 1;
+							clearedSinceTail = false;
 						} else {
 							env->_markVLHGCStats._ownableSynchronizerCleared += 1;
+							clearedSinceTail = true;
 						}
 						object = next;
 					}
+					if (NULL != survivorHead) {
+						list->addAll(env, survivorHead, survivorTail);
+						list->incrementObjectCount(survivorCount);
+					}
 				}
 			}
 		}
@@ -1108,21 +1129,39 @@ MM_GlobalMarkingScheme::scanContinuationObjects(MM_EnvironmentVLHGC *env)
 		if (region->containsObjects()) {
 			if (!region->getContinuationObjectList()->wasEmpty()) {
 				if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-					J9Object *object = region->getContinuationObjectList()->getPriorList();
+					MM_ContinuationObjectList *list = region->getContinuationObjectList();
+					/* marking doesn't move objects so survivors are kept linked in place, only relinking around cleared objects */
+					J9Object *survivorHead = NULL;
+					J9Object *survivorTail = NULL;
+					UDATA survivorCount = 0;
+					bool clearedSinceTail = false;
+					J9Object *object = list->getPriorList();
 					while (NULL != object) {
 						Assert_MM_true(region->isAddressInRegion(object));
 						env->_markVLHGCStats._continuationCandidates += 1;
 
-						/* read the next link before we add it to the buffer */
+						/* read the next link before we relink around this object */
 						J9Object* next = _extensions->accessBarrier->getContinuationLink(object);
 						if (isMarked(object) && !VM_ContinuationHelpers::isFinished(*VM_ContinuationHelpers::getContinuationStateAddress((J9VMThread *)env->getLanguageVMThread() , object))) {
-							env->getGCEnvironment()->_continuationObjectBuffer->add(env, object);
+							if (NULL == survivorHead) {
+								survivorHead = object;
+							} else if (clearedSinceTail) {
+								_extensions->accessBarrier->setContinuationLink(survivorTail, object);
+							}
+							survivorTail = object;
+							survivorCount += 1;
+							clearedSinceTail = false;
 						} else {
 							env->_markVLHGCStats._continuationCleared += 1;
 							_extensions->releaseNativesForContinuationObject(env, object);
+							clearedSinceTail = true;
 						}
 						object = next;
 					}
+					if (NULL != survivorHead) {
+						list->addAll(env, survivorHead, survivorTail);
+						list->incrementObjectCount(survivorCount);
+					}
 				}
 			}
 		}
@@ -1330,6 +1369,9 @@ private:
 			/* We must call objectMonitorDestroy (as opposed to omrthread_monitor_destroy) when the
 			 * monitor is not internal to the GC */
 			static_cast<J9JavaVM*>(_omrVM->_language_vm)->internalVMFunctions->objectMonitorDestroy(static_cast<J9JavaVM*>(_omrVM->_language_vm), (J9VMThread *)_env->getLanguageVMThread(), (omrthread_monitor_t)monitor);
+		} else if (0 != static_cast<J9JavaVM*>(_omrVM->_language_vm)->thrDeflateIdleMonitors) {
+			/* The object does not move until after clearing, so an idle inflated monitor can be deflated in place */
+			static_cast<J9JavaVM*>(_omrVM->_language_vm)->internalVMFunctions->objectMonitorDeflateIdle(static_cast<J9JavaVM*>(_omrVM->_language_vm), (J9VMThread *)_env->getLanguageVMThread(), objectMonitor);
 		}
 	}
 
@@ -1376,6 +1418,17 @@ private:
     }
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	virtual void doOffHeapArraySlot(MM_OffHeapArrayEntry *entry, GC_HashTableIterator *offHeapArrayIterator) {
+		MM_EnvironmentVLHGC::getEnvironment(_env)->_markVLHGCStats._offHeapArraysCandidates += 1;
+		if (!_markingScheme->isMarked(entry->proxyObject)) {
+			MM_EnvironmentVLHGC::getEnvironment(_env)->_markVLHGCStats._offHeapArraysCleared += 1;
+			_extensions->offHeapArrayTable->freeData(_env, entry);
+			offHeapArrayIterator->removeSlot();
+		}
+	}
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+
 	/**
 	 * @Clear the string table cache slot if the object is not marked
 	 */
@@ -76,6 +76,9 @@ MM_HeapRegionDescriptorVLHGC::initialize(MM_EnvironmentBase *env, MM_HeapRegionM
 	_reclaimData._shouldReclaim = false;
 	_sweepData._alreadySwept = true;
 	_sweepData._lastGCNumber = 0;
+	_sweepData._poolResetConcurrently = false;
+	_sweepData._freeBytesBeforeSweep = 0;
+	_sweepData._darkMatterBytesBeforeSweep = 0;
 	_copyForwardData._initialLiveSet = false;
 	_copyForwardData._survivorSetAborted = false;
 	_copyForwardData._evacuateSet = false;
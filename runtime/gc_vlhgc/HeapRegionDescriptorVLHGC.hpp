@@ -62,6 +62,9 @@ public:
 	struct {
 		bool _alreadySwept;	/**< true if the collector has already swept this region during the last collection increment */
 		uintptr_t _lastGCNumber;	/**< initially 0 but set to the GC's collection ID every time it is swept so that the GC can ensure it doesn't over-collect the same set */
+		bool _poolResetConcurrently;	/**< true if a concurrent sweep reset this region's memory pool ahead of the pause which completes the sweep, in which case the pool's pre-sweep statistics are held below */
+		uintptr_t _freeBytesBeforeSweep;	/**< the actual free memory of the region's pool when a concurrent sweep reset it (only valid if _poolResetConcurrently) */
+		uintptr_t _darkMatterBytesBeforeSweep;	/**< the dark matter of the region's pool when a concurrent sweep reset it (only valid if _poolResetConcurrently) */
 	} _sweepData;
 	struct {
 		bool _initialLiveSet;  /**< true if the region was part of the live set at the start of collection */
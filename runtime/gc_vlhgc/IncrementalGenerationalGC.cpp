@@ -104,6 +104,10 @@ MM_IncrementalGenerationalGC::MM_IncrementalGenerationalGC(MM_EnvironmentVLHGC *
 	, _mainGCThread(env)
 	, _persistentGlobalMarkPhaseState()
 	, _forceConcurrentTermination(false)
+	, _concurrentGlobalSweepState()
+	, _forceConcurrentGlobalSweepTermination(false)
+	, _concurrentGlobalSweepRunning(false)
+	, _concurrentGlobalSweepMonitor(NULL)
 	, _globalMarkPhaseIncrementBytesStillToScan(0)
 {
 	_typeId = __FUNCTION__;
@@ -200,6 +204,10 @@ MM_IncrementalGenerationalGC::initialize(MM_EnvironmentVLHGC *env)
 		goto error_no_memory;
 	}
 
+	if (0 != omrthread_monitor_init_with_name(&_concurrentGlobalSweepMonitor, 0, "MM_IncrementalGenerationalGC::_concurrentGlobalSweepMonitor")) {
+		goto error_no_memory;
+	}
+
 	if (!_delegate.initialize(env, NULL, NULL)) {
 		goto error_no_memory;
 	}
@@ -269,6 +277,9 @@ MM_IncrementalGenerationalGC::initialize(MM_EnvironmentVLHGC *env)
 
 	(*mmPrivateHooks)->J9HookRegisterWithCallSite(mmPrivateHooks, J9HOOK_MM_PRIVATE_TAROK_INCREMENT_START, globalGCHookIncrementStart, OMR_GET_CALLSITE(), NULL);
 	(*mmPrivateHooks)->J9HookRegisterWithCallSite(mmPrivateHooks, J9HOOK_MM_PRIVATE_TAROK_INCREMENT_END, globalGCHookIncrementEnd, OMR_GET_CALLSITE(), NULL);
+
+	/* gc_check and tgc walk the heap without going through j9gc_flush_caches_for_walk */
+	(*mmPrivateHooks)->J9HookRegisterWithCallSite(mmPrivateHooks, J9HOOK_MM_PRIVATE_WALK_HEAP_START, globalGCHookWalkHeapStart, OMR_GET_CALLSITE(), NULL);
 	
 	return true;
 	
@@ -299,6 +310,11 @@ MM_IncrementalGenerationalGC::tearDown(MM_EnvironmentVLHGC *env)
 	_projectedSurvivalCollectionSetDelegate.tearDown(env);
 
 	_mainGCThread.tearDown(env);
+
+	if (NULL != _concurrentGlobalSweepMonitor) {
+		omrthread_monitor_destroy(_concurrentGlobalSweepMonitor);
+		_concurrentGlobalSweepMonitor = NULL;
+	}
 	
 	if(NULL != _markMapManager) {
 		_markMapManager->kill(env);
@@ -388,6 +404,7 @@ MM_IncrementalGenerationalGC::mainThreadGarbageCollect(MM_EnvironmentBase *envBa
 	 * allow concurrent operations.
 	 */
 	_forceConcurrentTermination = false;
+	_forceConcurrentGlobalSweepTermination = false;
 
 	/* Release any resources that might be bound to this main thread,
 	 * since it may be implicit and change for other phases of the cycle */
@@ -777,6 +794,15 @@ MM_IncrementalGenerationalGC::globalGCHookIncrementEnd(J9HookInterface** hook, U
 	extensions->heap->getResizeStats()->updateHeapResizeStats();
 }
 
+void
+MM_IncrementalGenerationalGC::globalGCHookWalkHeapStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_WalkHeapStartEvent* event = (MM_WalkHeapStartEvent*)eventData;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(event->omrVM);
+
+	((MM_IncrementalGenerationalGC *)extensions->getGlobalCollector())->stopConcurrentGlobalSweep();
+}
+
 /**
  * Request to create sweepPoolState class for pool
  * @param  memoryPool memory pool to attach sweep state to
@@ -1970,7 +1996,7 @@ MM_IncrementalGenerationalGC::reportCopyForwardEnd(MM_EnvironmentVLHGC *env, U_6
 }
 
 bool
-MM_IncrementalGenerationalGC::isConcurrentWorkAvailable(MM_EnvironmentBase *env)
+MM_IncrementalGenerationalGC::isConcurrentMarkWorkAvailable(MM_EnvironmentBase *env)
 {
 	bool isConcurrentEnabled = _extensions->tarokEnableConcurrentGMP;
 	bool isGMPRunning = isGlobalMarkPhaseRunning();
@@ -1981,6 +2007,23 @@ MM_IncrementalGenerationalGC::isConcurrentWorkAvailable(MM_EnvironmentBase *env)
 	return isConcurrentEnabled && isGMPRunning && isProcessingWorkPackets && isStillPermittedToRun && isGMPWorkAvailable;
 }
 
+bool
+MM_IncrementalGenerationalGC::isConcurrentGlobalSweepWorkAvailable(MM_EnvironmentBase *env)
+{
+	bool isConcurrentEnabled = _extensions->tarokConcurrentGlobalSweep;
+	bool isGlobalSweepPending = _schedulingDelegate.isGlobalSweepRequired() && !isGlobalMarkPhaseRunning();
+	bool isStillPermittedToRun = !_forceConcurrentTermination && !_forceConcurrentGlobalSweepTermination;
+	bool isSweepWorkAvailable = !_reclaimDelegate.isConcurrentGlobalSweepComplete();
+
+	return isConcurrentEnabled && isGlobalSweepPending && isStillPermittedToRun && isSweepWorkAvailable;
+}
+
+bool
+MM_IncrementalGenerationalGC::isConcurrentWorkAvailable(MM_EnvironmentBase *env)
+{
+	return isConcurrentMarkWorkAvailable(env) || isConcurrentGlobalSweepWorkAvailable(env);
+}
+
 void
 MM_IncrementalGenerationalGC::preConcurrentInitializeStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats)
 {
@@ -1988,6 +2031,17 @@ MM_IncrementalGenerationalGC::preConcurrentInitializeStatsAndReport(MM_Environme
 	Assert_MM_true(NULL == env->_cycleState);
 	PORT_ACCESS_FROM_ENVIRONMENT(env);
 
+	if (!isConcurrentMarkWorkAvailable(env)) {
+		/* The GMP has completed so sweep the regions it marked, using its mark map which is now the PGC map.  This is
+		 * not a concurrent mark phase so the concurrent phase start and end events are not reported for it.
+		 */
+		_concurrentGlobalSweepState = MM_CycleStateVLHGC();
+		_concurrentGlobalSweepState._markMap = _markMapManager->getPartialGCMap();
+		_concurrentGlobalSweepState._noCompactionAfterSweep = true;
+		env->_cycleState = &_concurrentGlobalSweepState;
+		return;
+	}
+
 	stats->_cycleID = _persistentGlobalMarkPhaseState._verboseContextID;
 	stats->_scanTargetInBytes = _globalMarkPhaseIncrementBytesStillToScan;
 	env->_cycleState = &_persistentGlobalMarkPhaseState;
@@ -2016,6 +2070,29 @@ MM_IncrementalGenerationalGC::mainThreadConcurrentCollect(MM_EnvironmentBase *en
 	/* note that we can't check isConcurrentWorkAvailable at this point since another thread could have set _forceConcurrentTermination since the
 	 * main thread calls this outside of the control monitor
 	 */
+	if (env->_cycleState == &_concurrentGlobalSweepState) {
+		Assert_MM_true(_schedulingDelegate.isGlobalSweepRequired());
+		/* A heap walker may have stopped the sweep since the main thread left the control monitor: the flag is checked
+		 * under _concurrentGlobalSweepMonitor so that a walker which set it either sees the task running, and waits for
+		 * it, or the task is never started.
+		 */
+		omrthread_monitor_enter(_concurrentGlobalSweepMonitor);
+		bool shouldSweep = !_forceConcurrentGlobalSweepTermination;
+		_concurrentGlobalSweepRunning = shouldSweep;
+		omrthread_monitor_exit(_concurrentGlobalSweepMonitor);
+
+		if (shouldSweep) {
+			/* The sweep stops early when _forceConcurrentGlobalSweepTermination is set.  Whatever it did not reach is swept by the next PGC. */
+			_reclaimDelegate.runConcurrentGlobalSweep(env, &_forceConcurrentGlobalSweepTermination);
+
+			omrthread_monitor_enter(_concurrentGlobalSweepMonitor);
+			_concurrentGlobalSweepRunning = false;
+			omrthread_monitor_notify_all(_concurrentGlobalSweepMonitor);
+			omrthread_monitor_exit(_concurrentGlobalSweepMonitor);
+		}
+		return 0;
+	}
+
 	Assert_MM_true(env->_cycleState == &_persistentGlobalMarkPhaseState);
 	Assert_MM_true(isGlobalMarkPhaseRunning());
 	Assert_MM_true(MM_CycleState::state_process_work_packets_after_initial_mark == _persistentGlobalMarkPhaseState._markDelegateState);
@@ -2044,6 +2121,10 @@ void
 MM_IncrementalGenerationalGC::postConcurrentUpdateStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats, UDATA bytesConcurrentlyScanned)
 {
 	Assert_MM_false(isConcurrentWorkAvailable(env));
+	if (env->_cycleState == &_concurrentGlobalSweepState) {
+		env->_cycleState = NULL;
+		return;
+	}
 	Assert_MM_true(env->_cycleState == &_persistentGlobalMarkPhaseState);
 	PORT_ACCESS_FROM_ENVIRONMENT(env);
 
@@ -2111,6 +2192,25 @@ MM_IncrementalGenerationalGC::forceConcurrentFinish()
 	 * early by setting this flag.
 	 */
 	_forceConcurrentTermination = true;
+	_forceConcurrentGlobalSweepTermination = true;
+}
+
+void
+MM_IncrementalGenerationalGC::stopConcurrentGlobalSweep()
+{
+	if (!_extensions->tarokConcurrentGlobalSweep) {
+		return;
+	}
+
+	/* The sweep runs on the main GC thread and its workers without VM access, so exclusive access alone does not stop it
+	 * from writing free entries into the regions a heap walker is about to read.
+	 */
+	omrthread_monitor_enter(_concurrentGlobalSweepMonitor);
+	_forceConcurrentGlobalSweepTermination = true;
+	while (_concurrentGlobalSweepRunning) {
+		omrthread_monitor_wait(_concurrentGlobalSweepMonitor);
+	}
+	omrthread_monitor_exit(_concurrentGlobalSweepMonitor);
 }
 
 
@@ -2530,8 +2630,16 @@ MM_IncrementalGenerationalGC::unloadDeadClassLoaders(MM_EnvironmentVLHGC *env)
 		 */
 		classUnloadStats->_endScanTime = j9time_hires_clock();
 		classUnloadStats->_startPostTime = classUnloadStats->_endScanTime;
-		/* enqueue all the segments we just salvaged from the dead class loaders for delayed free (this work was historically attributed in the unload end operation so it goes after the timer start) */
-		_extensions->classLoaderManager->enqueueUndeadClassSegments(reclaimedSegments);
+		if (_extensions->classLoaderManager->isConcurrentCleanupEnabled()) {
+			/* leave the segments for the finalizer thread, which frees them (along with the dead class loaders enqueued by cleanUpClassLoaders) once the pause has ended */
+			if (NULL != reclaimedSegments) {
+				_extensions->classLoaderManager->enqueueDeferredClassSegments(reclaimedSegments);
+				env->_cycleState->_finalizationRequired = true;
+			}
+		} else {
+			/* enqueue all the segments we just salvaged from the dead class loaders for delayed free (this work was historically attributed in the unload end operation so it goes after the timer start) */
+			_extensions->classLoaderManager->enqueueUndeadClassSegments(reclaimedSegments);
+		}
 		_extensions->classLoaderManager->cleanUpClassLoadersEnd(env, unloadLink);
 		/* we can now flush these since we don't need to walk any dead objects in Balanced */
 		if (_extensions->classLoaderManager->reclaimableMemory() > 0) {
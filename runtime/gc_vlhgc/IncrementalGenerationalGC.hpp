@@ -105,6 +105,10 @@ private:
 	
 	MM_CycleStateVLHGC _persistentGlobalMarkPhaseState; /**< Since the GMP can be fragmented into increments running across several pauses, we need to store the cycle state data */
 	volatile bool _forceConcurrentTermination;	/**< Setting this to true will cause any concurrent GMP work being done for this collector to stop and return.  It is volatile because it is shared state between this and the concurrent task's increment manager */
+	MM_CycleStateVLHGC _concurrentGlobalSweepState; /**< The cycle state used by the main GC thread while it sweeps the regions marked by a completed GMP concurrently with the mutators */
+	volatile bool _forceConcurrentGlobalSweepTermination; /**< Setting this to true will cause a concurrent global sweep to stop and return, without interrupting concurrent GMP work.  Set with forceConcurrentFinish or stopConcurrentGlobalSweep, and cleared at the end of the next pause */
+	bool _concurrentGlobalSweepRunning; /**< true while the main GC thread is running a concurrent global sweep task (protected by _concurrentGlobalSweepMonitor) */
+	omrthread_monitor_t _concurrentGlobalSweepMonitor; /**< Used by heap walkers to wait for a concurrent global sweep they have stopped to return */
 	
 	UDATA _globalMarkPhaseIncrementBytesStillToScan;	/**< The number of bytes which must be scanned in the next GMP increment.  This is used by the concurrent GMP task to determine when it can terminate */
 
@@ -116,6 +120,7 @@ private:
 	static void globalGCHookSysEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 	static void globalGCHookIncrementStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData); 
 	static void globalGCHookIncrementEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData); 
+	static void globalGCHookWalkHeapStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 
 	/**
 	 * Called after an operation which has completed the env's mark map (either a GMP completed, a global mark
@@ -358,6 +363,16 @@ public:
 
 	virtual bool isMarked(void *objectPtr);
 
+	/**
+	 * @return true if a GMP is running and has concurrent mark work remaining
+	 */
+	bool isConcurrentMarkWorkAvailable(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if a GMP has completed and the regions it marked have not yet all been swept by a concurrent global sweep
+	 */
+	bool isConcurrentGlobalSweepWorkAvailable(MM_EnvironmentBase *env);
+
 	/**
 	 * @return true if the collector has a pending concurrent request
 	 */
@@ -372,7 +387,7 @@ public:
 	virtual void preConcurrentInitializeStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats);
 
 	/**
-	 * The entry-point used by the main GC thread to perform concurrent GMP work.  isConcurrentWorkAvailable must be true.
+	 * The entry-point used by the main GC thread to perform concurrent GMP or global sweep work.  isConcurrentWorkAvailable must be true.
 	 * @param env[in] The main GC thread
 	 * @return The number of bytes scanned by this invocation of the concurrent task
 	 */
@@ -403,6 +418,14 @@ public:
 	 */
 	virtual void forceConcurrentFinish();
 
+	/**
+	 * Stop any concurrent global sweep and wait for its task to return, so that a thread which holds exclusive VM access
+	 * can walk the heap without free entries being written under it.  The sweep does not resume until the end of the
+	 * next pause, which sweeps whatever it did not reach.  Called by j9gc_flush_caches_for_walk and on
+	 * J9HOOK_MM_PRIVATE_WALK_HEAP_START, with exclusive VM access held.
+	 */
+	void stopConcurrentGlobalSweep();
+
 	/**
 	 * perform initializing before Main thread startup or first non gcthread garbage collection
 	 * @param env[in] the current thread
@@ -35,6 +35,7 @@
 #include "ParallelSweepSchemeVLHGC.hpp"
 
 #include "AllocateDescription.hpp"
+#include "AtomicOperationsAPI.hpp"
 #include "Bits.hpp"
 #include "CardTable.hpp"
 #include "Debug.hpp"
@@ -143,6 +144,23 @@ MM_ParallelSweepVLHGCTask::mainCleanup(MM_EnvironmentBase *envBase)
 	_sweepScheme->clearCycleState();
 }
 
+/**
+ * Run the concurrent sweep task.
+ */
+void
+MM_ConcurrentSweepVLHGCTask::run(MM_EnvironmentBase *envBase)
+{
+	MM_EnvironmentVLHGC *env = MM_EnvironmentVLHGC::getEnvironment(envBase);
+	_sweepScheme->sweepChunksConcurrently(env, _forceExit);
+}
+
+void
+MM_ConcurrentSweepVLHGCTask::mainCleanup(MM_EnvironmentBase *env)
+{
+	/* the sweep is incomplete until the pause connects the chunks, so empty regions can not be recycled yet */
+	_sweepScheme->clearCycleState();
+}
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 /**
  * Stats gathering for synchronizing threads during sweep.
@@ -199,6 +217,9 @@ MM_ParallelSweepSchemeVLHGC::MM_ParallelSweepSchemeVLHGC(MM_EnvironmentVLHGC *en
 	, _sweepHeapSectioning(NULL)
 	, _poolSweepPoolState(NULL)
 	, _mutexSweepPoolState(NULL)
+	, _concurrentSweepPrepared(false)
+	, _concurrentSweepCursor(0)
+	, _chunksSweptConcurrently(0)
 {
 	_typeId = __FUNCTION__;
 }
@@ -363,6 +384,9 @@ void
 MM_ParallelSweepSchemeVLHGC::heapReconfigured(MM_EnvironmentVLHGC *env)
 {
 	_sweepHeapSectioning->update(env);
+
+	/* the chunks swept by a concurrent sweep no longer match the chunk table so the pause must sweep from scratch */
+	_concurrentSweepPrepared = false;
 }
 
 /**
@@ -704,6 +728,28 @@ MM_ParallelSweepSchemeVLHGC::prepareAllChunks(MM_EnvironmentVLHGC *env)
 	return _sweepHeapSectioning->reassignChunks(env);
 }
 
+/**
+ * Reset the memory pools of all regions in the sweep set.
+ */
+void
+MM_ParallelSweepSchemeVLHGC::resetMemoryPoolsForSweep(MM_EnvironmentVLHGC *env, bool isConcurrent)
+{
+	GC_HeapRegionIteratorVLHGC regionIterator(_regionManager);
+	MM_HeapRegionDescriptorVLHGC *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (!region->_sweepData._alreadySwept && region->hasValidMarkMap()) {
+			MM_MemoryPool *memoryPool = region->getMemoryPool();
+			if (isConcurrent && !region->_sweepData._poolResetConcurrently) {
+				/* the pause gathers its pre-sweep statistics after this reset, so keep them in the region */
+				region->_sweepData._freeBytesBeforeSweep = memoryPool->getActualFreeMemorySize();
+				region->_sweepData._darkMatterBytesBeforeSweep = memoryPool->getDarkMatterBytes();
+				region->_sweepData._poolResetConcurrently = true;
+			}
+			memoryPool->reset(MM_MemoryPool::forSweep);
+		}
+	}
+}
+
 /**
  * Sweep all chunks.
  * 
@@ -726,6 +772,11 @@ MM_ParallelSweepSchemeVLHGC::sweepAllChunks(MM_EnvironmentVLHGC *env, UDATA tota
 		chunk = sectioningIterator.nextChunk();
 			
 		Assert_MM_true (chunk != NULL);  /* Should never return NULL */
+
+		/* the leading chunks may already have been swept while the mutators were running */
+		if (chunkNum < _chunksSweptConcurrently) {
+			continue;
+		}
 		
 if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 			
@@ -761,6 +812,59 @@ if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 	
 }
 
+/**
+ * Sweep chunks while the mutators are running.
+ * Chunks are claimed in chunk table order and a claimed chunk is always swept, so once the task completes every
+ * chunk below the cursor has been swept and the pause only has to sweep the chunks from the cursor on.
+ */
+void
+MM_ParallelSweepSchemeVLHGC::sweepChunksConcurrently(MM_EnvironmentVLHGC *env, volatile bool *forceExit)
+{
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	UDATA chunksProcessed = 0; /* Chunks processed by this thread */
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	UDATA nextChunkNum = 0;
+	MM_ParallelSweepChunk *chunk = NULL;
+	MM_ParallelSweepChunk *prevChunk = NULL;
+	MM_SweepHeapSectioningIterator sectioningIterator(_sweepHeapSectioning);
+
+	while (!*forceExit) {
+		UDATA claimedChunkNum = MM_AtomicOperations::add(&_concurrentSweepCursor, 1) - 1;
+		if (claimedChunkNum >= _chunksPrepared) {
+			break;
+		}
+
+		/* claims are increasing so this thread's iterator only ever moves forward */
+		while (nextChunkNum <= claimedChunkNum) {
+			chunk = sectioningIterator.nextChunk();
+			nextChunkNum += 1;
+		}
+		Assert_MM_true(NULL != chunk);
+
+		if ((NULL != prevChunk) && (prevChunk->memoryPool != chunk->memoryPool)) {
+			prevChunk->memoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+		}
+		if ((NULL == prevChunk) || (prevChunk->memoryPool != chunk->memoryPool)) {
+			env->_freeEntrySizeClassStats.initializeFrequentAllocation(chunk->memoryPool->getLargeObjectAllocateStats());
+		}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		chunksProcessed += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		sweepChunk(env, chunk);
+		prevChunk = chunk;
+	}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	env->_sweepVLHGCStats.sweepChunksProcessed = chunksProcessed;
+	env->_sweepVLHGCStats.sweepChunksTotal = _chunksPrepared;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	if (NULL != prevChunk) {
+		prevChunk->memoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+	}
+}
+
 /**
  * Connect a chunk into the free list.
  * Given a previously swept chunk, connect its data to the free list of the associated memory subspace.
@@ -875,20 +979,18 @@ MM_ParallelSweepSchemeVLHGC::internalSweep(MM_EnvironmentVLHGC *env)
 {
 	/* main thread does initialization */
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMain(env, UNIQUE_ID)) {
-		/* Reset all memory pools within the sweep set as a precursor to sweeping. */
-		GC_HeapRegionIteratorVLHGC regionIterator(_regionManager);
-		MM_HeapRegionDescriptorVLHGC *region = NULL;
-		while (NULL != (region = regionIterator.nextRegion())) {
-			if (!region->_sweepData._alreadySwept && region->hasValidMarkMap()) {
-				region->getMemoryPool()->reset(MM_MemoryPool::forSweep);
-			}
+		U_8 *sweepBits = (U_8 *)_cycleState._markMap->getMarkBits();
+		if (!_concurrentSweepPrepared || (sweepBits != _currentSweepBits)) {
+			/* no concurrent sweep was started with this mark map so sweep the whole set */
+			_chunksSweptConcurrently = 0;
+			resetMemoryPoolsForSweep(env, false);
+			_currentSweepBits = sweepBits;
+			_chunksPrepared = prepareAllChunks(env);
 		}
+		_concurrentSweepPrepared = false;
 
 		/* Reset largestFreeEntry of all subSpaces at beginning of sweep */
 		_extensions->heap->resetLargestFreeEntry();
-		_currentSweepBits = (U_8 *)_cycleState._markMap->getMarkBits();
-
-		_chunksPrepared = prepareAllChunks(env);
 		
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
@@ -941,6 +1043,30 @@ MM_ParallelSweepSchemeVLHGC::sweep(MM_EnvironmentVLHGC *env)
 	updateProjectedLiveBytesAfterSweep(env);
 }
 
+bool
+MM_ParallelSweepSchemeVLHGC::sweepConcurrent(MM_EnvironmentVLHGC *env, volatile bool *forceExit)
+{
+	Assert_MM_true(NULL != env->_cycleState->_markMap);
+
+	if (!_concurrentSweepPrepared) {
+		setupForSweep(env);
+		resetMemoryPoolsForSweep(env, true);
+		_currentSweepBits = (U_8 *)env->_cycleState->_markMap->getMarkBits();
+		_chunksPrepared = prepareAllChunks(env);
+		_concurrentSweepCursor = 0;
+		_chunksSweptConcurrently = 0;
+		_concurrentSweepPrepared = true;
+	}
+
+	MM_ConcurrentSweepVLHGCTask sweepTask(env, _dispatcher, this, env->_cycleState, forceExit);
+	_dispatcher->run(env, &sweepTask);
+
+	/* threads which found the cursor past the last chunk still advanced it */
+	_chunksSweptConcurrently = OMR_MIN(_concurrentSweepCursor, _chunksPrepared);
+
+	return isConcurrentSweepComplete();
+}
+
 /**
  * Complete any sweep work after a basic sweep operation.
  * Completing the sweep is a noop - the basic sweep operation consists of a full sweep.
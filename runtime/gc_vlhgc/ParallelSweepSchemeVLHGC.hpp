@@ -93,6 +93,32 @@ public:
 	}
 };
 
+/**
+ * Task to sweep the chunks of the current sweep set while mutators are running.
+ * Only the chunk sweep is performed; connecting the free lists and recycling empty regions is left to the
+ * pause which completes the sweep.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentSweepVLHGCTask : public MM_ParallelSweepVLHGCTask
+{
+private:
+	volatile bool * const _forceExit;	/**< Shared state concurrently updated by an external thread to force the receiver to stop claiming chunks (by setting the destination of the pointer to true) */
+protected:
+public:
+	virtual void run(MM_EnvironmentBase *env);
+	virtual void mainCleanup(MM_EnvironmentBase *env);
+
+	/**
+	 * Create a ConcurrentSweepVLHGCTask object.
+	 */
+	MM_ConcurrentSweepVLHGCTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_ParallelSweepSchemeVLHGC *sweepScheme, MM_CycleState *cycleState, volatile bool *forceExit) :
+		MM_ParallelSweepVLHGCTask(env, dispatcher, sweepScheme, cycleState),
+		_forceExit(forceExit)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 /**
  * @todo Provide class documentation
  * @ingroup GC_Modron_Standard
@@ -117,6 +143,10 @@ private:
 	J9Pool *_poolSweepPoolState;				/**< Memory pools for SweepPoolState*/ 
 	omrthread_monitor_t _mutexSweepPoolState;	/**< Monitor to protect memory pool operations for sweepPoolState*/
 	bool _noCompactionAfterSweep;	/**< if true, no compaction would be expected after current sweep */
+
+	bool _concurrentSweepPrepared;	/**< true if a concurrent sweep has reset the pools and assigned the chunks of the current sweep set, using the mark bits in _currentSweepBits */
+	volatile UDATA _concurrentSweepCursor;	/**< index of the next chunk to be claimed by a concurrent sweep thread */
+	UDATA _chunksSweptConcurrently;	/**< number of chunks, from the start of the chunk table, which the concurrent sweep has already swept */
 	
 protected:
 public:
@@ -140,6 +170,22 @@ protected:
 	void sweepAllChunks(MM_EnvironmentVLHGC *env, UDATA totalChunkCount);
 	UDATA prepareAllChunks(MM_EnvironmentVLHGC *env);
 
+	/**
+	 * Reset the memory pools of all regions in the sweep set as a precursor to sweeping them.
+	 * @param env[in] the main thread
+	 * @param isConcurrent[in] true if mutators are running, in which case the pre-sweep statistics of each pool
+	 * are preserved in its region for the pause which completes the sweep
+	 */
+	void resetMemoryPoolsForSweep(MM_EnvironmentVLHGC *env, bool isConcurrent);
+
+	/**
+	 * Sweep chunks, in chunk table order, until all prepared chunks have been claimed or termination is requested.
+	 * @note Called by all threads of a concurrent sweep task
+	 * @param env[in] a GC thread
+	 * @param forceExit[in] set by an external thread to stop the sweep
+	 */
+	void sweepChunksConcurrently(MM_EnvironmentVLHGC *env, volatile bool *forceExit);
+
 	/**
 	 * Accurately measure the dark matter within the mark map UDATA beginning at heapSlotFreeCurrent.
 	 * Leading dark matter (before the first marked object) is not included.
@@ -214,6 +260,26 @@ public:
 	virtual void completeSweep(MM_EnvironmentBase *env, SweepCompletionReason reason);
 	virtual bool sweepForMinimumSize(MM_EnvironmentBase *env, MM_MemorySubSpace *baseMemorySubSpace, MM_AllocateDescription *allocateDescription);
 
+	/**
+	 * Sweep the regions which have a valid mark map but have not yet been swept, while mutators are running.
+	 * May be called repeatedly until it returns true; the pause which next sweeps using the same mark map
+	 * only sweeps the chunks which remain.
+	 * @note Expect the main GC thread, with the dispatcher and worker threads available for work
+	 * @note Expect the mutators not to allocate from any region in the sweep set
+	 * @param env[in] the main GC thread
+	 * @param forceExit[in] set by an external thread to stop the sweep early
+	 * @return true if every chunk of the sweep set has been swept
+	 */
+	bool sweepConcurrent(MM_EnvironmentVLHGC *env, volatile bool *forceExit);
+
+	/**
+	 * @return true if a concurrent sweep has swept every chunk of the current sweep set
+	 */
+	bool isConcurrentSweepComplete()
+	{
+		return _concurrentSweepPrepared && (_chunksSweptConcurrently == _chunksPrepared);
+	}
+
 	MM_SweepPoolState *getPoolState(MM_MemoryPool *memoryPool);
 
 	/**
@@ -252,6 +318,7 @@ public:
 	MM_ParallelSweepSchemeVLHGC(MM_EnvironmentVLHGC *env);
 
 	friend class MM_ParallelSweepVLHGCTask;
+	friend class MM_ConcurrentSweepVLHGCTask;
 };
 
 #endif /* PARALLELSWEEPSCHEMEVLHGC_HPP_ */
@@ -37,6 +37,7 @@
 #include "CompactGroupManager.hpp"
 #include "CompactGroupPersistentStats.hpp"
 #include "CycleState.hpp"
+#include "CycleStateVLHGC.hpp"
 #include "EnvironmentVLHGC.hpp"
 #include "GlobalAllocationManagerTarok.hpp"
 #include "MemorySubSpace.hpp"
@@ -48,6 +49,7 @@
 #include "MarkMap.hpp"
 #include "MemoryPool.hpp"
 #include "RegionValidator.hpp"
+#include "SchedulingDelegate.hpp"
 
 MM_ProjectedSurvivalCollectionSetDelegate::MM_ProjectedSurvivalCollectionSetDelegate(MM_EnvironmentBase *env, MM_HeapRegionManager *manager)
 	: MM_BaseNonVirtual()
@@ -56,6 +58,9 @@ MM_ProjectedSurvivalCollectionSetDelegate::MM_ProjectedSurvivalCollectionSetDele
 	, _setSelectionDataTable(NULL)
 	, _dynamicSelectionList(NULL)
 	, _dynamicSelectionRegionList(NULL)
+	, _edenRegionsSelected(0)
+	, _nonEdenRegionsSelected(0)
+	, _pauseGoalRegionBudget(UDATA_MAX)
 {
 	_typeId = __FUNCTION__;
 }
@@ -216,6 +221,11 @@ MM_ProjectedSurvivalCollectionSetDelegate::selectRegion(MM_EnvironmentVLHGC *env
 	region->_defragmentationTarget = false;
 
 	_extensions->compactGroupPersistentStats[compactGroup]._regionsInRegionCollectionSetForPGC += 1;
+	if (region->isEden()) {
+		_edenRegionsSelected += 1;
+	} else {
+		_nonEdenRegionsSelected += 1;
+	}
 
 	Trc_MM_CollectionSetDelegate_selectRegionsForBudget(env->getLanguageVMThread(), tableIndex, compactGroup, (100 * freeMemory)/regionSize, (100 * projectedFreeMemoryAfterGC)/regionSize, (100 * projectedReclaimableBytes)/regionSize);
 }
@@ -282,6 +292,7 @@ MM_ProjectedSurvivalCollectionSetDelegate::createRateOfReturnCollectionSet(MM_En
 	} else {
 		regionBudget = (UDATA)(nurseryRegionCount * _extensions->tarokDynamicCollectionSetSelectionPercentageBudget);
 	}
+	regionBudget = OMR_MIN(regionBudget, _pauseGoalRegionBudget);
 
 	Trc_MM_CollectionSetDelegate_createRegionCollectionSetForPartialGC_dynamicRegionSelectionBudget(
 		env->getLanguageVMThread(),
@@ -301,6 +312,9 @@ MM_ProjectedSurvivalCollectionSetDelegate::createRateOfReturnCollectionSet(MM_En
 			selectRegion(env, region);
 			_setSelectionDataTable[compactGroup]._dynamicSelectionThisCycle = true;
 			regionBudget -= 1;
+			if (UDATA_MAX != _pauseGoalRegionBudget) {
+				_pauseGoalRegionBudget -= 1;
+			}
 		} else {
 			/* Since _dynamicSelectionRegionList is sorted by projectedReclaimableBytes, they'll be no more regions to select so break */
 			break;
@@ -345,6 +359,7 @@ MM_ProjectedSurvivalCollectionSetDelegate::createCoreSamplingCollectionSet(MM_En
 	} else {
 		regionBudget = (UDATA)(nurseryRegionCount * _extensions->tarokCoreSamplingPercentageBudget);
 	}
+	regionBudget = OMR_MIN(regionBudget, _pauseGoalRegionBudget);
 
 	Trc_MM_CollectionSetDelegate_createRegionCollectionSetForPartialGC_coreSamplingBudget(
 		env->getLanguageVMThread(),
@@ -420,10 +435,21 @@ MM_ProjectedSurvivalCollectionSetDelegate::createRegionCollectionSetForPartialGC
 		}
 	}
 
+	MM_SchedulingDelegate *schedulingDelegate = static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_schedulingDelegate;
+	_edenRegionsSelected = 0;
+	_nonEdenRegionsSelected = 0;
+
 	UDATA nurseryRegionCount = createNurseryCollectionSet(env);
 
 	/* Add any non-nursery regions to the collection set as the rate-of-return and region budget dictates */
 	if(dynamicCollectionSet) {
+		/* With a PGC pause goal, non-nursery regions are only added while the collection set is predicted to meet the goal */
+		_pauseGoalRegionBudget = schedulingDelegate->getPauseGoalNonEdenRegionBudget(env, _edenRegionsSelected);
+		if (UDATA_MAX != _pauseGoalRegionBudget) {
+			/* older nursery regions are already in the collection set and count against the budget */
+			_pauseGoalRegionBudget -= OMR_MIN(_pauseGoalRegionBudget, _nonEdenRegionsSelected);
+		}
+
 		createRateOfReturnCollectionSet(env, nurseryRegionCount);
 		createCoreSamplingCollectionSet(env, nurseryRegionCount);
 
@@ -444,6 +470,8 @@ MM_ProjectedSurvivalCollectionSetDelegate::createRegionCollectionSetForPartialGC
 			region->setDynamicSelectionNext(NULL);
 		}
 	}
+
+	schedulingDelegate->collectionSetSelected(env, _edenRegionsSelected, _nonEdenRegionsSelected);
 }
 
 void
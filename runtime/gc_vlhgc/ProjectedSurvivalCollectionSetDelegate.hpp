@@ -133,6 +133,10 @@ private:
 
 	MM_HeapRegionDescriptorVLHGC **_dynamicSelectionRegionList;  /**< Pointer table used for sorting or iterating over regions */
 
+	UDATA _edenRegionsSelected;  /**< Number of eden regions selected for the collection set of the PGC being set up */
+	UDATA _nonEdenRegionsSelected;  /**< Number of non-eden regions selected for the collection set of the PGC being set up */
+	UDATA _pauseGoalRegionBudget;  /**< Number of non-eden regions which may still be selected without exceeding the PGC pause goal */
+
 protected:
 public:
 
@@ -480,6 +480,18 @@ MM_ReclaimDelegate::runGlobalSweepBeforePGC(MM_EnvironmentVLHGC *env, MM_Allocat
 	rebuildRegionsSortedByEmptinessArray(env);
 }
 
+bool
+MM_ReclaimDelegate::runConcurrentGlobalSweep(MM_EnvironmentVLHGC *env, volatile bool *forceExit)
+{
+	return _sweepScheme->sweepConcurrent(env, forceExit);
+}
+
+bool
+MM_ReclaimDelegate::isConcurrentGlobalSweepComplete()
+{
+	return _sweepScheme->isConcurrentSweepComplete();
+}
+
 void 
 MM_ReclaimDelegate::untagRegionsAfterSweep()
 {
@@ -491,6 +503,7 @@ MM_ReclaimDelegate::untagRegionsAfterSweep()
 			Assert_MM_true(region->hasValidMarkMap() || region->isFreeOrIdle());
 			region->_sweepData._alreadySwept = true;
 		}
+		region->_sweepData._poolResetConcurrently = false;
 	}
 }
 
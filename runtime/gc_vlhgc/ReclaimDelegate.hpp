@@ -190,6 +190,20 @@ public:
 	 */
 	void runGlobalSweepBeforePGC(MM_EnvironmentVLHGC *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *activeSubSpace, MM_GCCode gcCode);
 
+	/**
+	 * Called by the main GC thread, while mutators are running, to sweep the regions marked by a completed GMP ahead of
+	 * the global sweep run by the next PGC.  That sweep then only has to sweep what remains and connect the free lists.
+	 * @param env[in] The main GC thread
+	 * @param forceExit[in] Set by another thread to request that the sweep stop early
+	 * @return true if every region has been swept, false if the sweep was interrupted
+	 */
+	bool runConcurrentGlobalSweep(MM_EnvironmentVLHGC *env, volatile bool *forceExit);
+
+	/**
+	 * @return true if a concurrent global sweep has swept every region which the next global sweep would sweep
+	 */
+	bool isConcurrentGlobalSweepComplete();
+
 	/**
 	 * Selects regions with the goal of amount of data (in bytes) being compacted.
 	 * Used both for Copy-Forward or Mark-Sweep-Compact
@@ -126,6 +126,11 @@ MM_SchedulingDelegate::MM_SchedulingDelegate (MM_EnvironmentVLHGC *env, MM_HeapR
 	, _pgcCountSinceGMPEnd(0)
 	, _averagePgcInterval(0)
 	, _totalGMPWorkTimeUs(0)
+	, _nonEdenSurvivalRateCopyForward(1.0)
+	, _averageRememberedSetCardsProcessed(0.0)
+	, _averageRememberedSetCardTime(0.0)
+	, _averagePgcFixedTime(0.0)
+	, _pgcPauseTimeCalibrated(false)
 	, _scanRateStats()
 {
 	_typeId = __FUNCTION__;
@@ -413,6 +418,13 @@ MM_SchedulingDelegate::partialGarbageCollectCompleted(MM_EnvironmentVLHGC *env,
 
 	_pgcCountSinceGMPEnd += 1;
 
+	/* the actual time is reported against the prediction for every PGC, including aborted copy-forwards and mark-compacts, but only a clean copy-forward updates the model */
+	uint64_t pgcTimeMicros = j9time_hires_delta(_partialGcStartTime, partialGcEndTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_actualPgcTime = pgcTimeMicros;
+	if (env->_cycleState->_shouldRunCopyForward && !copyForwardStats->_aborted) {
+		updatePgcPauseTimePrediction(env, pgcTimeMicros);
+	}
+
 	/* Check eden size based off of new PGC stats */
 	checkEdenSizeAfterPgc(env, globalSweepHappened);
 	calculateEdenSize(env);
@@ -804,6 +816,109 @@ MM_SchedulingDelegate::predictPgcTime(MM_EnvironmentVLHGC *env, uintptr_t curren
 }
 
 
+double
+MM_SchedulingDelegate::predictPgcPauseTime(MM_EnvironmentVLHGC *env, uintptr_t edenRegionCount, uintptr_t nonEdenRegionCount)
+{
+	/*
+	 * A copy-forward PGC is modelled as a fixed cost (roots, setup, reference processing), plus the time to copy what survives
+	 * the collection set at the observed copy-forward rate, plus the time to process the remembered set of the collection set.
+	 */
+	double regionSize = (double)_regionManager->getRegionSize();
+	double survivorBytes = (((double)edenRegionCount * _edenSurvivalRateCopyForward) + ((double)nonEdenRegionCount * _nonEdenSurvivalRateCopyForward)) * regionSize;
+	double copyTime = survivorBytes / _averageCopyForwardRate;
+	double rememberedSetTime = _averageRememberedSetCardsProcessed * _averageRememberedSetCardTime;
+
+	return _averagePgcFixedTime + copyTime + rememberedSetTime;
+}
+
+intptr_t
+MM_SchedulingDelegate::calculateEdenChangeForPauseGoal(MM_EnvironmentVLHGC *env)
+{
+	double pauseGoal = (double)_extensions->tarokPGCPauseGoal * 1000.0;
+	double regionSize = (double)_regionManager->getRegionSize();
+
+	/* Leave room in the goal for the non-eden regions the collection set typically includes, so that defragmentation is not starved */
+	double nonEdenTime = ((double)_nonEdenSurvivalCountCopyForward * regionSize) / _averageCopyForwardRate;
+	double baseTime = predictPgcPauseTime(env, 0, 0) + nonEdenTime;
+	double timePerEdenRegion = predictPgcPauseTime(env, 1, 0) - predictPgcPauseTime(env, 0, 0);
+
+	intptr_t targetEdenRegionCount = 0;
+	if (pauseGoal > baseTime) {
+		if (timePerEdenRegion > 0.0) {
+			targetEdenRegionCount = (intptr_t)OMR_MIN((pauseGoal - baseTime) / timePerEdenRegion, (double)_maxEdenRegionCount);
+		} else {
+			targetEdenRegionCount = (intptr_t)_maxEdenRegionCount;
+		}
+	}
+
+	/* Only move half way toward the target, so that a single unusual PGC can not swing eden between extremes (min/max eden are applied in adjustIdealEdenRegionCount) */
+	return (targetEdenRegionCount - (intptr_t)_idealEdenRegionCount) / 2;
+}
+
+void
+MM_SchedulingDelegate::updatePgcPauseTimePrediction(MM_EnvironmentVLHGC *env, uint64_t pgcTime)
+{
+	MM_CycleStateVLHGC *cycleState = static_cast<MM_CycleStateVLHGC*>(env->_cycleState);
+	MM_CopyForwardStats *copyForwardStats = &cycleState->_vlhgcIncrementStats._copyForwardStats;
+	MM_InterRegionRememberedSetStats *irrsStats = &cycleState->_vlhgcIncrementStats._irrsStats;
+	uintptr_t regionSize = _regionManager->getRegionSize();
+	const double historicWeight = 0.50; /* arbitrarily give 50% weight to historical result, 50% to newest result */
+
+	if (0 != copyForwardStats->_nonEdenEvacuateRegionCount) {
+		double thisNonEdenSurvivalRate = (double)copyForwardStats->_copyBytesNonEden / (double)(copyForwardStats->_nonEdenEvacuateRegionCount * regionSize);
+		_nonEdenSurvivalRateCopyForward = MM_Math::weightedAverage(_nonEdenSurvivalRateCopyForward, thisNonEdenSurvivalRate, historicWeight);
+	}
+
+	uintptr_t cardsProcessed = irrsStats->_clearFromRegionReferencesCardsProcessed;
+	uint64_t rememberedSetTime = irrsStats->_clearFromRegionReferencesTimesus;
+	_averageRememberedSetCardsProcessed = MM_Math::weightedAverage(_averageRememberedSetCardsProcessed, (double)cardsProcessed, historicWeight);
+	if (0 != cardsProcessed) {
+		_averageRememberedSetCardTime = MM_Math::weightedAverage(_averageRememberedSetCardTime, (double)rememberedSetTime / (double)cardsProcessed, historicWeight);
+	}
+
+	/* Whatever copying and remembered set processing do not explain is attributed to the fixed cost of a PGC */
+	double copyTime = (double)copyForwardStats->_copyBytesTotal / _averageCopyForwardRate;
+	double fixedTime = OMR_MAX(0.0, (double)pgcTime - copyTime - (double)rememberedSetTime);
+	if (_pgcPauseTimeCalibrated) {
+		_averagePgcFixedTime = MM_Math::weightedAverage(_averagePgcFixedTime, fixedTime, historicWeight);
+	} else {
+		_averagePgcFixedTime = fixedTime;
+		_pgcPauseTimeCalibrated = true;
+	}
+}
+
+uintptr_t
+MM_SchedulingDelegate::getPauseGoalNonEdenRegionBudget(MM_EnvironmentVLHGC *env, uintptr_t edenRegionCount)
+{
+	uintptr_t regionBudget = UDATA_MAX;
+
+	if (isPauseGoalEnabled() && _pgcPauseTimeCalibrated && env->_cycleState->_shouldRunCopyForward) {
+		double pauseGoal = (double)_extensions->tarokPGCPauseGoal * 1000.0;
+		double edenTime = predictPgcPauseTime(env, edenRegionCount, 0);
+		double timePerNonEdenRegion = predictPgcPauseTime(env, edenRegionCount, 1) - edenTime;
+
+		if (pauseGoal <= edenTime) {
+			regionBudget = 0;
+		} else if (timePerNonEdenRegion > 0.0) {
+			regionBudget = (uintptr_t)OMR_MIN((pauseGoal - edenTime) / timePerNonEdenRegion, (double)_numberOfHeapRegions);
+		}
+	}
+
+	return regionBudget;
+}
+
+void
+MM_SchedulingDelegate::collectionSetSelected(MM_EnvironmentVLHGC *env, uintptr_t edenRegionCount, uintptr_t nonEdenRegionCount)
+{
+	MM_CycleStateVLHGC *cycleState = static_cast<MM_CycleStateVLHGC*>(env->_cycleState);
+
+	cycleState->_predictedPgcTime = 0;
+	cycleState->_actualPgcTime = 0;
+	if (isPauseGoalEnabled() && _pgcPauseTimeCalibrated && env->_cycleState->_shouldRunCopyForward) {
+		cycleState->_predictedPgcTime = (uint64_t)predictPgcPauseTime(env, edenRegionCount, nonEdenRegionCount);
+	}
+}
+
 uintptr_t
 MM_SchedulingDelegate::estimateGlobalMarkIncrements(MM_EnvironmentVLHGC *env, double liveSetAdjustedForScannableBytesRatio) const
 {
@@ -1438,6 +1553,15 @@ MM_SchedulingDelegate::calculatePercentOfHeapExpanded(MM_EnvironmentVLHGC *env)
 void
 MM_SchedulingDelegate::checkEdenSizeAfterPgc(MM_EnvironmentVLHGC *env, bool globalSweepHappened)
 {
+	if (isPauseGoalEnabled() && _pgcPauseTimeCalibrated) {
+		/* With a pause goal, eden is sized to meet the goal rather than to balance CPU overhead against pause times */
+		if (globalSweepHappened) {
+			resetPgcTimeStatistics(env);
+		}
+		_edenSizeFactor += calculateEdenChangeForPauseGoal(env);
+		return;
+	}
+
 	double ratioOfHeapExpanded = calculatePercentOfHeapExpanded(env);
 
 	double heapFullyExpandedThreshold = 0.9;
@@ -103,6 +103,12 @@ private:
 
 	uint64_t _totalGMPWorkTimeUs; /**< Represents the total time that the previous GMP cycle took. Includes concurrent work, increments of work, and global sweep time  */
 
+	double _nonEdenSurvivalRateCopyForward; /**< The running average ratio of the number of regions consumed to copy-forward non-Eden collection set regions to the number of non-Eden regions in the collection set */
+	double _averageRememberedSetCardsProcessed; /**< Weighted average of remembered set cards processed while clearing from-region references in a copy-forward PGC */
+	double _averageRememberedSetCardTime; /**< Weighted average time spent processing one remembered set card, measured in microseconds */
+	double _averagePgcFixedTime; /**< Weighted average of the part of copy-forward PGC time not explained by copying or remembered set processing (roots, setup, reference processing), measured in microseconds */
+	bool _pgcPauseTimeCalibrated; /**< true once a copy-forward PGC has provided the statistics used by predictPgcPauseTime() */
+
 	struct MM_SchedulingDelegate_ScanRateStats {
 		uintptr_t historicalBytesScanned;		/**< Historical number of bytes scanned for mark operations */
 		uint64_t historicalScanMicroseconds;	/**< Historical scan times for mark operations */
@@ -308,6 +314,35 @@ private:
 	 */
 	intptr_t calculateEdenChangeHeapNotFullyExpanded(MM_EnvironmentVLHGC *env);
 
+	/**
+	 * @return true if eden and collection set sizing should aim for the -XXgc:tarokPGCPauseGoal pause time rather than for CPU overhead
+	 */
+	bool isPauseGoalEnabled() const { return 0 != _extensions->tarokPGCPauseGoal; }
+
+	/**
+	 * Predict how long a copy-forward PGC will take, from the bytes expected to survive the collection set and from
+	 * the remembered set cards which will have to be processed.
+	 * @param env[in] the main GC thread
+	 * @param edenRegionCount the number of eden regions in the collection set
+	 * @param nonEdenRegionCount the number of non-eden regions in the collection set
+	 * @return the predicted PGC time, in microseconds
+	 */
+	double predictPgcPauseTime(MM_EnvironmentVLHGC *env, uintptr_t edenRegionCount, uintptr_t nonEdenRegionCount);
+
+	/**
+	 * Calculates how much eden size should change so that the predicted PGC time meets -XXgc:tarokPGCPauseGoal.
+	 * @param env[in] the main GC thread
+	 * @return by how many regions eden should change
+	 */
+	intptr_t calculateEdenChangeForPauseGoal(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * Following a copy-forward PGC, refine the statistics used by predictPgcPauseTime() with what the PGC actually cost.
+	 * @param env[in] the main GC thread
+	 * @param pgcTime the time the PGC took, in microseconds
+	 */
+	void updatePgcPauseTimePrediction(MM_EnvironmentVLHGC *env, uint64_t pgcTime);
+
 	/**
 	 * Maps a pgc time, to a corresponding GC overhead (as a % of time being active). This is used for calculating hybrid eden overhead.
 	 * Depending on if the heap is fully expanded (ie, heap size >= Xsoftmx), the returned overhead will take a slightly different meaning
@@ -450,6 +485,24 @@ public:
 	 */
 	double getAverageCopyForwardRate() { return _averageCopyForwardRate; }
 
+	/**
+	 * Determine how many non-eden regions the collection set of the upcoming PGC may include and still be predicted to
+	 * complete within -XXgc:tarokPGCPauseGoal.
+	 * @param env[in] the main GC thread
+	 * @param edenRegionCount the number of eden regions already in the collection set
+	 * @return the number of non-eden regions which may be added to the collection set (UDATA_MAX if there is no pause goal)
+	 */
+	uintptr_t getPauseGoalNonEdenRegionBudget(MM_EnvironmentVLHGC *env, uintptr_t edenRegionCount);
+
+	/**
+	 * Record the pause predicted for the PGC about to run once its collection set has been selected, so that it may be
+	 * compared to the actual pause when the PGC completes.
+	 * @param env[in] the main GC thread
+	 * @param edenRegionCount the number of eden regions in the collection set
+	 * @param nonEdenRegionCount the number of non-eden regions in the collection set
+	 */
+	void collectionSetSelected(MM_EnvironmentVLHGC *env, uintptr_t edenRegionCount, uintptr_t nonEdenRegionCount);
+
 	/*
 	 * Returns the scan time cost (in microseconds) we attribute to performing a GMP.  Attempts to
 	 * factor in stop-the-world global mark increment time as well as any concurrent global marking which
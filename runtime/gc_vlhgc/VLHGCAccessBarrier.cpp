@@ -292,6 +292,11 @@ MM_VLHGCAccessBarrier::jniGetPrimitiveArrayCritical(J9VMThread* vmThread, jarray
 
 	if (alwaysCopyInCritical) {
 		copyArrayCritical(vmThread, indexableObjectModel, functions, &data, arrayObject, isCopy);
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	} else if (indexableObjectModel->isOffHeapDataArray(arrayObject)) {
+		/* off heap data never moves, so return it directly without blocking the collector */
+		data = indexableObjectModel->getDataAddrForIndexableObject(arrayObject);
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 	} else if (!indexableObjectModel->isInlineContiguousArraylet(arrayObject)) {
 		/* an array having discontiguous extents is another reason to force the critical section to be a copy */
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
@@ -380,6 +385,14 @@ MM_VLHGCAccessBarrier::jniReleasePrimitiveArrayCritical(J9VMThread* vmThread, ja
 	bool alwaysCopyInCritical = (javaVM->runtimeFlags & J9_RUNTIME_ALWAYS_COPY_JNI_CRITICAL) == J9_RUNTIME_ALWAYS_COPY_JNI_CRITICAL;
 	if (alwaysCopyInCritical) {
 		copyBackArrayCritical(vmThread, indexableObjectModel, functions, elems, &arrayObject, mode);
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	} else if (indexableObjectModel->isOffHeapDataArray(arrayObject)) {
+		/* data was handed out directly, nothing to copy back or release */
+		void *data = indexableObjectModel->getDataAddrForIndexableObject(arrayObject);
+		if (elems != data) {
+			Trc_MM_JNIReleasePrimitiveArrayCritical_invalid(vmThread, arrayObject, elems, data);
+		}
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 	} else if (!indexableObjectModel->isInlineContiguousArraylet(arrayObject)) {
 		/* an array having discontiguous extents is another reason to force the critical section to be a copy */
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
@@ -71,6 +71,9 @@
 #include "ObjectAccessBarrier.hpp"
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ObjectModel.hpp"
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+#include "OffHeapArrayTable.hpp"
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 #include "ParallelDispatcher.hpp"
 #include "PacketSlotIterator.hpp"
 #include "PointerArrayIterator.hpp"
@@ -558,15 +561,17 @@ MM_WriteOnceCompactor::compact(MM_EnvironmentVLHGC *env)
 	env->_compactVLHGCStats._setupEndTime = timeTemp;
 
 	env->_compactVLHGCStats._moveStartTime = timeTemp;
+	/* arraylet leaf contents and the object lists of fully evacuated regions are fixed up by moveObjects, overlapping the evacuation of other regions */
 	moveObjects(env);
 	env->getGCEnvironment()->_ownableSynchronizerObjectBuffer->flush(env);
 	/* Note:  moveObjects implicitly synchronizes threads */
 	timeTemp = j9time_hires_clock();
 	env->_compactVLHGCStats._moveEndTime = timeTemp;
 
+	/* all that remains of the object list fixup is to restore the buffers to a flushed state */
 	env->_compactVLHGCStats._fixupStartTime = timeTemp;
-	/* TODO:  Change statistics since fixup is no longer completely distinct from move */
-	fixupArrayletLeafRegionContentsAndObjectLists(env);
+	env->getGCEnvironment()->_unfinalizedObjectBuffer->flush(env);
+	env->getGCEnvironment()->_continuationObjectBuffer->flush(env);
 	timeTemp = j9time_hires_clock();
 	env->_compactVLHGCStats._fixupEndTime = timeTemp;
 
@@ -911,16 +916,16 @@ MM_WriteOnceCompactor::moveObjects(MM_EnvironmentVLHGC *env)
 			Card *base = cardTable->heapAddrToCardAddr(env, startAddress);
 			Card *top = cardTable->heapAddrToCardAddr(env, endOfExtent);
 			memset(base, CARD_CLEAN, (UDATA)top - (UDATA)base);
+			if (NULL == earlyExit) {
+				/* every object in this region now has its final, fixed up copy so its object lists can be fixed up while other regions are still moving */
+				fixupObjectListsInRegion(env, region);
+			}
+		} else if (region->_compactData._shouldFixup) {
+			/* an arraylet leaf which references the compact set - fix it up while we wait for move work to become available */
+			fixupArrayletLeafRegionContents(env, region);
 		} else if ((MM_CycleState::CT_GLOBAL_GARBAGE_COLLECTION == env->_cycleState->_collectionType) && (region->_criticalRegionsInUse > 0)) {
 			/* in the case of a global collection, mark will have avoided updating the RSCL but this region has pinned objects so the entire region must be walked for fixup */
-			void *lowAddress = region->getLowAddress();
-			void *highAddress = region->getHighAddress();
-			for (void *cardToScan = lowAddress; cardToScan < highAddress; cardToScan = (void *)((UDATA)cardToScan + CARD_SIZE)) {
-				/* clear the card table under the region - we will rebuild it as we fixup */
-				Card *base = cardTable->heapAddrToCardAddr(env, cardToScan);
-				*base = CARD_CLEAN;
-				fixupObjectsInRange(env, cardToScan, (void *)((UDATA)cardToScan + CARD_SIZE), false);
-			}
+			fixupAllObjectsInNonMovingRegion(env, region);
 		} else {
 			/* there is some fixup work to do while we wait for move work to become available.  Clean cards for this subarea */
 			MM_WriteOnceFixupCardCleaner cardCleaner(this, env->_cycleState, _regionManager);
@@ -1381,7 +1386,7 @@ MM_WriteOnceCompactor::fixupPointerArrayObject(MM_EnvironmentVLHGC* env, J9Objec
 	/* object may have moved so ensure that its class loader knows where it is */
 	_extensions->classLoaderRememberedSet->rememberInstance(env, objectPtr);
 
-	/* arraylet leaves are walked separately in fixupArrayletLeafRegionContentsAndObjectLists(), to increase parallelism. Just walk the spine */
+	/* arraylet leaves are walked separately in fixupArrayletLeafRegionContents(), to increase parallelism. Just walk the spine */
 	GC_ArrayletObjectModel::ArrayLayout layout = _extensions->indexableObjectModel.getArrayLayout((J9IndexableObject*)objectPtr);
 		
 	if (GC_ArrayletObjectModel::InlineContiguous == layout) {
@@ -1610,6 +1615,14 @@ MM_WriteOnceCompactor::tagArrayletLeafRegionsForFixup(MM_EnvironmentVLHGC *env)
 						Assert_MM_unreachable();
 					}
 				}
+				if (region->_compactData._shouldFixup) {
+					/* leaf contents only depend on the compact table so they are fixed up by the move phase while other regions are still moving.
+					 * No other thread touches the work lists until the move starts (after planning synchronizes the threads) so no lock is required.
+					 */
+					Assert_MM_true(NULL == region->_compactData._nextInWorkList);
+					region->_compactData._nextInWorkList = _fixupOnlyWorkList;
+					_fixupOnlyWorkList = region;
+				}
 			}
 		}
 	}
@@ -1650,6 +1663,11 @@ public:
 #if defined(J9VM_OPT_JVMTI)
 		scanJVMTIObjectTagTables(env);
 #endif /* J9VM_OPT_JVMTI */
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+		if (_includeOffHeapArrays) {
+			scanOffHeapArrays(env);
+		}
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
 
 	}
 	
@@ -1664,6 +1682,14 @@ public:
 		}
 	}
 
+#if defined(J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION)
+	virtual void doOffHeapArraySlot(MM_OffHeapArrayEntry *entry, GC_HashTableIterator *offHeapArrayIterator)
+	{
+		/* dead spines were released while clearing roots, only the owner needs to follow the spine */
+		doSlot(&entry->proxyObject);
+	}
+#endif /* J9VM_GC_ENABLE_SPARSE_HEAP_ALLOCATION */
+
 	virtual void doClass(J9Class *clazz)
 	{
 		/* classes are fixed up as part of normal object fixup */
@@ -1991,80 +2017,85 @@ MM_WriteOnceCompactor::fixupArrayletLeafRegionSpinePointers()
 }
 
 void
-MM_WriteOnceCompactor::fixupArrayletLeafRegionContentsAndObjectLists(MM_EnvironmentVLHGC* env)
+MM_WriteOnceCompactor::fixupArrayletLeafRegionContents(MM_EnvironmentVLHGC* env, MM_HeapRegionDescriptorVLHGC *region)
 {
+	Assert_MM_true(region->isArrayletLeaf());
 	bool const compressed = env->compressObjectReferences();
-	GC_HeapRegionIteratorVLHGC regionIterator(_regionManager);
-	MM_HeapRegionDescriptorVLHGC *region = NULL;
-	
-	while(NULL != (region = regionIterator.nextRegion())) {
-		if (region->_compactData._shouldFixup) {  
-			Assert_MM_true(region->isArrayletLeaf());
-			J9Object* spineObject = (J9Object*)region->_allocateData.getSpine();
-			Assert_MM_true(NULL != spineObject);
+	J9Object* spineObject = (J9Object*)region->_allocateData.getSpine();
+	Assert_MM_true(NULL != spineObject);
 
-			/* spine objects get fixed up later in fixupArrayletLeafRegionSpinePointers(), after a sync point */
-			spineObject = getForwardingPtr(spineObject);
-
-			fj9object_t* slotPointer = (fj9object_t*)region->getLowAddress();
-			fj9object_t* endOfLeaf = (fj9object_t*)region->getHighAddress();
-			while (slotPointer < endOfLeaf) {
-				/* TODO: 4096 elements is an arbitrary number */
-				fj9object_t* endPointer = GC_SlotObject::addToSlotAddress(slotPointer, 4096, compressed);
-				if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-					while (slotPointer < endPointer) {
-						GC_SlotObject slotObject(_javaVM->omrVM, slotPointer);
-						J9Object *pointer = slotObject.readReferenceFromSlot();
-						if (NULL != pointer) {
-							J9Object *forwardedPtr = getForwardingPtr(pointer);
-							slotObject.writeReferenceToSlot(forwardedPtr);
-							_interRegionRememberedSet->rememberReferenceForCompact(env, spineObject, forwardedPtr);
-						}
-						slotPointer = GC_SlotObject::addToSlotAddress(slotPointer, 1, compressed);
-					}
-				}
-				slotPointer = endPointer;
-			}
-				
-			/* prove we didn't miss anything at the end */
-			Assert_MM_true(slotPointer == endOfLeaf);
-		} else if (region->_compactData._shouldCompact) {
-			if (!region->getUnfinalizedObjectList()->wasEmpty()) {
-				if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-					J9Object *pointer = region->getUnfinalizedObjectList()->getPriorList();
-					while (NULL != pointer) {
-						Assert_MM_true(region->isAddressInRegion(pointer));
-						J9Object* forwardedPtr = getForwardingPtr(pointer);
-
-						/* read the next link out of the moved copy of the object before we add it to the buffer */
-						pointer = _extensions->accessBarrier->getFinalizeLink(forwardedPtr);
-
-						/* store the object in this thread's buffer. It will be flushed to the appropriate list when necessary. */
-						env->getGCEnvironment()->_unfinalizedObjectBuffer->add(env, forwardedPtr);
-					}
-				}
-			}
-			if (!region->getContinuationObjectList()->wasEmpty()) {
-				if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-					J9Object *pointer = region->getContinuationObjectList()->getPriorList();
-					while (NULL != pointer) {
-						Assert_MM_true(region->isAddressInRegion(pointer));
-						J9Object* forwardedPtr = getForwardingPtr(pointer);
-
-						/* read the next link out of the moved copy of the object before we add it to the buffer */
-						pointer = _extensions->accessBarrier->getContinuationLink(forwardedPtr);
-
-						/* store the object in this thread's buffer. It will be flushed to the appropriate list when necessary. */
-						env->getGCEnvironment()->_continuationObjectBuffer->add(env, forwardedPtr);
-					}
-				}
-			}
+	/* spine objects get fixed up later in fixupArrayletLeafRegionSpinePointers(), after a sync point */
+	spineObject = getForwardingPtr(spineObject);
+
+	fj9object_t* slotPointer = (fj9object_t*)region->getLowAddress();
+	fj9object_t* endOfLeaf = (fj9object_t*)region->getHighAddress();
+	while (slotPointer < endOfLeaf) {
+		GC_SlotObject slotObject(_javaVM->omrVM, slotPointer);
+		J9Object *pointer = slotObject.readReferenceFromSlot();
+		if (NULL != pointer) {
+			J9Object *forwardedPtr = getForwardingPtr(pointer);
+			slotObject.writeReferenceToSlot(forwardedPtr);
+			_interRegionRememberedSet->rememberReferenceForCompact(env, spineObject, forwardedPtr);
 		}
+		slotPointer = GC_SlotObject::addToSlotAddress(slotPointer, 1, compressed);
 	}
 
-	/* restore everything to a flushed state before exiting */
-	env->getGCEnvironment()->_unfinalizedObjectBuffer->flush(env);
-	env->getGCEnvironment()->_continuationObjectBuffer->flush(env);
+	/* prove we didn't miss anything at the end */
+	Assert_MM_true(slotPointer == endOfLeaf);
+}
+
+void
+MM_WriteOnceCompactor::fixupObjectListsInRegion(MM_EnvironmentVLHGC* env, MM_HeapRegionDescriptorVLHGC *region)
+{
+	Assert_MM_true(region->_compactData._shouldCompact);
+	Assert_MM_true(region->_compactData._nextEvacuationCandidate >= region->getHighAddress());
+
+	if (!region->getUnfinalizedObjectList()->wasEmpty()) {
+		J9Object *pointer = region->getUnfinalizedObjectList()->getPriorList();
+		while (NULL != pointer) {
+			Assert_MM_true(region->isAddressInRegion(pointer));
+			J9Object* forwardedPtr = getForwardingPtr(pointer);
+
+			/* read the next link out of the moved copy of the object before we add it to the buffer */
+			pointer = _extensions->accessBarrier->getFinalizeLink(forwardedPtr);
+
+			/* store the object in this thread's buffer. It will be flushed to the appropriate list when necessary. */
+			env->getGCEnvironment()->_unfinalizedObjectBuffer->add(env, forwardedPtr);
+		}
+	}
+	if (!region->getContinuationObjectList()->wasEmpty()) {
+		J9Object *pointer = region->getContinuationObjectList()->getPriorList();
+		while (NULL != pointer) {
+			Assert_MM_true(region->isAddressInRegion(pointer));
+			J9Object* forwardedPtr = getForwardingPtr(pointer);
+
+			/* read the next link out of the moved copy of the object before we add it to the buffer */
+			pointer = _extensions->accessBarrier->getContinuationLink(forwardedPtr);
+
+			/* store the object in this thread's buffer. It will be flushed to the appropriate list when necessary. */
+			env->getGCEnvironment()->_continuationObjectBuffer->add(env, forwardedPtr);
+		}
+	}
+}
+
+void
+MM_WriteOnceCompactor::fixupAllObjectsInNonMovingRegion(MM_EnvironmentVLHGC *env, MM_HeapRegionDescriptorVLHGC *region)
+{
+	Assert_MM_false(region->_compactData._shouldCompact);
+	MM_CardTable *cardTable = _extensions->cardTable;
+	void *lowAddress = region->getLowAddress();
+	void *highAddress = region->getHighAddress();
+	/* clear the card table under the region - we will rebuild it as we fixup */
+	Card *base = cardTable->heapAddrToCardAddr(env, lowAddress);
+	Card *top = cardTable->heapAddrToCardAddr(env, highAddress);
+	memset(base, CARD_CLEAN, (UDATA)top - (UDATA)base);
+
+	/* this region isn't tail-marked so the map iterator can skip unmarked words and the interiors of large objects in bulk instead of probing each card */
+	MM_HeapMapIterator markedObjectIterator(_extensions, _cycleState._markMap, (UDATA *)lowAddress, (UDATA *)highAddress);
+	J9Object *fromObject = NULL;
+	while (NULL != (fromObject = markedObjectIterator.nextObject())) {
+		fixupObject(env, fromObject, NULL);
+	}
 }
 
 void
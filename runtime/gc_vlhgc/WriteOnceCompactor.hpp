@@ -115,7 +115,7 @@ private:
 	omrthread_monitor_t _workListMonitor;  /**< The monitor used to control work sharing of object movement/fixup tasks */
 	MM_HeapRegionDescriptorVLHGC *_readyWorkList;  /**< The root of the list of regions which can have some work done on them */
 	MM_HeapRegionDescriptorVLHGC *_readyWorkListHighPriority;  /**< Like _readyWorkList but is higher priority as it only contains regions which are compact destinations (that is, they block other move operations) */
-	MM_HeapRegionDescriptorVLHGC *_fixupOnlyWorkList;  /**< The root of the list of regions which must have their cards cleaned in order to fixup references into the compact set */
+	MM_HeapRegionDescriptorVLHGC *_fixupOnlyWorkList;  /**< The root of the list of regions which must have their cards cleaned (or arraylet leaf contents fixed up) in order to fixup references into the compact set */
 	MM_HeapRegionDescriptorVLHGC *_rebuildWorkList;  /**< The root of the list of regions which must have their previous mark map extents rebuilt (this list is built as the object movement phase completes) */
 	MM_HeapRegionDescriptorVLHGC *_rebuildWorkListHighPriority;	/**< Like _rebuildWorkList but is higher priority as it only contains regions which are compact destinations (that is, they block other rebuild operations) */
 	UDATA _threadsWaiting;  /**< The number of threads waiting for work on _workListMonitor */
@@ -257,14 +257,32 @@ private:
 	void fixupArrayletLeafRegionSpinePointers();
 	
 	/**
-	 * Fix up the data in required arraylet leaf regions, unfinalized lists and ownable synchronizer lists.
+	 * Fix up the references stored in an arraylet leaf region tagged for fixup.
+	 * This only relies on the compact table so it is called from the move phase, while other regions are still being evacuated.
 	 * @param env[in] the current thread
+	 * @param region[in] the arraylet leaf region to fix up
 	 */
-	void fixupArrayletLeafRegionContentsAndObjectLists(MM_EnvironmentVLHGC* env);
+	void fixupArrayletLeafRegionContents(MM_EnvironmentVLHGC* env, MM_HeapRegionDescriptorVLHGC *region);
+
+	/**
+	 * Fix up the unfinalized and continuation lists of a compacted region by buffering the moved copies of their objects.
+	 * The region must be fully evacuated since the list links are read from the moved copies.
+	 * @param env[in] the current thread
+	 * @param region[in] the fully evacuated region
+	 */
+	void fixupObjectListsInRegion(MM_EnvironmentVLHGC* env, MM_HeapRegionDescriptorVLHGC *region);
+
+	/**
+	 * Fix up every live object in a region which is not being compacted, rebuilding its card table state as we go.
+	 * Used for regions whose remembered state can't be trusted (pinned regions in a global collection).
+	 * @param env[in] A GC thread
+	 * @param region[in] the region to fix up
+	 */
+	void fixupAllObjectsInNonMovingRegion(MM_EnvironmentVLHGC *env, MM_HeapRegionDescriptorVLHGC *region);
 	
 	/**
-	 * Identify any arraylet leaf regions which require fix up and tag them using the _shouldFixup flag.
-	 * This must be called by only one GC thread.
+	 * Identify any arraylet leaf regions which require fix up, tag them using the _shouldFixup flag and add them to the fixup only work list.
+	 * This must be called by only one GC thread, before the move phase starts.
 	 * @param env[in] A GC thread
 	 */
 	void tagArrayletLeafRegionsForFixup(MM_EnvironmentVLHGC* env);
@@ -32,6 +32,56 @@
 #include "ut_j9jcl.h"
 #include "vmaccess.h"
 
+typedef struct J9GetStackTraceForThreadData {
+	J9VMThread *requestingThread;
+	J9StackWalkState *walkState;
+	UDATA skipCount;
+	BOOLEAN isVirtual;
+	BOOLEAN unmounted;
+	UDATA rc;
+} J9GetStackTraceForThreadData;
+
+static void walkStackForThreadHandshake(J9VMThread *currentThread, J9VMThread *targetThread, void *userData);
+
+/**
+ * Thread handshake function which caches the PCs of the target thread's stack.
+ * Runs either on the target thread at a safe point, or on the requesting thread
+ * while the target thread is halted.
+ * @param[in] currentThread the thread running the handshake
+ * @param[in] targetThread the thread whose stack is walked
+ * @param[in] userData the J9GetStackTraceForThreadData for the request
+ */
+static void
+walkStackForThreadHandshake(J9VMThread *currentThread, J9VMThread *targetThread, void *userData)
+{
+	J9GetStackTraceForThreadData *data = (J9GetStackTraceForThreadData *)userData;
+	J9JavaVM *vm = currentThread->javaVM;
+	J9StackWalkState *walkState = data->walkState;
+
+#if JAVA_SPEC_VERSION >= 19
+	/* The requesting thread keeps VM access until the walk completes, so the thread object in its special frame stays valid. */
+	j9object_t threadObject = PEEK_OBJECT_IN_SPECIAL_FRAME(data->requestingThread, 0);
+	/* Re-check thread state. */
+	if ((NULL != targetThread->currentContinuation) && (threadObject == targetThread->carrierThreadObject)) {
+		/* If targetThread has a continuation mounted and its threadObject matches its carrierThreadObject,
+		 * then the carrier thread's stacktrace is retrieved through the cached state in the continuation.
+		 */
+		walkState->skipCount = 0;
+		data->rc = vm->internalVMFunctions->walkContinuationStackFrames(currentThread, targetThread->currentContinuation, threadObject, walkState);
+	} else if (data->isVirtual && (threadObject != targetThread->threadObject)) {
+		/* If the virtual thread object doesn't match the current thread object, it must have unmounted
+		 * from this carrier thread, return NULL and the JCL code will handle the retry.
+		 */
+		data->unmounted = TRUE;
+	} else
+#endif /* JAVA_SPEC_VERSION >= 19 */
+	{
+		walkState->walkThread = targetThread;
+		walkState->skipCount = data->skipCount;
+		data->rc = vm->walkStackFrames(currentThread, walkState);
+	}
+}
+
 /**
  * Creates a throwable object containing the stacktrace of threadObject.
  * @param[in] currentThread
@@ -47,11 +97,16 @@ getStackTraceForThread(J9VMThread *currentThread, J9VMThread *targetThread, UDAT
 	J9InternalVMFunctions * vmfns = vm->internalVMFunctions;
 	j9object_t throwable = NULL;
 	J9StackWalkState walkState = {0};
-	UDATA rc = J9_STACKWALK_RC_NONE;
+	J9GetStackTraceForThreadData data = {0};
+
+	data.requestingThread = currentThread;
+	data.walkState = &walkState;
+	data.skipCount = skipCount;
+	data.rc = J9_STACKWALK_RC_NONE;
 
 #if JAVA_SPEC_VERSION >= 19
-	BOOLEAN isVirtual = IS_JAVA_LANG_VIRTUALTHREAD(currentThread, threadObject);
-	if (isVirtual) {
+	data.isVirtual = IS_JAVA_LANG_VIRTUALTHREAD(currentThread, threadObject);
+	if (data.isVirtual) {
 		/* Return NULL if a valid CarrierThread object cannot be found through VirtualThread object,
 		 * the caller of getStackTraceImpl will handle whether to retry or get the stack using the unmounted path.
 		 */
@@ -66,38 +121,20 @@ getStackTraceForThread(J9VMThread *currentThread, J9VMThread *targetThread, UDAT
 	}
 	PUSH_OBJECT_IN_SPECIAL_FRAME(currentThread, threadObject);
 #endif /* JAVA_SPEC_VERSION >= 19 */
-	/* Halt the target thread. */
-	vmfns->haltThreadForInspection(currentThread, targetThread);
 
-	/* walk stack and cache PCs. */
+	/* walk stack and cache PCs once the target thread is at a safe point. */
 	walkState.flags = J9_STACKWALK_CACHE_PCS | J9_STACKWALK_WALK_TRANSLATE_PC | J9_STACKWALK_SKIP_INLINES | J9_STACKWALK_INCLUDE_NATIVES | J9_STACKWALK_VISIBLE_ONLY;
+	vmfns->executeThreadHandshake(currentThread, targetThread, walkStackForThreadHandshake, &data);
+
 #if JAVA_SPEC_VERSION >= 19
-	threadObject = POP_OBJECT_IN_SPECIAL_FRAME(currentThread);
-	/* Re-check thread state. */
-	if ((NULL != targetThread->currentContinuation) && (threadObject == targetThread->carrierThreadObject)) {
-		/* If targetThread has a continuation mounted and its threadObject matches its carrierThreadObject,
-		 * then the carrier thread's stacktrace is retrieved through the cached state in the continuation.
-		 */
-		walkState.skipCount = 0;
-		rc = vmfns->walkContinuationStackFrames(currentThread, targetThread->currentContinuation, threadObject, &walkState);
-	} else if (isVirtual && (threadObject != targetThread->threadObject)) {
-		/* If the virtual thread object doesn't match the current thread object, it must have unmounted
-		 * from this carrier thread, return NULL and the JCL code will handle the retry.
-		 */
-		vmfns->resumeThreadForInspection(currentThread, targetThread);
+	DROP_OBJECT_IN_SPECIAL_FRAME(currentThread);
+	if (data.unmounted) {
 		goto done;
-	} else
-#endif /* JAVA_SPEC_VERSION >= 19 */
-	{
-		walkState.walkThread = targetThread;
-		walkState.skipCount = skipCount;
-		rc = vm->walkStackFrames(currentThread, &walkState);
 	}
-	/* Now that the stack trace has been copied, resume the thread. */
-	vmfns->resumeThreadForInspection(currentThread, targetThread);
+#endif /* JAVA_SPEC_VERSION >= 19 */
 
 	/* Check for stack walk failure. */
-	if (rc != J9_STACKWALK_RC_NONE) {
+	if (data.rc != J9_STACKWALK_RC_NONE) {
 		vmfns->setNativeOutOfMemoryError(currentThread, 0, 0);
 		goto fail;
 	}
@@ -536,6 +536,36 @@ Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getCurrentGCThreadsI
 	return result;
 }
 
+jlong JNICALL
+Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getIdleResidentSetReductionImpl(JNIEnv *env, jobject beanInstance)
+{
+	J9JavaVM *javaVM = ((J9VMThread *) env)->javaVM;
+	U_64 cycleCount = 0;
+	U_64 lastRSSReduction = 0;
+	U_64 totalRSSReduction = 0;
+
+	if (0 == javaVM->memoryManagerFunctions->j9gc_get_idle_rss_statistics(javaVM, &cycleCount, &lastRSSReduction, &totalRSSReduction)) {
+		/* idle tuning is not active for this GC policy */
+		return -1;
+	}
+	return (jlong)totalRSSReduction;
+}
+
+jlong JNICALL
+Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getLastIdleResidentSetReductionImpl(JNIEnv *env, jobject beanInstance)
+{
+	J9JavaVM *javaVM = ((J9VMThread *) env)->javaVM;
+	U_64 cycleCount = 0;
+	U_64 lastRSSReduction = 0;
+	U_64 totalRSSReduction = 0;
+
+	if (0 == javaVM->memoryManagerFunctions->j9gc_get_idle_rss_statistics(javaVM, &cycleCount, &lastRSSReduction, &totalRSSReduction)) {
+		/* idle tuning is not active for this GC policy */
+		return -1;
+	}
+	return (jlong)lastRSSReduction;
+}
+
 /* Implementation of the main loop of a thread that processes and dispatches memory usage notifications to Java handlers. */
 void JNICALL
 Java_com_ibm_lang_management_internal_MemoryNotificationThread_processNotificationLoop(JNIEnv *env, jobject threadInstance)
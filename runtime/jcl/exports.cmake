@@ -48,6 +48,8 @@ omr_add_exports(jclse
 	Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getGCModeImpl
 	Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getGCWorkerThreadsCpuUsedImpl
 	Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getHeapMemoryUsageImpl
+	Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getIdleResidentSetReductionImpl
+	Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getLastIdleResidentSetReductionImpl
 	Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getMaxHeapSizeImpl
 	Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getMaxHeapSizeLimitImpl
 	Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getMaximumGCThreadsImpl
@@ -158,19 +158,9 @@ jitGetInterfaceVTableOffsetFromCP(J9VMThread *currentThread, J9ConstantPool *con
 	UDATA iTableIndex = 0;
 	J9Class *interfaceClass = jitGetInterfaceITableIndexFromCP(currentThread, constantPool, cpIndex, &iTableIndex);
 	if (NULL != interfaceClass) {
-		J9ITable * iTable = lookupClass->lastITable;
-		if (interfaceClass == iTable->interfaceClass) {
-			goto foundITable;
-		}
-		iTable = (J9ITable*)lookupClass->iTable;
-		while (NULL != iTable) {
-			if (interfaceClass == iTable->interfaceClass) {
-				lookupClass->lastITable = iTable;
-foundITable:
-				vTableOffset = ((UDATA*)(iTable + 1))[iTableIndex];
-				break;
-			}
-			iTable = iTable->next;
+		J9ITable * iTable = VM_VMHelpers::findITable(lookupClass, interfaceClass);
+		if (NULL != iTable) {
+			vTableOffset = ((UDATA*)(iTable + 1))[iTableIndex];
 		}
 	}
 	return vTableOffset;
@@ -61,6 +61,7 @@ static UDATA jniIsWeakGlobalRef (JNIEnv* env, jobject reference);
 static UDATA jniIsLocalRef (JNIEnv * currentEnv, JNIEnv* env, jobject reference);
 static UDATA jniIsLocalRefFrameWalkFunction (J9VMThread* aThread, J9StackWalkState* walkState);
 static void fillInLocalRefTracking (JNIEnv* env, J9JniCheckLocalRefState* refTracking);
+static UDATA countLiveGlobalRefs (J9JavaVM* vm);
 static const char* getRefType (JNIEnv* env, jobject reference);
 static void jniCheckScalarArgA (const char* function, JNIEnv* env, jvalue* arg, char code, UDATA argNum, UDATA trace);
 static void jniCheckScalarArg (const char* function, JNIEnv* env, va_list* va, char code, UDATA argNum, UDATA trace);
@@ -1256,8 +1257,8 @@ jniIsGlobalRef(JNIEnv* env, jobject reference)
 #ifdef J9VM_THR_PREEMPTIVE
 	omrthread_monitor_enter(vm->jniFrameMutex);
 #endif
-	/* walk the JNIGlobalReferences pool */
-	rc = pool_includesElement(vm->jniGlobalReferences, reference);
+	/* walk the JNIGlobalReferences pool; free slots cached by the threads are in the pool too, but hold NULL */
+	rc = pool_includesElement(vm->jniGlobalReferences, reference) && (NULL != *(j9object_t *)reference);
 #ifdef J9VM_THR_PREEMPTIVE
 	omrthread_monitor_exit(vm->jniFrameMutex);
 #endif
@@ -1691,8 +1692,12 @@ void jniCheckLocalRefTracking(JNIEnv* env, const char* function, J9JniCheckLocal
 
 	fillInLocalRefTracking(env, &currentState);
 
-	/* check the global pools first */
-	if (currentState.globalRefCapacity > savedState->globalRefCapacity) {
+	/* check the global pools first. Threads cache free global ref slots, which hold NULL, so the pool
+	 * may grow to refill a cache without any new refs: only warn if the live refs outgrew the old capacity.
+	 */
+	if ((currentState.globalRefCapacity > savedState->globalRefCapacity)
+		&& (countLiveGlobalRefs(vm) > savedState->globalRefCapacity)
+	) {
 		jniCheckWarningNLS(J9NLS_JNICHK_GREW_GLOBAL_REF_POOL,
 			function,
 			savedState->globalRefCapacity,
@@ -1727,6 +1732,33 @@ void jniCheckLocalRefTracking(JNIEnv* env, const char* function, J9JniCheckLocal
 }
 
 
+/*
+ * Count the strong global refs in use, excluding the free slots cached by threads.
+ */
+static UDATA
+countLiveGlobalRefs(J9JavaVM* vm)
+{
+	pool_state poolState;
+	j9object_t *slot = NULL;
+	UDATA count = 0;
+
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+	slot = pool_startDo(vm->jniGlobalReferences, &poolState);
+	while (NULL != slot) {
+		if (NULL != *slot) {
+			count += 1;
+		}
+		slot = pool_nextDo(&poolState);
+	}
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_exit(vm->jniFrameMutex);
+#endif
+
+	return count;
+}
+
 static void fillInLocalRefTracking(JNIEnv* env, J9JniCheckLocalRefState* refTracking) {
 	J9VMThread *vmThread = (J9VMThread*)env;
 	J9SFJNINativeMethodFrame* frame;
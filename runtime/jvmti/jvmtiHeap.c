@@ -98,12 +98,24 @@ typedef struct J9JVMTIHeapData {
 	const jvmtiHeapCallbacks *callbacks;
 } J9JVMTIHeapData;
 
+/**
+ * Per-worker results of the parallel class-filtered heap walk used by IterateThroughHeap
+ */
+typedef struct J9JVMTIHeapInstanceCollector {
+	J9Class *classFilter;
+	J9Pool **instances; /**< one pool of j9object_t per GC worker */
+	UDATA workerCount;
+} J9JVMTIHeapInstanceCollector;
+
 
 
 
 static UDATA copyObjectTags (J9JVMTIObjectTag * entry, J9JVMTIObjectTagMatch * results);
 static UDATA countObjectTags (J9JVMTIObjectTag * entry, J9JVMTIObjectTagMatch * results);
 static jvmtiIterationControl iterateThroughHeapCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDesc, void * userData);
+static int compareObjectAddresses(const void *left, const void *right);
+static jvmtiIterationControl collectClassInstancesCallback(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, UDATA workerID, void *userData);
+static BOOLEAN iterateThroughHeapParallel(J9VMThread *currentThread, J9JVMTIHeapData *iteratorData);
 
 static jvmtiIterationControl wrap_heapReferenceCallback(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
 static jvmtiIterationControl wrap_heapIterationCallback(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
@@ -1323,8 +1335,11 @@ jvmtiError JNICALL jvmtiIterateThroughHeap(jvmtiEnv* env,
 		vmFuncs->acquireExclusiveVMAccess(currentThread);
 		ensureHeapWalkable(currentThread);
 
-		/* Walk the heap */
-		vm->memoryManagerFunctions->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, &iteratorData);
+		/* Walk the heap. A class filter usually selects a small fraction of the heap, so find the
+		 * instances on the GC worker threads and only deliver the callbacks on this thread. */
+		if ((NULL == iteratorData.classFilter) || !iterateThroughHeapParallel(currentThread, &iteratorData)) {
+			vm->memoryManagerFunctions->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, &iteratorData);
+		}
 		rc = iteratorData.rc;
 
 		vmFuncs->releaseExclusiveVMAccess(currentThread);
@@ -1340,6 +1355,143 @@ done:
 
 
 
+/**
+ * \brief      Find the instances of the class filter using the parallel heap walk, then report them
+ * \ingroup    jvmti.heap
+ *
+ * Agent callbacks are still issued serially on the current thread; only the search is parallel. The
+ * instances are sorted by address before they are reported, so the agent sees them in the same order
+ * as the serial heap walk.
+ *
+ * @param[in] currentThread  current thread, holding exclusive VM access
+ * @param[in] iteratorData   iteration data with a non-NULL classFilter
+ * @return                   TRUE if the instances were reported, FALSE if the caller must fall back to the serial walk
+ */
+static BOOLEAN
+iterateThroughHeapParallel(J9VMThread *currentThread, J9JVMTIHeapData *iteratorData)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9MemoryManagerFunctions const *mmFuncs = vm->memoryManagerFunctions;
+	J9JVMTIHeapInstanceCollector collector;
+	BOOLEAN reported = FALSE;
+	BOOLEAN collected = TRUE;
+	UDATA i = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (!mmFuncs->j9mm_is_parallel_walk_possible(currentThread)) {
+		return FALSE;
+	}
+
+	collector.classFilter = iteratorData->classFilter;
+	collector.workerCount = mmFuncs->j9mm_get_parallel_walk_thread_count(vm);
+	collector.instances = j9mem_allocate_memory(sizeof(J9Pool *) * collector.workerCount, J9MEM_CATEGORY_JVMTI);
+	if (NULL == collector.instances) {
+		return FALSE;
+	}
+	for (i = 0; i < collector.workerCount; i++) {
+		collector.instances[i] = pool_new(sizeof(j9object_t), 0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_JVMTI, POOL_FOR_PORT(PORTLIB));
+		if (NULL == collector.instances[i]) {
+			collected = FALSE;
+		}
+	}
+
+	/* the walk only aborts if an instance could not be recorded */
+	if (collected && (JVMTI_ITERATION_CONTINUE == mmFuncs->j9mm_iterate_all_objects_parallel(currentThread, PORTLIB, 0, collectClassInstancesCallback, &collector))) {
+		UDATA instanceCount = 0;
+		j9object_t *sortedInstances = NULL;
+
+		for (i = 0; i < collector.workerCount; i++) {
+			instanceCount += pool_numElements(collector.instances[i]);
+		}
+		sortedInstances = j9mem_allocate_memory(sizeof(j9object_t) * (instanceCount + 1), J9MEM_CATEGORY_JVMTI);
+		if (NULL != sortedInstances) {
+			UDATA count = 0;
+
+			/* the workers claim regions in an arbitrary order, restore the heap order of the serial walk */
+			for (i = 0; i < collector.workerCount; i++) {
+				pool_state poolState;
+				j9object_t *instance = pool_startDo(collector.instances[i], &poolState);
+				while (NULL != instance) {
+					sortedInstances[count++] = *instance;
+					instance = pool_nextDo(&poolState);
+				}
+			}
+			J9_SORT(sortedInstances, instanceCount, sizeof(j9object_t), compareObjectAddresses);
+
+			for (count = 0; count < instanceCount; count++) {
+				J9MM_IterateObjectDescriptor objectDesc;
+				mmFuncs->j9mm_initialize_object_descriptor(vm, &objectDesc, sortedInstances[count]);
+				if (JVMTI_ITERATION_ABORT == iterateThroughHeapCallback(vm, &objectDesc, iteratorData)) {
+					break;
+				}
+			}
+			j9mem_free_memory(sortedInstances);
+			reported = TRUE;
+		}
+	}
+
+	for (i = 0; i < collector.workerCount; i++) {
+		if (NULL != collector.instances[i]) {
+			pool_kill(collector.instances[i]);
+		}
+	}
+	j9mem_free_memory(collector.instances);
+
+	return reported;
+}
+
+
+/**
+ * \brief      Order objects by address
+ * \ingroup    jvmti.heap
+ *
+ * @param[in] left   pointer to the first <code>j9object_t</code>
+ * @param[in] right  pointer to the second <code>j9object_t</code>
+ * @return           negative, zero or positive as the first object is below, at or above the second
+ */
+static int
+compareObjectAddresses(const void *left, const void *right)
+{
+	UDATA leftAddress = (UDATA)*(j9object_t const *)left;
+	UDATA rightAddress = (UDATA)*(j9object_t const *)right;
+
+	if (leftAddress < rightAddress) {
+		return -1;
+	}
+	if (leftAddress > rightAddress) {
+		return 1;
+	}
+	return 0;
+}
+
+
+/**
+ * \brief      Parallel heap walk callback recording the instances of the class filter
+ * \ingroup    jvmti.heap
+ *
+ * @param[in] vm
+ * @param[in] objectDesc  object being walked
+ * @param[in] workerID    GC worker walking the object, selects the result pool
+ * @param[in] userData    our private data, cast it to <code>J9JVMTIHeapInstanceCollector</code>
+ * @return                JVMTI_ITERATION_ABORT if the instance could not be recorded
+ */
+static jvmtiIterationControl
+collectClassInstancesCallback(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, UDATA workerID, void *userData)
+{
+	J9JVMTIHeapInstanceCollector *collector = userData;
+	j9object_t object = objectDesc->object;
+
+	if (collector->classFilter == J9OBJECT_CLAZZ_VM(vm, object)) {
+		j9object_t *slot = pool_newElement(collector->instances[workerID]);
+		if (NULL == slot) {
+			return JVMTI_ITERATION_ABORT;
+		}
+		*slot = object;
+	}
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+
 /** 
  * \brief      Heap Iteration callback
  * \ingroup    jvmti.heap
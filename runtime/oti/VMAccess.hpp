@@ -421,7 +421,10 @@ public:
 	/**
 	 * Set halt flags with the intention of forcing the target thread to give up VM access.
 	 * Appropriate barriers are issued based on the kind of VM access rules determined
-	 * by compile-time flags.
+	 * by compile-time flags. The publicFlagsMutex of the thread is notified in case it is
+	 * waiting with VM access in executeThreadHandshake.
+	 *
+	 * @pre The current thread owns the publicFlagsMutex of vmThread.
 	 *
 	 * @param vmThread[in] the J9VMThread to modify
 	 * @param flags[in] the flags to set
@@ -430,6 +433,7 @@ public:
 	setHaltFlagForVMAccessRelease(J9VMThread* const vmThread, UDATA const flags)
 	{
 		setPublicFlags(vmThread, flags, true);
+		omrthread_monitor_notify_all(vmThread->publicFlagsMutex);
 #if defined(J9VM_INTERP_ATOMIC_FREE_JNI)
 #if defined(J9VM_INTERP_ATOMIC_FREE_JNI_USES_FLUSH)
 		J9_VM_FUNCTION(vmThread, flushProcessWriteBuffers)(vmThread->javaVM);
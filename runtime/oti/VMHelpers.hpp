@@ -573,6 +573,46 @@ public:
 		return isSubclass;
 	}
 
+	/**
+	 * Find the iTable for an interface in the iTable list of a class. The single-entry
+	 * lastITable cache is checked first. On a miss, classes with an iTable hash are probed
+	 * through it, and the remainder walk the iTable list.
+	 *
+	 * @param clazz[in] the class whose iTables are searched
+	 * @param interfaceClass[in] the interface to find
+	 * @param updateCache[in] whether or not to write a found iTable back to lastITable (default true)
+	 *
+	 * @returns the iTable for interfaceClass, or NULL if clazz does not implement it
+	 */
+	static VMINLINE J9ITable *
+	findITable(J9Class *clazz, J9Class *interfaceClass, bool updateCache = true)
+	{
+		J9ITable *iTable = clazz->lastITable;
+		if (interfaceClass != iTable->interfaceClass) {
+			J9ITableHash *iTableHash = clazz->iTableHash;
+			if (NULL != iTableHash) {
+				J9ITable **slots = J9ITABLEHASH_SLOTS(iTableHash);
+				UDATA mask = iTableHash->mask;
+				UDATA index = J9ITABLEHASH_INDEX(interfaceClass, mask);
+				/* The hash is never full, so an empty slot terminates the probe */
+				iTable = slots[index];
+				while ((NULL != iTable) && (interfaceClass != iTable->interfaceClass)) {
+					index = (index + 1) & mask;
+					iTable = slots[index];
+				}
+			} else {
+				iTable = (J9ITable *)clazz->iTable;
+				while ((NULL != iTable) && (interfaceClass != iTable->interfaceClass)) {
+					iTable = iTable->next;
+				}
+			}
+			if (updateCache && (NULL != iTable)) {
+				clazz->lastITable = iTable;
+			}
+		}
+		return iTable;
+	}
+
 	/**
 	 * Determine if a class is castable to another.  If updateCache is true, the current thread
 	 * must have VM access (or otherwise be blocking the GC) as writes back to classes which might
@@ -609,23 +649,12 @@ retry:
 			}
 			if (J9ROMCLASS_IS_INTERFACE(castClass->romClass)) {
 				/***** casting to an interface - do itable check */
-				iTable = (J9ITable*)instanceClass->lastITable;
-				if (iTable->interfaceClass == castClass) {
-					goto cacheCastable;
-				}
-				iTable = (J9ITable*)instanceClass->iTable;
-				while (NULL != iTable) {
-					if (iTable->interfaceClass == castClass) {
-						if (updateCache) {
-							instanceClass->lastITable = iTable;
-						}
-cacheCastable:
-						if (updateCache) {
-							instanceClass->castClassCache = (UDATA)castClass;
-						}
-						goto done;
+				iTable = findITable(instanceClass, castClass, updateCache);
+				if (NULL != iTable) {
+					if (updateCache) {
+						instanceClass->castClassCache = (UDATA)castClass;
 					}
-					iTable = iTable->next;
+					goto done;
 				}
 			} else if (J9CLASS_IS_ARRAY(castClass)) {
 				/* the instanceClass must be an array to continue */
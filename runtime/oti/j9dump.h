@@ -45,6 +45,8 @@ typedef struct RasDumpGlobalStorage {
 #define J9RAS_JAVADUMP_SHOW_NATIVE_STACK_SYMBOLS_ALL   0x2
 /* Flag to show unmounted Thread stacktrace in java dump. */
 #define J9RAS_JAVADUMP_SHOW_UNMOUNTED_THREAD_STACKS    0x4
+/* Flag to show the time-to-safe-point histograms in java dump. */
+#define J9RAS_JAVADUMP_SHOW_SAFE_POINT_HISTOGRAM       0x8
 
 struct J9RASdumpAgent; /* Forward struct declaration */
 struct J9RASdumpContext; /* Forward struct declaration */
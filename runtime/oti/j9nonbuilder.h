@@ -664,6 +664,7 @@ typedef struct J9ClassHotFieldsInfo {
 	uint8_t hotFieldOffset3;
 	uint8_t consecutiveHotFieldSelections;
 	uint8_t hotFieldListLength;
+	uint8_t hotFieldCopyDepth;
 } J9ClassHotFieldsInfo;
 
 typedef struct J9ROMNameAndSignature {
@@ -1553,8 +1554,12 @@ typedef struct J9ObjectMonitor {
 #endif /* J9VM_THR_SMART_DEFLATION */
 	j9objectmonitor_t alternateLockword;
 	U_32 hash;
+	U_32 tryEnterSpinBackoff;
 } J9ObjectMonitor;
 
+/* Upper bound on J9ObjectMonitor.tryEnterSpinBackoff: the try-enter spin counts are shifted right by at most this many bits */
+#define J9_OBJECT_MONITOR_MAX_TRY_ENTER_SPIN_BACKOFF 4
+
 typedef struct J9ClassWalkState {
 	struct J9JavaVM* vm;
 	struct J9MemorySegment* nextSegment;
@@ -3314,6 +3319,8 @@ typedef struct J9Class {
 #endif /* JAVA_SPEC_VERSION >= 11 */
 	struct J9FlattenedClassCache* flattenedClassCache;
 	struct J9ClassHotFieldsInfo* hotFieldsInfo;
+	struct J9ITableHash* iTableHash;
+	struct J9MethodLookupIndex* methodLookupIndex;
 } J9Class;
 
 /* Interface classes can never be instantiated, so the following fields in J9Class will not be used:
@@ -3406,6 +3413,8 @@ typedef struct J9ArrayClass {
 	/* Added temporarily for consistency */
 	UDATA flattenedElementSize;
 	struct J9ClassHotFieldsInfo* hotFieldsInfo;
+	struct J9ITableHash* iTableHash;
+	struct J9MethodLookupIndex* methodLookupIndex;
 } J9ArrayClass;
 
 
@@ -3824,6 +3833,31 @@ typedef struct J9ITable {
 	struct J9ITable* next;
 } J9ITable;
 
+/* Open-addressed table of all of the iTables in a class's iTable list, keyed by interface class.
+ * Only built for classes whose iTable list is longer than J9_ITABLE_HASH_THRESHOLD. The mask is
+ * followed in memory by (mask + 1) J9ITable pointers, at most half of which are in use.
+ */
+typedef struct J9ITableHash {
+	UDATA mask;
+} J9ITableHash;
+
+#define J9_ITABLE_HASH_THRESHOLD 8
+#define J9ITABLEHASH_SLOTS(hash) ((J9ITable **)((hash) + 1))
+#define J9ITABLEHASH_INDEX(interfaceClass, mask) ((((UDATA)(interfaceClass)) >> J9_REQUIRED_CLASS_SHIFT) & (mask))
+
+/* Open-addressed table of the methods of a class, keyed by name and signature. Built lazily by
+ * method lookup for classes with at least J9_METHOD_LOOKUP_INDEX_THRESHOLD methods, and only valid
+ * while romClass matches the class's ROM class. The header is followed in memory by (mask + 1)
+ * U_16 slots holding the ramMethods index plus one, or 0 for an empty slot.
+ */
+typedef struct J9MethodLookupIndex {
+	struct J9ROMClass* romClass;
+	U_32 mask;
+} J9MethodLookupIndex;
+
+#define J9_METHOD_LOOKUP_INDEX_THRESHOLD 32
+#define J9METHODLOOKUPINDEX_SLOTS(index) ((U_16 *)((index) + 1))
+
 typedef struct J9VTableHeader {
 	UDATA size;
 	J9Method* initialVirtualMethod;
@@ -4510,6 +4544,7 @@ typedef struct J9MemoryManagerFunctions {
 	UDATA  ( *j9gc_get_softmx)(struct J9JavaVM *javaVM) ;
 	UDATA  ( *j9gc_get_initial_heap_size)(struct J9JavaVM *javaVM) ;
 	UDATA  ( *j9gc_get_maximum_heap_size)(struct J9JavaVM *javaVM) ;
+	UDATA  ( *j9gc_get_idle_rss_statistics)(struct J9JavaVM *javaVM, U_64 *cycleCount, U_64 *lastRSSReduction, U_64 *totalRSSReduction) ;
 	UDATA  ( *j9gc_objaccess_checkClassLive)(struct J9JavaVM *javaVM, J9Class *classPtr) ;
 #if defined(J9VM_GC_OBJECT_ACCESS_BARRIER)
 	IDATA  ( *j9gc_objaccess_indexableReadI8)(struct J9VMThread *vmThread, J9IndexableObject *srcObject, I_32 index, UDATA isVolatile) ;
@@ -4608,6 +4643,10 @@ typedef struct J9MemoryManagerFunctions {
 	jvmtiIterationControl  ( *j9mm_iterate_object_slots)(struct J9JavaVM *javaVM, J9PortLibrary *portLibrary, struct J9MM_IterateObjectDescriptor *object, UDATA flags, jvmtiIterationControl (*func)(struct J9JavaVM *javaVM, struct J9MM_IterateObjectDescriptor *objectDesc, struct J9MM_IterateObjectRefDescriptor *refDesc, void *userData), void *userData) ;
 	void  ( *j9mm_initialize_object_descriptor)(struct J9JavaVM *javaVM, struct J9MM_IterateObjectDescriptor *descriptor, j9object_t object) ;
 	jvmtiIterationControl  ( *j9mm_iterate_all_objects)(struct J9JavaVM *vm, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(struct J9JavaVM *vm, struct J9MM_IterateObjectDescriptor *object, void *userData), void *userData) ;
+	jvmtiIterationControl  ( *j9mm_iterate_all_objects_parallel)(struct J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(struct J9JavaVM *vm, struct J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData), void *userData) ;
+	jvmtiIterationControl  ( *j9mm_iterate_regions_parallel)(struct J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(struct J9JavaVM *vm, struct J9MM_IterateRegionDescriptor *regionDesc, UDATA workerID, void *userData), void *userData) ;
+	UDATA  ( *j9mm_get_parallel_walk_thread_count)(struct J9JavaVM *vm) ;
+	BOOLEAN  ( *j9mm_is_parallel_walk_possible)(struct J9VMThread *vmThread) ;
 	UDATA  ( *j9gc_modron_isFeatureSupported)(struct J9JavaVM *javaVM, UDATA feature) ;
 	UDATA  ( *j9gc_modron_getConfigurationValueForKey)(struct J9JavaVM *javaVM, UDATA key, void *value) ;
 	const char*  ( *omrgc_get_version)(OMR_VM *omrVM) ;
@@ -4662,6 +4701,36 @@ typedef struct J9MemoryManagerFunctions {
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 } J9MemoryManagerFunctions;
 
+typedef void (*J9ThreadHandshakeFunction)(struct J9VMThread *currentThread, struct J9VMThread *targetThread, void *userData);
+
+/* A request to run a function on behalf of another thread once it reaches a safe point.
+ * Requests are queued on the target thread and the queue is protected by its publicFlagsMutex.
+ * The state is protected by the publicFlagsMutex of the requester, which waits on it.
+ */
+typedef struct J9ThreadHandshake {
+	J9ThreadHandshakeFunction function;
+	void *userData;
+	U_64 requestTime;
+	UDATA state;
+	struct J9VMThread *requester;
+	struct J9ThreadHandshake *next;
+} J9ThreadHandshake;
+
+#define J9_THREAD_HANDSHAKE_QUEUED  0
+#define J9_THREAD_HANDSHAKE_RUNNING  1
+#define J9_THREAD_HANDSHAKE_COMPLETE  2
+
+#define J9_TIME_TO_SAFE_POINT_HISTOGRAM_SIZE 16
+
+/* Counts of safe point requests by response time. Bucket 0 counts responses under
+ * one microsecond, bucket i counts responses in [2^(i-1), 2^i) microseconds and the
+ * last bucket counts everything slower.
+ */
+typedef struct J9TimeToSafePointHistogram {
+	UDATA exclusive[J9_TIME_TO_SAFE_POINT_HISTOGRAM_SIZE];
+	UDATA handshake[J9_TIME_TO_SAFE_POINT_HISTOGRAM_SIZE];
+} J9TimeToSafePointHistogram;
+
 typedef struct J9InternalVMFunctions {
 	void* reserved0;
 	void* reserved1;
@@ -4831,6 +4900,7 @@ typedef struct J9InternalVMFunctions {
 	struct J9HookInterface**  ( *getJITHookInterface)(struct J9JavaVM* vm) ;
 	void  ( *haltThreadForInspection)(struct J9VMThread * currentThread, struct J9VMThread * vmThread) ;
 	void  ( *resumeThreadForInspection)(struct J9VMThread * currentThread, struct J9VMThread * vmThread) ;
+	void  ( *executeThreadHandshake)(struct J9VMThread *currentThread, struct J9VMThread *targetThread, J9ThreadHandshakeFunction function, void *userData) ;
 	void  ( *threadCleanup)(struct J9VMThread * vmThread, UDATA forkedByVM) ;
 	j9object_t  ( *walkStackForExceptionThrow)(struct J9VMThread * currentThread, j9object_t exception, UDATA walkOnly) ;
 	IDATA  ( *postInitLoadJ9DLL)(struct J9JavaVM* vm, const char* dllName, void* argData) ;
@@ -4886,6 +4956,7 @@ typedef struct J9InternalVMFunctions {
 	void  ( *initializeMethodID)(struct J9VMThread * currentThread, J9JNIMethodID * methodID, struct J9Method * method) ;
 	IDATA  ( *objectMonitorDestroy)(struct J9JavaVM *vm, struct J9VMThread *vmThread, omrthread_monitor_t monitor) ;
 	void  ( *objectMonitorDestroyComplete)(struct J9JavaVM *vm, struct J9VMThread *vmThread) ;
+	UDATA  ( *objectMonitorDeflateIdle)(struct J9JavaVM *vm, struct J9VMThread *vmThread, struct J9ObjectMonitor *objectMonitor) ;
 	U_8*  ( *buildNativeFunctionNames)(struct J9JavaVM * javaVM, struct J9Method* ramMethod, struct J9Class* ramClass, UDATA nameOffset) ;
 	IDATA  ( *resolveInstanceFieldRefInto)(struct J9VMThread *vmStruct, J9Method *method, J9ConstantPool *constantPool, UDATA fieldIndex, UDATA resolveFlags, struct J9ROMFieldShape **resolvedField, J9RAMFieldRef *ramCPEntry) ;
 	struct J9Method*  ( *resolveInterfaceMethodRefInto)(struct J9VMThread *vmStruct, J9ConstantPool *constantPool, UDATA cpIndex, UDATA resolveFlags, struct J9RAMInterfaceMethodRef *ramCPEntry) ;
@@ -5178,9 +5249,23 @@ typedef struct J9VMContinuation {
 	struct J9I2JState i2jState;
 	struct J9VMEntryLocalStorage* oldEntryLocalStorage;
 	UDATA dropFlags;
+	UDATA maxStackDepth;
 } J9VMContinuation;
+
+/* The continuation stack size hint is kept at or below this fraction of -Xss */
+#define J9_CONTINUATION_STACK_SIZE_HINT_MAX_FRACTION 4
 #endif /* JAVA_SPEC_VERSION >= 19 */
 
+#define J9_JNI_GLOBAL_REF_CACHE_SIZE 16
+
+/* Per-thread cache of JNI global reference slots. Slots in the cache are allocated
+ * from the shared pool and hold NULL, so the GC sees them as empty roots.
+ */
+typedef struct J9JNIGlobalRefCache {
+	UDATA count;
+	j9object_t* slots[J9_JNI_GLOBAL_REF_CACHE_SIZE];
+} J9JNIGlobalRefCache;
+
 /* @ddr_namespace: map_to_type=J9VMThread */
 
 typedef struct J9VMThread {
@@ -5436,6 +5521,8 @@ typedef struct J9VMThread {
 #if JAVA_SPEC_VERSION >= 21
 	BOOLEAN isInTrivialDownCall;
 #endif /* JAVA_SPEC_VERSION >= 21 */
+	J9JNIGlobalRefCache jniGlobalRefCache;
+	J9ThreadHandshake *handshakeQueue;
 } J9VMThread;
 
 #define J9VMTHREAD_ALIGNMENT  0x100
@@ -5689,6 +5776,8 @@ typedef struct J9JavaVM {
 	UDATA thrMaxTryEnterYieldsBeforeBlocking;
 	UDATA thrNestedSpinning;
 	UDATA thrTryEnterNestedSpinning;
+	UDATA thrAdaptiveTryEnterSpinning;
+	UDATA thrDeflateIdleMonitors;
 	UDATA thrDeflationPolicy;
 	UDATA gcOptions;
 	UDATA  ( *unhookVMEvent)(struct J9JavaVM *javaVM, UDATA eventNumber, void * currentHandler, void * oldHandler) ;
@@ -5731,7 +5820,7 @@ typedef struct J9JavaVM {
 	J9SidecarExitFunction * sidecarExitFunctions;
 	struct J9HashTable** monitorTables;
 	UDATA monitorTableCount;
-	omrthread_monitor_t monitorTableMutex;
+	omrthread_monitor_t* monitorTableMutexes;
 	struct J9MonitorTableListEntry* monitorTableList;
 	struct J9Pool* monitorTableListPool;
 	UDATA thrStaggerStep;
@@ -5995,6 +6084,7 @@ typedef struct J9JavaVM {
 	J9VMContinuation **continuationT2Cache;
 	U_32 continuationT1Size;
 	U_32 continuationT2Size;
+	UDATA continuationStackSizeHint;
 #if defined(J9VM_PROF_CONTINUATION_ALLOCATION)
 	volatile U_32 t1CacheHit;
 	volatile U_32 t2CacheHit;
@@ -6009,6 +6099,8 @@ typedef struct J9JavaVM {
 	omrthread_monitor_t delayedLockingOperationsMutex;
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 	U_32 compatibilityFlags;
+	IDATA threadHandshakeHandlerKey;
+	J9TimeToSafePointHistogram timeToSafePointHistogram;
 } J9JavaVM;
 
 #define J9VM_PHASE_STARTUP  1
@@ -440,6 +440,10 @@ extern J9_CFUNC jint JNICALL
 Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getMaximumGCThreadsImpl(JNIEnv *env, jobject beanInstance);
 extern J9_CFUNC jint JNICALL
 Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getCurrentGCThreadsImpl(JNIEnv *env, jobject beanInstance);
+extern J9_CFUNC jlong JNICALL
+Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getIdleResidentSetReductionImpl(JNIEnv *env, jobject beanInstance);
+extern J9_CFUNC jlong JNICALL
+Java_com_ibm_java_lang_management_internal_MemoryMXBeanImpl_getLastIdleResidentSetReductionImpl(JNIEnv *env, jobject beanInstance);
 
 
 /* J9SourceJclSidecarInit*/
@@ -468,6 +468,10 @@ enum INIT_STAGE {
 #define VMOPT_XXNOSHOWUNMOUNTEDTHREADSTACKS "-XX:-ShowUnmountedThreadStacks"
 #endif /* JAVA_SPEC_VERSION >= 21 */
 
+/* Option to control if the time-to-safe-point histograms are shown in java core dumps. */
+#define VMOPT_XXSHOWSAFEPOINTHISTOGRAM "-XX:+ShowSafePointHistogram"
+#define VMOPT_XXNOSHOWSAFEPOINTHISTOGRAM "-XX:-ShowSafePointHistogram"
+
 /* Option to turn on exception on synchronization on instances of value-based classes */
 #define VMOPT_XXDIAGNOSE_SYNC_ON_VALUEBASED_CLASSES_EQUALS1 "-XX:DiagnoseSyncOnValueBasedClasses=1"
 /* Option to turn on warning on synchronization on instances of value-based classes */
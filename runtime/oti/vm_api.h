@@ -1442,6 +1442,15 @@ void JNICALL
 j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak);
 
 
+/**
+* @brief Return the cached JNI global ref slots of a thread to the shared pool
+* @param *vmThread
+* @return void
+*/
+void JNICALL
+j9jni_flushGlobalRefCaches(J9VMThread *vmThread);
+
+
 /**
 * @brief
 * @param *env
@@ -2357,6 +2366,22 @@ objectMonitorDestroy(J9JavaVM *vm, J9VMThread *vmThread, omrthread_monitor_t mon
 void
 objectMonitorDestroyComplete(J9JavaVM *vm, J9VMThread *vmThread);
 
+/**
+ * Deflate an inflated object monitor which no thread owns, waits on or is blocked entering.
+ * Called by the global collectors for each monitor table entry whose object survived,
+ * when -Xthr:deflateIdleMonitors is specified. The deflation policy in effect decides
+ * whether the monitor may be deflated, as it does for objectMonitorExit.
+ *
+ * @pre the caller must have exclusive VM access, and the object must not be moving.
+ *
+ * @param[in] vm the J9JavaVM
+ * @param[in] vmThread the J9VMThread calling this function
+ * @param[in] objectMonitor the monitor table entry of a live object
+ * @return 1 if the monitor was deflated, 0 otherwise
+ */
+UDATA
+objectMonitorDeflateIdle(J9JavaVM *vm, J9VMThread *vmThread, J9ObjectMonitor *objectMonitor);
+
 #if defined(J9VM_THR_LOCK_RESERVATION)
 /**
  * Cancel the lock reservation for the object stored in the current thread's
@@ -3808,6 +3833,29 @@ void
 resumeThreadForInspection(J9VMThread * currentThread, J9VMThread * vmThread);
 
 
+/**
+* @brief Run a function on behalf of a target thread once it is at a safe point, without halting any other thread.
+* @param currentThread
+* @param targetThread
+* @param function
+* @param userData
+* @return void
+*/
+void
+executeThreadHandshake(J9VMThread *currentThread, J9VMThread *targetThread, J9ThreadHandshakeFunction function, void *userData);
+
+
+/**
+* @brief Async event handler which runs the handshakes queued on the current thread.
+* @param currentThread
+* @param handlerKey
+* @param userData
+* @return void
+*/
+void
+threadHandshakeAsyncHandler(J9VMThread *currentThread, IDATA handlerKey, void *userData);
+
+
 /**
 * @brief
 * @param vmThread
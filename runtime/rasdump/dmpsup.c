@@ -570,6 +570,17 @@ configureDumpAgents(J9JavaVM *vm, J9VMInitArgs *j9vm_args, BOOLEAN isBootup)
 	}
 #endif /* JAVA_SPEC_VERSION >= 21 */
 
+	/* -XX:[+/-]ShowSafePointHistogram */
+	{
+		IDATA showSafePointHistogram = FIND_AND_CONSUME_ARG(j9vm_args, EXACT_MATCH, VMOPT_XXSHOWSAFEPOINTHISTOGRAM, NULL);
+		IDATA noShowSafePointHistogram = FIND_AND_CONSUME_ARG(j9vm_args, EXACT_MATCH, VMOPT_XXNOSHOWSAFEPOINTHISTOGRAM, NULL);
+
+		if (showSafePointHistogram > noShowSafePointHistogram) {
+			dumpGlobal->dumpFlags |= J9RAS_JAVADUMP_SHOW_SAFE_POINT_HISTOGRAM;
+		}
+		/* Keep the THREADS section in its usual format by default. */
+	}
+
 	agentOpts = j9mem_allocate_memory(sizeof(J9RASdumpOption)*MAX_DUMP_OPTS, OMRMEM_CATEGORY_VM);
 	if( NULL == agentOpts ) {
 		j9tty_err_printf(PORTLIB, "Storage for dump options not available, unable to process dump options\n");
@@ -27,6 +27,7 @@
 #include "HeapIteratorAPI.h"
 #include "j9dmpnls.h"
 #include "FileStream.hpp"
+#include "omrthread.h"
 
 #include "ut_j9dmp.h"
 
@@ -39,6 +40,8 @@ static jvmtiIterationControl binaryHeapDumpHeapIteratorCallback   (J9JavaVM* vm,
 static jvmtiIterationControl binaryHeapDumpSpaceIteratorCallback  (J9JavaVM* vm, J9MM_IterateSpaceDescriptor*  spaceDescriptor,   void* userData);
 static jvmtiIterationControl binaryHeapDumpRegionIteratorCallback (J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
 static jvmtiIterationControl binaryHeapDumpObjectIteratorCallback (J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor,  void* userData);
+static jvmtiIterationControl binaryHeapDumpRegionRecorderCallback (J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+static jvmtiIterationControl binaryHeapDumpParallelRegionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, UDATA workerID, void* userData);
 
 static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorTraitsCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
@@ -52,6 +55,13 @@ static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback
 #define allClassesEndDo(vm, state) \
 	vm->internalVMFunctions->allClassesEndDo(state)
 
+/* Regions of a space in the order the heap iterator reports them, see writeRegionsInParallel() */
+typedef struct HeapDumpRegionList {
+	void** regionStarts;
+	UDATA  count;
+	UDATA  capacity;
+} HeapDumpRegionList;
+
 /* Function prototypes for performance measurement 
 void startTimer();
 void stopTimer();
@@ -756,6 +766,7 @@ private :
 	friend jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 	friend jvmtiIterationControl binaryHeapDumpHeapIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateHeapDescriptor* heapDescriptor, void* userData);
 	friend jvmtiIterationControl binaryHeapDumpRegionIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+	friend jvmtiIterationControl binaryHeapDumpParallelRegionIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* regionDescription, UDATA workerID, void* userData);
 
 	/* Nested class for determining the characteristics of the references */
 	class ReferenceTraits
@@ -828,6 +839,11 @@ private :
 
 		/* Method for setting the object back to its initial state (i.e. empty) */
 		void clear(void);
+
+		/* Methods for moving the cache between the file writer and the parallel walk workers */
+		void copyFrom(const ClassCache& source);
+		void save(const void** cache, int* index) const;
+		void merge(const void* const* cache, int index, int rotation);
 		
 	private :
 		/* Prevent use of the copy constructor and assignment operator */
@@ -839,6 +855,46 @@ private :
 		int         _Index;
 	};
 
+	/* Buffer segment holding records encoded by a parallel walk worker. The segment data is followed by */
+	/* a map with one bit per data byte, set where a short object record (whose tag refers to the class */
+	/* cache) starts, so that the tag can be rebased onto the file's class cache when it is merged      */
+	struct ChunkSegment
+	{
+		ChunkSegment* _Next;
+		UDATA         _Length;
+
+		inline char* data(void)           {return (char*)(this + 1);}
+		inline U_8*  shortRecordMap(void) {return (U_8*)(data() + chunkSegmentSize());}
+	};
+
+	/* Records encoded for one region by a parallel walk worker, waiting to be written in region order */
+	struct RegionChunk
+	{
+		ChunkSegment* _Head;
+		ChunkSegment* _Tail;
+		j9object_t    _FirstObject;  /* encoded when merged, as its gap depends on the previous region */
+		void*         _LastObject;
+		const void*   _Cache[4];
+		int           _CacheIndex;
+		bool          _Complete;
+	};
+
+	/* State shared by the workers of a parallel walk (see PARALLEL heap dump option) */
+	struct ParallelWalk
+	{
+		omrthread_monitor_t _Monitor;
+		void**              _RegionStarts;   /* in the order the regions are handed out */
+		RegionChunk*        _Chunks;
+		UDATA               _ChunkCount;
+		UDATA*              _WorkerCursors;  /* next region index to search from, per worker */
+		UDATA               _WorkerCount;
+		UDATA               _NextChunk;      /* first chunk that has not been written to the file yet */
+		UDATA               _PendingBytes;   /* bytes buffered in chunks that can't be written yet */
+	};
+
+	/* Constructor for the encoder of a parallel walk worker */
+	BinaryHeapDumpWriter(BinaryHeapDumpWriter* parent, RegionChunk* chunk, UDATA chunkIndex);
+
 	friend class ReferenceTraits;
 	friend class ReferenceWriter;
 
@@ -851,6 +907,20 @@ private :
 	void             writeNormalObjectRecord(J9MM_IterateObjectDescriptor* objectDescriptor);
 	void             writeArrayObjectRecord(J9MM_IterateObjectDescriptor* objectDescriptor);
 	void             writeClassRecord(J9Class* clazz);
+	void             writeShortObjectRecordTag(int flags);
+	static bool      isParallelWalkPossible(J9RASdumpContext* context, J9RASdumpAgent* agent);
+	bool             writeRegionsInParallel(J9MM_IterateSpaceDescriptor* spaceDescriptor);
+	void             writeRegionChunk(J9MM_IterateRegionDescriptor* regionDescription);
+	void             beginRegionChunk(void);
+	void             endRegionChunk(void);
+	bool             deferFirstObjectRecord(j9object_t object, J9Class* clazz);
+	bool             reserveChunkSpace(IDATA length);
+	void             adoptFileState(void);
+	void             writeChunkToFile(RegionChunk* chunk);
+	void             freeChunkSegments(RegionChunk* chunk, bool pending);
+	void             reportParallelWalkError(const char* reason);
+	static UDATA     chunkSegmentSize(void);
+	static UDATA     pendingChunkBytesLimit(void);
 	static int       numberSize(IDATA number);
 	int              getObjectHashCode(j9object_t object);
 	static int       numberSizeEncoding(int numberSize);
@@ -873,6 +943,14 @@ private :
 	ClassCache        _ClassCache;
 	bool              _FileMode;
 	bool              _Error;
+	/* Parallel walk state: the file writer owns _Walk, each worker encoder has a _Parent and a _Chunk */
+	ParallelWalk*     _Walk;
+	BinaryHeapDumpWriter* _Parent;
+	RegionChunk*      _Chunk;
+	UDATA             _ChunkIndex;
+	bool              _MayWriteToParent;      /* all earlier chunks were written when the last segment was added */
+	bool              _WritingToParent;       /* worker owns the head of the file, so segments go straight out */
+	bool              _SuppressShortRecord;   /* set while merging a chunk's first object, see writeChunkToFile() */
 
 	/* Static methods returning constant values */
 	inline static const char* identifierField(void)        {return "portable heap dump";}
@@ -1107,6 +1185,55 @@ BinaryHeapDumpWriter::ClassCache::clear(void)
 	_Index = 0;
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::ClassCache::copyFrom() method implementation                             */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::ClassCache::copyFrom(const ClassCache& source)
+{
+	for (int i = 0; i < 4; i++) {
+		_Cache[i] = source._Cache[i];
+	}
+
+	_Index = source._Index;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::ClassCache::save() method implementation                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::ClassCache::save(const void** cache, int* index) const
+{
+	for (int i = 0; i < 4; i++) {
+		cache[i] = _Cache[i];
+	}
+
+	*index = _Index;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::ClassCache::merge() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::ClassCache::merge(const void* const* cache, int index, int rotation)
+{
+	/* The saved cache was filled from empty starting at slot 0, while the same additions made */
+	/* here start at slot 'rotation', so slot i of the saved cache is slot i + rotation here   */
+	for (int i = 0; i < 4; i++) {
+		if (cache[i] != 0) {
+			_Cache[(i + rotation) % 4] = cache[i];
+		}
+	}
+
+	_Index = (index + rotation) % 4;
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::BinaryHeapDumpWriter() method implementation                             */
@@ -1124,7 +1251,14 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	_OutputStream(context->javaVM->portLibrary),
 	_CurrentObject(0),
 	_FileMode(false),
-	_Error(false)
+	_Error(false),
+	_Walk(NULL),
+	_Parent(NULL),
+	_Chunk(NULL),
+	_ChunkIndex(0),
+	_MayWriteToParent(false),
+	_WritingToParent(false),
+	_SuppressShortRecord(false)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
 
@@ -1186,6 +1320,35 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	}
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::BinaryHeapDumpWriter() parallel walk worker constructor implementation   */
+/*                                                                                                */
+/**************************************************************************************************/
+BinaryHeapDumpWriter::BinaryHeapDumpWriter(BinaryHeapDumpWriter* parent, RegionChunk* chunk, UDATA chunkIndex) :
+	_Id(0),
+	_RegionStart(NULL),
+	_RegionEnd(NULL),
+	_Context(parent->_Context),
+	_Agent(parent->_Agent),
+	_VirtualMachine(parent->_VirtualMachine),
+	_PortLibrary(parent->_PortLibrary),
+	_FileName(parent->_PortLibrary),
+	_OutputStream(parent->_PortLibrary),
+	_CurrentObject(0),
+	_FileMode(false),
+	_Error(false),
+	_Walk(NULL),
+	_Parent(parent),
+	_Chunk(chunk),
+	_ChunkIndex(chunkIndex),
+	_MayWriteToParent(false),
+	_WritingToParent(false),
+	_SuppressShortRecord(false)
+{
+	/* The records go to _Chunk rather than a file: see writeRegionChunk() */
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::~BinaryHeapDumpWriter() method implementation                            */
@@ -1234,13 +1397,15 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 	}
 
 	/* Iterate through the regions etc. */
-	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
-			_VirtualMachine,
-			_PortLibrary,
-			spaceDescriptor,
-			j9mm_iterator_flag_regions_read_only,
-			binaryHeapDumpRegionIteratorCallback,
-			this);
+	if (!isParallelWalkPossible(_Context, _Agent) || !writeRegionsInParallel(spaceDescriptor)) {
+		_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
+				_VirtualMachine,
+				_PortLibrary,
+				spaceDescriptor,
+				j9mm_iterator_flag_regions_read_only,
+				binaryHeapDumpRegionIteratorCallback,
+				this);
+	}
 
 	/* Handle the single and multiple dump file cases separately */
 	if (_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS) {
@@ -1403,6 +1568,8 @@ BinaryHeapDumpWriter::writeObjectRecord(J9MM_IterateObjectDescriptor* objectDesc
 	/* Handle class, array and normal objects separately */
 	if (J9VM_IS_INITIALIZED_HEAPCLASS_VM(_VirtualMachine, currentObject)) {
 		/* Do nothing - heap classes are handled in a separate walk */
+	} else if ((_Parent != 0) && deferFirstObjectRecord(currentObject, currentClass)) {
+		/* Do nothing - the record is written when the region's chunk is merged into the file */
 	} else if (J9ROMCLASS_IS_ARRAY(currentClass->romClass)) {
 		writeArrayObjectRecord(objectDescriptor);
 	} else {
@@ -1456,7 +1623,8 @@ BinaryHeapDumpWriter::writeNormalObjectRecord(J9MM_IterateObjectDescriptor* obje
 	if ( (addressOffsetEncoding   <=  1) &&
 	     (referenceTraits.count() <=  3) &&
 	     (classCacheIndex         != -1) &&
-	     (0 == hashCode)) {
+	     (0 == hashCode) &&
+	     (!_SuppressShortRecord)) {
 		/* It is so generate a short format record */
 		/* Calculate the flags */
 		int flags = 
@@ -1467,7 +1635,7 @@ BinaryHeapDumpWriter::writeNormalObjectRecord(J9MM_IterateObjectDescriptor* obje
 		    ( referenceOffsetEncoding       & 0x03);
 		    
 		/* Write the tag/flags */
-		writeNumber(flags, 1);
+		writeShortObjectRecordTag(flags);
 		if (_Error) {
 			return;
 		}
@@ -2395,6 +2563,21 @@ void
 BinaryHeapDumpWriter::writeCharacters (const char* data, IDATA length)
 {
 	if (!_Error) {
+		if (_Parent != 0) {
+			/* Parallel walk worker - append to the region's chunk, a segment at a time */
+			while ((length > 0) && reserveChunkSpace(1)) {
+				ChunkSegment* segment = _Chunk->_Tail;
+				IDATA available = (IDATA)(chunkSegmentSize() - segment->_Length);
+				IDATA count = (length < available) ? length : available;
+
+				memcpy(segment->data() + segment->_Length, data, count);
+				segment->_Length += count;
+				data   += count;
+				length -= count;
+			}
+			return;
+		}
+
 		_OutputStream.writeCharacters(data,length);
 
 		checkForIOError();
@@ -2404,6 +2587,11 @@ BinaryHeapDumpWriter::writeCharacters (const char* data, IDATA length)
 void
 BinaryHeapDumpWriter::writeCharacters (const char* data)
 {
+	if (_Parent != 0) {
+		writeCharacters(data, strlen(data));
+		return;
+	}
+
 	if (!_Error) {
 		_OutputStream.writeCharacters(data);
 
@@ -2415,12 +2603,436 @@ void
 BinaryHeapDumpWriter::writeNumber (IDATA data, int length)
 {
 	if (!_Error) {
+		if (_Parent != 0) {
+			/* Parallel walk worker - append to the region's chunk in network order, as FileStream does */
+			if (reserveChunkSpace(length)) {
+				ChunkSegment* segment = _Chunk->_Tail;
+				char* buffer = segment->data() + segment->_Length;
+				IDATA number = data;
+
+				for (int count = length; count-- > 0; ) {
+					buffer[count] = (char)(number & 0xFF);
+					number >>= 8;
+				}
+				segment->_Length += length;
+			}
+			return;
+		}
+
 		_OutputStream.writeNumber(data, length);
 
 		checkForIOError();
 	}
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* Parallel walk (PARALLEL heap dump option)                                                      */
+/*                                                                                                */
+/*   The regions of the space are handed out to the GC worker threads. Each worker encodes its    */
+/*   region into a chunk with an encoder of its own, and chunks are written to the file in region */
+/*   order by whichever worker completes the chunk at the head of the file. Records are encoded   */
+/*   against the previous record and the class cache, so a worker:                                */
+/*     - defers the region's first object, which the merge encodes against the file's state, and  */
+/*       encodes the rest of the region against it,                                               */
+/*     - starts from an empty class cache and marks its short records, whose cache index the      */
+/*       merge rotates onto the file's cache.                                                     */
+/*   Once a worker's chunk is at the head of the file it takes over the file's state and writes   */
+/*   its segments directly, so the head region is streamed rather than buffered.                  */
+/*                                                                                                */
+/**************************************************************************************************/
+UDATA
+BinaryHeapDumpWriter::chunkSegmentSize(void)
+{
+	return 256 * 1024;
+}
+
+UDATA
+BinaryHeapDumpWriter::pendingChunkBytesLimit(void)
+{
+	return 64 * 1024 * 1024;
+}
+
+bool
+BinaryHeapDumpWriter::isParallelWalkPossible(J9RASdumpContext* context, J9RASdumpAgent* agent)
+{
+#if defined(J9VM_OPT_NEW_OBJECT_HASH)
+	J9VMThread* vmThread = context->onThread;
+	J9RASdumpEventData* eventData = context->eventData;
+
+	if ((agent->dumpOptions == 0) || (strstr(agent->dumpOptions, "PARALLEL") == 0)) {
+		return false;
+	}
+
+	/* The walk runs on the GC dispatcher, so the dumping thread must hold exclusive access */
+	if ((vmThread == 0) || (vmThread->omrVMThread == 0) || (vmThread->omrVMThread->exclusiveCount == 0)) {
+		return false;
+	}
+
+	/* Concurrent GC work (concurrent scavenge, concurrent global mark or sweep) owns the dispatcher */
+	if (!context->javaVM->memoryManagerFunctions->j9mm_is_parallel_walk_possible(vmThread)) {
+		return false;
+	}
+
+	/* Don't use the dispatcher if the dump may have been triggered from within a GC, */
+	/* or if the heap may be damaged                                                   */
+	if ((context->eventFlags & (J9RAS_DUMP_ON_GLOBAL_GC | J9RAS_DUMP_ON_CLASS_UNLOAD | J9RAS_DUMP_ON_EXCESSIVE_GC)) ||
+	    (context->eventFlags & (J9RAS_DUMP_ON_GP_FAULT | J9RAS_DUMP_ON_ABORT_SIGNAL | J9RAS_DUMP_ON_TRACE_ASSERT)) ||
+	    ((eventData != 0) && (eventData->detailData != 0) && (strcmp(eventData->detailData, "-Xtrace:trigger") == 0))) {
+		return false;
+	}
+
+	return true;
+#else /* defined(J9VM_OPT_NEW_OBJECT_HASH) */
+	/* getObjectHashCode() may write the object header, which the workers must not do */
+	return false;
+#endif /* defined(J9VM_OPT_NEW_OBJECT_HASH) */
+}
+
+bool
+BinaryHeapDumpWriter::writeRegionsInParallel(J9MM_IterateSpaceDescriptor* spaceDescriptor)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	J9MemoryManagerFunctions* mmFuncs = _VirtualMachine->memoryManagerFunctions;
+
+	/* The parallel region walk covers the default memory space */
+	if (spaceDescriptor->id != (UDATA)_VirtualMachine->defaultMemorySpace) {
+		return false;
+	}
+
+	UDATA workerCount = mmFuncs->j9mm_get_parallel_walk_thread_count(_VirtualMachine);
+	if (workerCount < 2) {
+		return false;
+	}
+
+	/* Record the regions in walk order so that each one can be given its place in the file */
+	HeapDumpRegionList regionList = {0, 0, 0};
+	mmFuncs->j9mm_iterate_regions(_VirtualMachine, _PortLibrary, spaceDescriptor, j9mm_iterator_flag_regions_read_only, binaryHeapDumpRegionRecorderCallback, &regionList);
+	if (regionList.count < 2) {
+		return false;
+	}
+
+	ParallelWalk walk;
+	memset(&walk, 0, sizeof(walk));
+	regionList.capacity     = regionList.count;
+	regionList.count        = 0;
+	regionList.regionStarts = (void**)j9mem_allocate_memory(regionList.capacity * sizeof(void*), OMRMEM_CATEGORY_VM);
+	walk._Chunks            = (RegionChunk*)j9mem_allocate_memory(regionList.capacity * sizeof(RegionChunk), OMRMEM_CATEGORY_VM);
+	walk._WorkerCursors     = (UDATA*)j9mem_allocate_memory(workerCount * sizeof(UDATA), OMRMEM_CATEGORY_VM);
+
+	bool started = false;
+	if ((regionList.regionStarts != 0) && (walk._Chunks != 0) && (walk._WorkerCursors != 0)) {
+		mmFuncs->j9mm_iterate_regions(_VirtualMachine, _PortLibrary, spaceDescriptor, j9mm_iterator_flag_regions_read_only, binaryHeapDumpRegionRecorderCallback, &regionList);
+
+		if ((regionList.count == regionList.capacity) && (omrthread_monitor_init_with_name(&walk._Monitor, 0, "Heap dump parallel walk") == 0)) {
+			memset(walk._Chunks, 0, regionList.capacity * sizeof(RegionChunk));
+			memset(walk._WorkerCursors, 0, workerCount * sizeof(UDATA));
+			walk._RegionStarts = regionList.regionStarts;
+			walk._ChunkCount   = regionList.capacity;
+			walk._WorkerCount  = workerCount;
+			_Walk = &walk;
+
+			mmFuncs->j9mm_iterate_regions_parallel(_Context->onThread, _PortLibrary, j9mm_iterator_flag_regions_read_only, binaryHeapDumpParallelRegionIteratorCallback, this);
+
+			/* An aborted walk leaves unwritten chunks behind */
+			for (UDATA i = walk._NextChunk; i < walk._ChunkCount; i++) {
+				freeChunkSegments(&walk._Chunks[i], true);
+			}
+
+			_Walk = NULL;
+			omrthread_monitor_destroy(walk._Monitor);
+			started = true;
+		}
+	}
+
+	j9mem_free_memory(walk._WorkerCursors);
+	j9mem_free_memory(walk._Chunks);
+	j9mem_free_memory(regionList.regionStarts);
+
+	return started;
+}
+
+void
+BinaryHeapDumpWriter::writeRegionChunk(J9MM_IterateRegionDescriptor* regionDescription)
+{
+	_Id = regionDescription->id;
+	_RegionStart = (char*)regionDescription->regionStart;
+	_RegionEnd = (char*)((UDATA)regionDescription->regionStart + regionDescription->regionSize);
+
+	beginRegionChunk();
+
+	if (!_Error && !_Parent->_Error) {
+		_VirtualMachine->memoryManagerFunctions->j9mm_iterate_region_objects(_VirtualMachine, _PortLibrary, regionDescription, 0, binaryHeapDumpObjectIteratorCallback, this);
+	}
+
+	endRegionChunk();
+}
+
+void
+BinaryHeapDumpWriter::beginRegionChunk(void)
+{
+	ParallelWalk* walk = _Parent->_Walk;
+
+	/* Don't encode too far ahead of the file. The head chunk never waits, so neither can the walk */
+	/* deadlock: regions are handed out in order, so the head region is already being encoded     */
+	omrthread_monitor_enter(walk->_Monitor);
+	while (!_Parent->_Error && (walk->_NextChunk != _ChunkIndex) && (walk->_PendingBytes >= pendingChunkBytesLimit())) {
+		omrthread_monitor_wait(walk->_Monitor);
+	}
+	_MayWriteToParent = (walk->_NextChunk == _ChunkIndex);
+	omrthread_monitor_exit(walk->_Monitor);
+
+	if (_MayWriteToParent) {
+		adoptFileState();
+	}
+}
+
+void
+BinaryHeapDumpWriter::endRegionChunk(void)
+{
+	ParallelWalk* walk = _Parent->_Walk;
+
+	omrthread_monitor_enter(walk->_Monitor);
+
+	if (_WritingToParent) {
+		/* Write the rest of the region and hand the encoding state back to the file */
+		if (_Chunk->_Tail != 0) {
+			_Parent->writeCharacters(_Chunk->_Tail->data(), _Chunk->_Tail->_Length);
+		}
+		_Parent->freeChunkSegments(_Chunk, false);
+		_Parent->_ClassCache.copyFrom(_ClassCache);
+		_Parent->_CurrentObject = _CurrentObject;
+		walk->_NextChunk += 1;
+	} else {
+		_ClassCache.save(_Chunk->_Cache, &_Chunk->_CacheIndex);
+		_Chunk->_LastObject = _CurrentObject;
+	}
+	_Chunk->_Complete = true;
+
+	/* Whoever completes the head chunk writes it and the completed chunks queued behind it */
+	while ((walk->_NextChunk < walk->_ChunkCount) && walk->_Chunks[walk->_NextChunk]._Complete) {
+		RegionChunk* chunk = &walk->_Chunks[walk->_NextChunk];
+
+		_Parent->writeChunkToFile(chunk);
+		_Parent->freeChunkSegments(chunk, true);
+		walk->_NextChunk += 1;
+	}
+
+	omrthread_monitor_notify_all(walk->_Monitor);
+	omrthread_monitor_exit(walk->_Monitor);
+}
+
+bool
+BinaryHeapDumpWriter::deferFirstObjectRecord(j9object_t object, J9Class* clazz)
+{
+	/* Records are only ever encoded at object boundaries, so this is where the worker can take */
+	/* over the file once its chunk reaches the head                                             */
+	if (_MayWriteToParent && !_WritingToParent) {
+		adoptFileState();
+	}
+
+	if (_WritingToParent || (_Chunk->_FirstObject != 0)) {
+		return false;
+	}
+
+	/* Make the cache update the merge will make: it never writes this record in short format, */
+	/* so a normal object always adds its class                                                 */
+	if (!J9ROMCLASS_IS_ARRAY(clazz->romClass)) {
+		_ClassCache.add(J9VM_J9CLASS_TO_HEAPCLASS(clazz));
+	}
+
+	_Chunk->_FirstObject = object;
+	_CurrentObject = object;
+
+	return true;
+}
+
+bool
+BinaryHeapDumpWriter::reserveChunkSpace(IDATA length)
+{
+	ParallelWalk* walk = _Parent->_Walk;
+	ChunkSegment* segment = _Chunk->_Tail;
+
+	if ((segment != 0) && ((segment->_Length + length) <= chunkSegmentSize())) {
+		return true;
+	}
+
+	if ((segment != 0) && _WritingToParent) {
+		/* The file is ours until the region ends - write the segment out and reuse it */
+		omrthread_monitor_enter(walk->_Monitor);
+		_Parent->writeCharacters(segment->data(), segment->_Length);
+		_Error = _Parent->_Error;
+		omrthread_monitor_exit(walk->_Monitor);
+
+		segment->_Length = 0;
+		return !_Error;
+	}
+
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	UDATA segmentSize = chunkSegmentSize();
+
+	if (!_WritingToParent) {
+		/* A large region can run far ahead of the file on its own, so the pending limit is also enforced */
+		/* here: wait for the file to catch up, or for this chunk to reach the head, which never waits    */
+		/* (beginRegionChunk) and adopts the file at the next object boundary                             */
+		omrthread_monitor_enter(walk->_Monitor);
+		while (!_Parent->_Error && (walk->_NextChunk != _ChunkIndex) && (walk->_PendingBytes >= pendingChunkBytesLimit())) {
+			omrthread_monitor_wait(walk->_Monitor);
+		}
+		if (_Parent->_Error) {
+			_Error = true;
+			omrthread_monitor_exit(walk->_Monitor);
+			return false;
+		}
+		walk->_PendingBytes += segmentSize;
+		_MayWriteToParent = (walk->_NextChunk == _ChunkIndex);
+		omrthread_monitor_exit(walk->_Monitor);
+	}
+
+	ChunkSegment* newSegment = (ChunkSegment*)j9mem_allocate_memory(sizeof(ChunkSegment) + segmentSize + (segmentSize / 8), OMRMEM_CATEGORY_VM);
+
+	if (newSegment == 0) {
+		if (!_WritingToParent) {
+			omrthread_monitor_enter(walk->_Monitor);
+			walk->_PendingBytes -= segmentSize;
+			omrthread_monitor_exit(walk->_Monitor);
+		}
+		_Error = true;
+		_Parent->reportParallelWalkError("unable to allocate parallel walk buffer");
+		return false;
+	}
+
+	newSegment->_Next   = 0;
+	newSegment->_Length = 0;
+	memset(newSegment->shortRecordMap(), 0, segmentSize / 8);
+
+	if (segment != 0) {
+		segment->_Next = newSegment;
+	} else {
+		_Chunk->_Head = newSegment;
+	}
+	_Chunk->_Tail = newSegment;
+
+	return true;
+}
+
+void
+BinaryHeapDumpWriter::adoptFileState(void)
+{
+	ParallelWalk* walk = _Parent->_Walk;
+
+	omrthread_monitor_enter(walk->_Monitor);
+
+	/* Every earlier chunk has been written: write what has been encoded so far and carry on from */
+	/* the file's state, writing straight to the file                                              */
+	_ClassCache.save(_Chunk->_Cache, &_Chunk->_CacheIndex);
+	_Chunk->_LastObject = _CurrentObject;
+	_Parent->writeChunkToFile(_Chunk);
+	_Parent->freeChunkSegments(_Chunk, true);
+	_Chunk->_FirstObject = 0;
+
+	_ClassCache.copyFrom(_Parent->_ClassCache);
+	_CurrentObject = _Parent->_CurrentObject;
+	_WritingToParent = true;
+	_MayWriteToParent = false;
+	_Error = _Error || _Parent->_Error;
+
+	/* The chunk's buffered bytes no longer count against the pending limit */
+	omrthread_monitor_notify_all(walk->_Monitor);
+	omrthread_monitor_exit(walk->_Monitor);
+}
+
+void
+BinaryHeapDumpWriter::writeChunkToFile(RegionChunk* chunk)
+{
+	/* NB : Called with the walk monitor held */
+	if ((chunk->_FirstObject == 0) || _Error) {
+		return;
+	}
+
+	/* Write the deferred first object against the file's state */
+	int rotation = _ClassCache.index();
+	J9MM_IterateObjectDescriptor objectDescriptor;
+
+	_VirtualMachine->memoryManagerFunctions->j9mm_initialize_object_descriptor(_VirtualMachine, &objectDescriptor, chunk->_FirstObject);
+	_SuppressShortRecord = true;
+	writeObjectRecord(&objectDescriptor);
+	_SuppressShortRecord = false;
+
+	/* Write the rest, moving the short records' class cache indices onto the file's cache */
+	for (ChunkSegment* segment = chunk->_Head; segment != 0; segment = segment->_Next) {
+		if (rotation != 0) {
+			char* data = segment->data();
+			U_8*  map  = segment->shortRecordMap();
+
+			for (UDATA i = 0; i < segment->_Length; i++) {
+				if ((map[i / 8] & (1 << (i % 8))) != 0) {
+					int flags = (U_8)data[i];
+					int index = (((flags >> 5) & 0x03) + rotation) % 4;
+
+					data[i] = (char)((flags & ~0x60) | (index << 5));
+				}
+			}
+		}
+
+		writeCharacters(segment->data(), segment->_Length);
+		if (_Error) {
+			return;
+		}
+	}
+
+	_ClassCache.merge(chunk->_Cache, chunk->_CacheIndex, rotation);
+	_CurrentObject = chunk->_LastObject;
+}
+
+void
+BinaryHeapDumpWriter::freeChunkSegments(RegionChunk* chunk, bool pending)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	ChunkSegment* segment = chunk->_Head;
+
+	while (segment != 0) {
+		ChunkSegment* next = segment->_Next;
+
+		j9mem_free_memory(segment);
+		if (pending) {
+			_Walk->_PendingBytes -= chunkSegmentSize();
+		}
+		segment = next;
+	}
+
+	chunk->_Head = 0;
+	chunk->_Tail = 0;
+}
+
+void
+BinaryHeapDumpWriter::reportParallelWalkError(const char* reason)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	omrthread_monitor_enter(_Walk->_Monitor);
+	if (!_Error) {
+		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", reason);
+		Trc_dump_reportDumpError_Event2("Heap", reason);
+		_Error = true;
+	}
+	omrthread_monitor_notify_all(_Walk->_Monitor);
+	omrthread_monitor_exit(_Walk->_Monitor);
+}
+
+void
+BinaryHeapDumpWriter::writeShortObjectRecordTag(int flags)
+{
+	/* A worker's short records refer to its own class cache, so note where they start */
+	if ((_Parent != 0) && !_WritingToParent && !_Error && reserveChunkSpace(1)) {
+		ChunkSegment* segment = _Chunk->_Tail;
+
+		segment->shortRecordMap()[segment->_Length / 8] |= (U_8)(1 << (segment->_Length % 8));
+	}
+
+	writeNumber(flags, 1);
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* Iterator call back functions                                                                   */
@@ -2459,6 +3071,42 @@ binaryHeapDumpObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor*
 	return ((BinaryHeapDumpWriter*)userData)->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
 }
 
+static jvmtiIterationControl
+binaryHeapDumpRegionRecorderCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData)
+{
+	HeapDumpRegionList* regionList = (HeapDumpRegionList*)userData;
+
+	/* NB : The first pass only counts the regions */
+	if (regionList->count < regionList->capacity) {
+		regionList->regionStarts[regionList->count] = regionDescription->regionStart;
+	}
+	regionList->count++;
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+binaryHeapDumpParallelRegionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, UDATA workerID, void* userData)
+{
+	BinaryHeapDumpWriter* heapDumpWriter = (BinaryHeapDumpWriter*)userData;
+	BinaryHeapDumpWriter::ParallelWalk* walk = heapDumpWriter->_Walk;
+
+	/* Regions are handed out in the order they were recorded, so search on from this worker's last one */
+	UDATA chunkIndex = walk->_WorkerCursors[workerID];
+	while ((chunkIndex < walk->_ChunkCount) && (walk->_RegionStarts[chunkIndex] != regionDescription->regionStart)) {
+		chunkIndex++;
+	}
+
+	if (chunkIndex == walk->_ChunkCount) {
+		heapDumpWriter->reportParallelWalkError("heap region not found");
+		return JVMTI_ITERATION_ABORT;
+	}
+	walk->_WorkerCursors[workerID] = chunkIndex + 1;
+
+	BinaryHeapDumpWriter chunkWriter(heapDumpWriter, &walk->_Chunks[chunkIndex], chunkIndex);
+	chunkWriter.writeRegionChunk(regionDescription);
+	return (chunkWriter._Error || heapDumpWriter->_Error) ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+}
+
 static jvmtiIterationControl
 binaryHeapDumpObjectReferenceIteratorTraitsCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData)
 {
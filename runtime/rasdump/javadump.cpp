@@ -504,11 +504,14 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	CALL_PROTECT(writeMemorySection, _Error);
 
 	/* The monitor section is crash prone as objects mutate under it.
-	 * Lock ordering imposed by the lock inflation path means that we have to get the monitorTableMutex ahead of the
-	 * thread lock as we will attempt to get it again for uninflated locks when calling getVMThreadRawState while looking
-	 * for waiting threads on any given monitor
+	 * Lock ordering imposed by the lock inflation path means that we have to get the monitor table mutexes ahead of the
+	 * thread lock as we will attempt to get them again for uninflated locks when calling getVMThreadRawState while looking
+	 * for waiting threads on any given monitor. The mutexes are always taken in table order, so this cannot deadlock
+	 * with inflation, which only ever holds the mutex of a single table.
 	 */
-	omrthread_monitor_enter(_VirtualMachine->monitorTableMutex);
+	for (UDATA tableIndex = 0; tableIndex < _VirtualMachine->monitorTableCount; tableIndex++) {
+		omrthread_monitor_enter(_VirtualMachine->monitorTableMutexes[tableIndex]);
+	}
 	omrthread_t self = omrthread_self();
 	if (!omrthread_lib_try_lock(self)) {
 		/* got both locks so we shouldn't deadlock getting thread state */
@@ -523,7 +526,9 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 			"1LKREGMONDUMP  JVM System Monitor Dump unavailable [locked]\n"
 			"NULL           ------------------------------------------------------------------------\n");
 	}
-	omrthread_monitor_exit(_VirtualMachine->monitorTableMutex);
+	for (UDATA tableIndex = _VirtualMachine->monitorTableCount; tableIndex > 0; tableIndex--) {
+		omrthread_monitor_exit(_VirtualMachine->monitorTableMutexes[tableIndex - 1]);
+	}
 
 	/* If request=preempt (for native stack collection) we attempt to acquire the mutex and note if we got it */
 	if (J9_ARE_ANY_BITS_SET(_Agent->requestMask, J9RAS_DUMP_DO_PREEMPT_THREADS)) {
@@ -1833,7 +1838,7 @@ JavaCoreDumpWriter::writeNativeAllocator(const char * name, U_32 depth, BOOLEAN
 void
 JavaCoreDumpWriter::writeMonitorSection(void)
 {
-	/* The code calling this method must have taken the monitorTableMutex and the thread library monitor_mutex
+	/* The code calling this method must have taken the monitor table mutexes and the thread library monitor_mutex
 	 * (in that order) prior to calling and must release those locks on return from this method.
 	 */
 	J9ThreadMonitor *monitor = NULL;
@@ -1991,6 +1996,37 @@ JavaCoreDumpWriter::writeThreadSection(void)
 	_OutputStream.writeInteger(_VirtualMachine->daemonThreadCount, "%i");
 	_OutputStream.writeCharacters("\n");
 
+	/* Write the time-to-safe-point histograms, skipping empty buckets, if requested with -XX:+ShowSafePointHistogram */
+	RasDumpGlobalStorage *dumpGlobals = (RasDumpGlobalStorage *)_VirtualMachine->j9rasdumpGlobalStorage;
+	if (J9_ARE_ANY_BITS_SET(dumpGlobals->dumpFlags, J9RAS_JAVADUMP_SHOW_SAFE_POINT_HISTOGRAM)) {
+		_OutputStream.writeCharacters("NULL\n");
+		_OutputStream.writeCharacters(
+			"1XMSAFEPOINT   Time to safe point (microseconds): exclusive requests, thread handshakes\n");
+		for (UDATA bucket = 0; bucket < J9_TIME_TO_SAFE_POINT_HISTOGRAM_SIZE; bucket++) {
+			UDATA exclusiveCount = _VirtualMachine->timeToSafePointHistogram.exclusive[bucket];
+			UDATA handshakeCount = _VirtualMachine->timeToSafePointHistogram.handshake[bucket];
+			if ((0 != exclusiveCount) || (0 != handshakeCount)) {
+				if (0 == bucket) {
+					_OutputStream.writeCharacters("2XMSAFEPOINT       < 1: ");
+				} else if ((J9_TIME_TO_SAFE_POINT_HISTOGRAM_SIZE - 1) == bucket) {
+					_OutputStream.writeCharacters("2XMSAFEPOINT       >= ");
+					_OutputStream.writeInteger((UDATA)1 << (bucket - 1), "%zu");
+					_OutputStream.writeCharacters(": ");
+				} else {
+					_OutputStream.writeCharacters("2XMSAFEPOINT       ");
+					_OutputStream.writeInteger((UDATA)1 << (bucket - 1), "%zu");
+					_OutputStream.writeCharacters(" - ");
+					_OutputStream.writeInteger(((UDATA)1 << bucket) - 1, "%zu");
+					_OutputStream.writeCharacters(": ");
+				}
+				_OutputStream.writeInteger(exclusiveCount, "%zu");
+				_OutputStream.writeCharacters(", ");
+				_OutputStream.writeInteger(handshakeCount, "%zu");
+				_OutputStream.writeCharacters("\n");
+			}
+		}
+	}
+
 #if !defined(OSX)
 	/* if thread preempt is enabled, and we have the lock, then collect the native stacks */
 	if (J9_ARE_ANY_BITS_SET(_Agent->requestMask, J9RAS_DUMP_DO_PREEMPT_THREADS) && _PreemptLocked
@@ -2058,7 +2094,6 @@ JavaCoreDumpWriter::writeThreadSection(void)
 	}
 
 #if JAVA_SPEC_VERSION >= 21
-	RasDumpGlobalStorage *dumpGlobals = (RasDumpGlobalStorage *)_VirtualMachine->j9rasdumpGlobalStorage;
 	if (J9_ARE_ANY_BITS_SET(dumpGlobals->dumpFlags, J9RAS_JAVADUMP_SHOW_UNMOUNTED_THREAD_STACKS)) {
 		/* Show unmounted thread stacktraces. */
 		struct walkClosure closure;
@@ -308,6 +308,48 @@ addDoubleAndDoubleFromPointer(double *doubleArg1, double doubleArg2)
 	return doubleSum;
 }
 
+/**
+ * Add a byte, an int, two longs, two floats and a double.
+ * The layout string of this signature has the same hash code as the one of
+ * addIntDoubleByteShortDoubleLongShort.
+ *
+ * @param arg1 a byte
+ * @param arg2 an int
+ * @param arg3 a long
+ * @param arg4 a long
+ * @param arg5 a float
+ * @param arg6 a double
+ * @param arg7 a float
+ * @return the sum
+ */
+double
+addByteIntLongLongFloatDoubleFloat(char arg1, int arg2, LONG arg3, LONG arg4, float arg5, double arg6, float arg7)
+{
+	double doubleSum = arg1 + arg2 + arg3 + arg4 + arg5 + arg6 + arg7;
+	return doubleSum;
+}
+
+/**
+ * Add an int, two doubles, a byte, two shorts and a long.
+ * The layout string of this signature has the same hash code as the one of
+ * addByteIntLongLongFloatDoubleFloat.
+ *
+ * @param arg1 an int
+ * @param arg2 a double
+ * @param arg3 a byte
+ * @param arg4 a short
+ * @param arg5 a double
+ * @param arg6 a long
+ * @param arg7 a short
+ * @return the sum
+ */
+double
+addIntDoubleByteShortDoubleLongShort(int arg1, double arg2, char arg3, short arg4, double arg5, LONG arg6, short arg7)
+{
+	double doubleSum = arg1 + arg2 + arg3 + arg4 + arg5 + arg6 + arg7;
+	return doubleSum;
+}
+
 /**
  * Add a boolean and all boolean elements of a struct with the XOR (^) operator.
  *
@@ -430,3 +430,26 @@ Java_j9vm_test_jni_CriticalRegionTest_acquireDiscardAndGC(JNIEnv * env, jclass c
 	(*env)->ReleasePrimitiveArrayCritical(env, array, elems1, 0);
 	return result;
 }
+
+jboolean JNICALL
+Java_j9vm_test_arraylets_OffHeapArrayTest_verifyAndIncrementCritical(JNIEnv * env, jclass clazz, jbyteArray array, jbyte seed)
+{
+	U_8* elems;
+	jboolean result = JNI_TRUE;
+	jint elementCount;
+	jint i;
+
+	elementCount = (*env)->GetArrayLength(env, array);
+	elems = (U_8*)(*env)->GetPrimitiveArrayCritical(env, array, NULL);
+	if(NULL == elems) {
+		return JNI_FALSE;
+	}
+	for(i = 0; i < elementCount; i++) {
+		if(elems[i] != (U_8)(seed + i)) {
+			result = JNI_FALSE;
+		}
+		elems[i]++;
+	}
+	(*env)->ReleasePrimitiveArrayCritical(env, array, elems, 0);
+	return result;
+}
@@ -24,6 +24,10 @@ omr_add_exports(j9ben
 	JNI_OnLoad
 	JNI_OnUnload
 	Java_j9vm_test_jni_GetObjectRefTypeTest_getObjectRefTypeTest
+	Java_j9vm_test_jni_GlobalRefTest_createSharedRefs
+	Java_j9vm_test_jni_GlobalRefTest_deleteSharedRefs
+	Java_j9vm_test_jni_GlobalRefTest_churnGlobalRefs
+	Java_j9vm_test_jni_GlobalRefTest_deleteTwice
 	Java_jvmti_test_nativeMethodPrefixes_UnwrappedNative_nat
 	Java_jvmti_test_nativeMethodPrefixes_DirectNative_gac4gac3gac2gac1nat
 	Java_jvmti_test_nativeMethodPrefixes_WrappedNative_nat
@@ -199,6 +203,7 @@ omr_add_exports(j9ben
 	Java_j9vm_test_monitor_Helpers_monitorExit
 	Java_j9vm_test_monitor_Helpers_monitorExitWithException
 	Java_j9vm_test_monitor_Helpers_monitorReserve
+	Java_j9vm_test_monitor_Helpers_isInflated
 	Java_j9vm_test_memchk_NoFree_test
 	Java_j9vm_test_memchk_BlockOverrun_test
 	Java_j9vm_test_memchk_BlockUnderrun_test
@@ -229,6 +234,7 @@ omr_add_exports(j9ben
 	Java_j9vm_test_jni_CriticalRegionTest_acquireAndSleep
 	Java_j9vm_test_jni_CriticalRegionTest_acquireAndCallIn
 	Java_j9vm_test_jni_CriticalRegionTest_acquireDiscardAndGC
+	Java_j9vm_test_arraylets_OffHeapArrayTest_verifyAndIncrementCritical
 	Java_j9vm_test_jni_Utf8Test_testAttachCurrentThreadAsDaemon
 	Java_j9vm_test_memory_MemoryAllocator_allocateMemory
 	Java_j9vm_test_memory_MemoryAllocator_allocateMemory32
@@ -240,4 +246,6 @@ omr_add_exports(j9ben
 	Java_j9vm_test_jni_PthreadTest_attachAndDetach
 	Java_org_openj9_test_contendedfields_FieldUtilities_getObjectAlignmentInBytes
 	Java_org_openj9_test_jep425_VirtualThreadTests_lockSupportPark
+	Java_org_openj9_test_jep425_VirtualThreadTests_getContinuationStackSizeHint
+	Java_org_openj9_test_jep425_VirtualThreadTests_getMaxStackSize
 )
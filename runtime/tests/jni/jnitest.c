@@ -74,6 +74,112 @@ Java_j9vm_test_jni_GetObjectRefTypeTest_getObjectRefTypeTest(JNIEnv *env, jclass
 	return rc;
 }
 
+#define GLOBAL_REF_TEST_MAX_REFS 64
+
+jlongArray JNICALL
+Java_j9vm_test_jni_GlobalRefTest_createSharedRefs(JNIEnv *env, jclass clazz, jobjectArray objects)
+{
+	jsize count = (*env)->GetArrayLength(env, objects);
+	jlongArray handles = (*env)->NewLongArray(env, count);
+	jsize i = 0;
+
+	if (NULL == handles) {
+		return NULL;
+	}
+	for (i = 0; i < count; i++) {
+		jobject element = (*env)->GetObjectArrayElement(env, objects, i);
+		jlong handle = (jlong)(UDATA)(*env)->NewGlobalRef(env, element);
+		(*env)->SetLongArrayRegion(env, handles, i, 1, &handle);
+		(*env)->DeleteLocalRef(env, element);
+	}
+	return handles;
+}
+
+void JNICALL
+Java_j9vm_test_jni_GlobalRefTest_deleteSharedRefs(JNIEnv *env, jclass clazz, jlongArray handles)
+{
+	jsize count = (*env)->GetArrayLength(env, handles);
+	jsize i = 0;
+
+	/* every thread deletes the same refs, only the first delete of each one may free its slot */
+	for (i = 0; i < count; i++) {
+		jlong handle = 0;
+		(*env)->GetLongArrayRegion(env, handles, i, 1, &handle);
+		(*env)->DeleteGlobalRef(env, (jobject)(UDATA)handle);
+	}
+}
+
+jboolean JNICALL
+Java_j9vm_test_jni_GlobalRefTest_churnGlobalRefs(JNIEnv *env, jclass clazz, jobjectArray objects, jint iterations)
+{
+	jobject refs[GLOBAL_REF_TEST_MAX_REFS];
+	jsize count = (*env)->GetArrayLength(env, objects);
+	jint iteration = 0;
+	jboolean rc = JNI_TRUE;
+
+	if (count > GLOBAL_REF_TEST_MAX_REFS) {
+		count = GLOBAL_REF_TEST_MAX_REFS;
+	}
+	for (iteration = 0; (JNI_TRUE == rc) && (iteration < iterations); iteration++) {
+		jsize i = 0;
+		jsize j = 0;
+
+		for (i = 0; i < count; i++) {
+			jobject element = (*env)->GetObjectArrayElement(env, objects, i);
+			refs[i] = (*env)->NewGlobalRef(env, element);
+			(*env)->DeleteLocalRef(env, element);
+		}
+
+		/* each live ref has its own slot, refers to its object and is reported as a global ref */
+		for (i = 0; i < count; i++) {
+			jobject element = (*env)->GetObjectArrayElement(env, objects, i);
+			if (!(*env)->IsSameObject(env, refs[i], element)) {
+				rc = JNI_FALSE;
+			}
+			if (JNIGlobalRefType != (*env)->GetObjectRefType(env, refs[i])) {
+				rc = JNI_FALSE;
+			}
+			for (j = 0; j < i; j++) {
+				if (refs[i] == refs[j]) {
+					rc = JNI_FALSE;
+				}
+			}
+			(*env)->DeleteLocalRef(env, element);
+		}
+
+		for (i = 0; i < count; i++) {
+			(*env)->DeleteGlobalRef(env, refs[i]);
+		}
+	}
+	return rc;
+}
+
+jboolean JNICALL
+Java_j9vm_test_jni_GlobalRefTest_deleteTwice(JNIEnv *env, jclass clazz, jobject first, jobject second)
+{
+	jobject ref = (*env)->NewGlobalRef(env, first);
+	jobject firstRef = NULL;
+	jobject secondRef = NULL;
+	jboolean rc = JNI_TRUE;
+
+	/* the second delete must not free the slot again, or it would be handed out twice */
+	(*env)->DeleteGlobalRef(env, ref);
+	(*env)->DeleteGlobalRef(env, ref);
+
+	firstRef = (*env)->NewGlobalRef(env, first);
+	secondRef = (*env)->NewGlobalRef(env, second);
+	if ((firstRef == secondRef)
+		|| !(*env)->IsSameObject(env, firstRef, first)
+		|| !(*env)->IsSameObject(env, secondRef, second)
+	) {
+		rc = JNI_FALSE;
+	}
+	(*env)->DeleteGlobalRef(env, firstRef);
+	(*env)->DeleteGlobalRef(env, secondRef);
+
+	return rc;
+}
+
 jint JNICALL
 Java_jvmti_test_nativeMethodPrefixes_UnwrappedNative_nat(JNIEnv *env, jclass clazz)
 {
@@ -1037,3 +1143,19 @@ Java_org_openj9_test_jep425_VirtualThreadTests_lockSupportPark(JNIEnv *env, jcla
 	}
 	return result;
 }
+
+jlong JNICALL
+Java_org_openj9_test_jep425_VirtualThreadTests_getContinuationStackSizeHint(JNIEnv *env, jclass cls)
+{
+	jlong hint = 0;
+#if JAVA_SPEC_VERSION >= 19
+	hint = (jlong)((J9VMThread *)env)->javaVM->continuationStackSizeHint;
+#endif /* JAVA_SPEC_VERSION >= 19 */
+	return hint;
+}
+
+jlong JNICALL
+Java_org_openj9_test_jep425_VirtualThreadTests_getMaxStackSize(JNIEnv *env, jclass cls)
+{
+	return (jlong)((J9VMThread *)env)->javaVM->stackSize;
+}
@@ -50,6 +50,18 @@ extern "C" {
 jboolean JNICALL
 Java_j9vm_test_jni_GetObjectRefTypeTest_getObjectRefTypeTest(JNIEnv *env, jclass clazz, jobject stackArg);
 
+jlongArray JNICALL
+Java_j9vm_test_jni_GlobalRefTest_createSharedRefs(JNIEnv *env, jclass clazz, jobjectArray objects);
+
+void JNICALL
+Java_j9vm_test_jni_GlobalRefTest_deleteSharedRefs(JNIEnv *env, jclass clazz, jlongArray handles);
+
+jboolean JNICALL
+Java_j9vm_test_jni_GlobalRefTest_churnGlobalRefs(JNIEnv *env, jclass clazz, jobjectArray objects, jint iterations);
+
+jboolean JNICALL
+Java_j9vm_test_jni_GlobalRefTest_deleteTwice(JNIEnv *env, jclass clazz, jobject first, jobject second);
+
 /**
 * @brief
 * @param *env
@@ -160,6 +172,16 @@ Java_j9vm_test_monitor_Helpers_monitorExitWithException(JNIEnv * env, jclass cla
 void JNICALL 
 Java_j9vm_test_monitor_Helpers_monitorReserve(JNIEnv * env, jclass clazz, jobject obj);
 
+/**
+* @brief
+* @param *env
+* @param clazz
+* @param obj
+* @return jboolean
+*/
+jboolean JNICALL
+Java_j9vm_test_monitor_Helpers_isInflated(JNIEnv * env, jclass clazz, jobject obj);
+
 
 /* ---------------- jnibench.c ---------------- */
 
@@ -1751,6 +1773,24 @@ Java_jit_test_vich_JNIObjectArray_getObjectArrayElement(JNIEnv *env, jobject obj
 jboolean JNICALL
 Java_org_openj9_test_jep425_VirtualThreadTests_lockSupportPark(JNIEnv *env, jclass cls);
 
+/**
+ * @brief Get the size in bytes used for new continuation stacks when it exceeds the initial stack size.
+ * @param env
+ * @param cls
+ * @return the continuation stack size hint, or 0 if there is none.
+ */
+jlong JNICALL
+Java_org_openj9_test_jep425_VirtualThreadTests_getContinuationStackSizeHint(JNIEnv *env, jclass cls);
+
+/**
+ * @brief Get the maximum Java stack size, as set by -Xss.
+ * @param env
+ * @param cls
+ * @return the maximum stack size in bytes.
+ */
+jlong JNICALL
+Java_org_openj9_test_jep425_VirtualThreadTests_getMaxStackSize(JNIEnv *env, jclass cls);
+
 /**
 * @brief
 * @param env
@@ -2160,6 +2200,9 @@ Java_j9vm_test_jni_CriticalRegionTest_acquireAndCallIn(JNIEnv * env, jclass claz
 jboolean JNICALL
 Java_j9vm_test_jni_CriticalRegionTest_acquireDiscardAndGC(JNIEnv * env, jclass clazz, jbyteArray array, jlongArray addresses);
 
+jboolean JNICALL
+Java_j9vm_test_arraylets_OffHeapArrayTest_verifyAndIncrementCritical(JNIEnv * env, jclass clazz, jbyteArray array, jbyte seed);
+
 
 #ifdef __cplusplus
 }
@@ -99,5 +99,34 @@ Java_j9vm_test_monitor_Helpers_monitorReserve(JNIEnv * env, jclass clazz, jobjec
 #endif
 }
 
+jboolean JNICALL
+Java_j9vm_test_monitor_Helpers_isInflated(JNIEnv * env, jclass clazz, jobject objRef)
+{
+	J9VMThread* vmThread = (J9VMThread*)env;
+	jboolean inflated = JNI_FALSE;
+	j9object_t obj;
+	j9objectmonitor_t* lockEA;
+	jclass errorClazz;
+
+	vmThread->javaVM->internalVMFunctions->internalEnterVMFromJNI(vmThread);
+
+	obj = *(j9object_t*)objRef;
+
+	if (!LN_HAS_LOCKWORD(vmThread, obj)) {
+		vmThread->javaVM->internalVMFunctions->internalExitVMToJNI(vmThread);
+		errorClazz = (*env)->FindClass(env, "java/lang/Error");
+		if (errorClazz != NULL) {
+			(*env)->ThrowNew(env, errorClazz, "Object has no lock word");
+		}
+		return JNI_FALSE;
+	}
 
+	lockEA = J9OBJECT_MONITOR_EA(vmThread, obj);
+	if (J9_LOCK_IS_INFLATED(J9_LOAD_LOCKWORD(vmThread, lockEA))) {
+		inflated = JNI_TRUE;
+	}
 
+	vmThread->javaVM->internalVMFunctions->internalExitVMToJNI(vmThread);
+
+	return inflated;
+}
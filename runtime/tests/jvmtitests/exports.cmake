@@ -38,6 +38,7 @@ omr_add_exports(jvmtitest
 	Java_com_ibm_jvmti_tests_iterateThroughHeap_ith001Sub_testFieldPrimitive
 	Java_com_ibm_jvmti_tests_iterateThroughHeap_ith001Sub_testStringPrimitive
 	Java_com_ibm_jvmti_tests_iterateThroughHeap_ith001Sub_tagObject
+	Java_com_ibm_jvmti_tests_iterateThroughHeap_ith002_checkOrder
 	Java_com_ibm_jvmti_tests_iterateOverHeap_ioh001_iterate
 	Java_com_ibm_jvmti_tests_getClassFields_gcf001_checkClassFields
 	Java_com_ibm_jvmti_tests_getStackTrace_gst001_check
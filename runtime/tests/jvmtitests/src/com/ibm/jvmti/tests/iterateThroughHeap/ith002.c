@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+#include <string.h>
+
+#include "jvmti_test.h"
+
+static agentEnv * env;
+
+/* incremented on every GC; a GC between the two heap walks may move the instances */
+static volatile jint gcCount = 0;
+
+typedef struct ith002_data {
+	jlong lastTag;
+	jint  instanceCount;
+	jint  outOfOrderCount;
+} ith002_data;
+
+static void JNICALL ith002GarbageCollectionStart(jvmtiEnv *jvmti_env);
+static jint JNICALL ith002TagCallback(jlong class_tag, jlong size, jlong* tag_ptr, jint length, void* user_data);
+static jint JNICALL ith002OrderCallback(jlong class_tag, jlong size, jlong* tag_ptr, jint length, void* user_data);
+static jint ith002CompareWalks(jvmtiEnv *jvmti_env, jclass klass, jint *filteredCount, ith002_data *data);
+
+jint JNICALL
+ith002(agentEnv * agent_env, char * args)
+{
+	jvmtiError err;
+	jvmtiCapabilities capabilities;
+	jvmtiEventCallbacks callbacks;
+	JVMTI_ACCESS_FROM_AGENT(agent_env);
+
+	if (!ensureVersion(agent_env, JVMTI_VERSION_1_1)) {
+		return JNI_ERR;
+	}
+
+	env = agent_env;
+
+	memset(&capabilities, 0, sizeof(jvmtiCapabilities));
+	capabilities.can_tag_objects = 1;
+	capabilities.can_generate_garbage_collection_events = 1;
+	err = (*jvmti_env)->AddCapabilities(jvmti_env, &capabilities);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to AddCapabilities");
+		return JNI_ERR;
+	}
+
+	memset(&callbacks, 0, sizeof(jvmtiEventCallbacks));
+	callbacks.GarbageCollectionStart = ith002GarbageCollectionStart;
+	err = (*jvmti_env)->SetEventCallbacks(jvmti_env, &callbacks, sizeof(jvmtiEventCallbacks));
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to set callback for GarbageCollectionStart events");
+		return JNI_ERR;
+	}
+
+	err = (*jvmti_env)->SetEventNotificationMode(jvmti_env, JVMTI_ENABLE, JVMTI_EVENT_GARBAGE_COLLECTION_START, NULL);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to enable GarbageCollectionStart event");
+		return JNI_ERR;
+	}
+
+	return JNI_OK;
+}
+
+static void JNICALL
+ith002GarbageCollectionStart(jvmtiEnv *jvmti_env)
+{
+	gcCount += 1;
+}
+
+/**
+ * Class filtered walk: number the instances in the order they are reported.
+ */
+static jint JNICALL
+ith002TagCallback(jlong class_tag, jlong size, jlong* tag_ptr, jint length, void* user_data)
+{
+	ith002_data *data = (ith002_data *) user_data;
+
+	data->instanceCount += 1;
+	*tag_ptr = data->instanceCount;
+
+	return JVMTI_VISIT_OBJECTS;
+}
+
+/**
+ * Unfiltered walk over the tagged objects: the numbers must come back in increasing order.
+ */
+static jint JNICALL
+ith002OrderCallback(jlong class_tag, jlong size, jlong* tag_ptr, jint length, void* user_data)
+{
+	ith002_data *data = (ith002_data *) user_data;
+
+	if (*tag_ptr <= data->lastTag) {
+		data->outOfOrderCount += 1;
+	}
+	data->lastTag = *tag_ptr;
+	data->instanceCount += 1;
+	*tag_ptr = 0;
+
+	return JVMTI_VISIT_OBJECTS;
+}
+
+/**
+ * Walk the instances of klass with the class filter, then walk the whole heap.
+ * Returns the number of GCs that ran in between; the results are only comparable if it is 0.
+ */
+static jint
+ith002CompareWalks(jvmtiEnv *jvmti_env, jclass klass, jint *filteredCount, ith002_data *data)
+{
+	jvmtiError err;
+	jvmtiHeapCallbacks callbacks;
+	jint gcCountBefore = gcCount;
+
+	memset(&callbacks, 0x00, sizeof(jvmtiHeapCallbacks));
+	callbacks.heap_iteration_callback = ith002TagCallback;
+	memset(data, 0x00, sizeof(ith002_data));
+	err = (*jvmti_env)->IterateThroughHeap(jvmti_env, JVMTI_HEAP_FILTER_TAGGED, klass, &callbacks, data);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to IterateThroughHeap (class filter)");
+		return -1;
+	}
+	*filteredCount = data->instanceCount;
+
+	/* the unfiltered walk reports only the objects tagged above and clears their tags */
+	callbacks.heap_iteration_callback = ith002OrderCallback;
+	memset(data, 0x00, sizeof(ith002_data));
+	err = (*jvmti_env)->IterateThroughHeap(jvmti_env, JVMTI_HEAP_FILTER_UNTAGGED, NULL, &callbacks, data);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to IterateThroughHeap (no class filter)");
+		return -1;
+	}
+
+	return gcCount - gcCountBefore;
+}
+
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_iterateThroughHeap_ith002_checkOrder(JNIEnv * jni_env, jclass clazz, jclass klass, jint expectedCount)
+{
+	ith002_data data;
+	jint filteredCount = 0;
+	jint gcs = 0;
+	jint attempt = 0;
+	JVMTI_ACCESS_FROM_AGENT(env);
+
+	/* retry while GCs (e.g. from a concurrent cycle) move the instances between the two walks */
+	do {
+		gcs = ith002CompareWalks(jvmti_env, klass, &filteredCount, &data);
+		if (gcs < 0) {
+			return JNI_FALSE;
+		}
+		attempt += 1;
+	} while ((gcs > 0) && (attempt < 100));
+
+	if (filteredCount != expectedCount) {
+		error(env, JVMTI_ERROR_INTERNAL, "Class filtered IterateThroughHeap reported %d instances, expected %d", filteredCount, expectedCount);
+		return JNI_FALSE;
+	}
+
+	if (data.instanceCount != filteredCount) {
+		error(env, JVMTI_ERROR_INTERNAL, "Unfiltered IterateThroughHeap reported %d tagged instances, the class filtered walk %d", data.instanceCount, filteredCount);
+		return JNI_FALSE;
+	}
+
+	if ((0 == gcs) && (0 != data.outOfOrderCount)) {
+		error(env, JVMTI_ERROR_INTERNAL, "Class filtered IterateThroughHeap reported %d instances out of heap order", data.outOfOrderCount);
+		return JNI_FALSE;
+	}
+
+	return JNI_TRUE;
+}
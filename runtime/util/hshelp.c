@@ -1075,6 +1075,8 @@ fixITables(J9VMThread * currentThread, J9HashTable * classPairs)
 				fixClassSlot(currentThread, &iTable->interfaceClass, classPairs);
 				iTable = iTable->next;
 			}
+			/* The iTable hash is keyed by the replaced interface classes - fall back to walking the iTable list */
+			clazz->iTableHash = NULL;
 		}
 
 		if (J9_IS_CLASS_OBSOLETE(clazz)) {
@@ -1101,6 +1103,8 @@ fixITables(J9VMThread * currentThread, J9HashTable * classPairs)
 		}
 
 		clazz->lastITable = (J9ITable *) &invalidITable;
+		/* The iTable hash may refer to the iTables of replaced superclasses */
+		clazz->iTableHash = NULL;
 
 		if (clazz->iTable) {
 			J9Class * superClass = GET_SUPERCLASS(clazz);
@@ -1172,6 +1176,7 @@ fixITables(J9VMThread * currentThread, J9HashTable * classPairs)
 	while (clazz != NULL) {
 		if (J9_IS_CLASS_OBSOLETE(clazz)) {
 			clazz->iTable = J9_CURRENT_CLASS(clazz)->iTable;
+			clazz->iTableHash = NULL;
 		}
 		clazz = vmFuncs->allClassesNextDo(&classWalkState);
 	}
@@ -2565,6 +2570,8 @@ swapClassesForFastHCR(J9Class *originalClass, J9Class *obsoleteClass)
 	SWAP_MEMBER(jniIDs, void **, originalClass, obsoleteClass);
 	SWAP_MEMBER(romClass, J9ROMClass *, originalClass, obsoleteClass);
 	SWAP_MEMBER(ramMethods, J9Method *, originalClass, obsoleteClass);
+	/* The method lookup index describes the swapped romClass and ramMethods */
+	SWAP_MEMBER(methodLookupIndex, J9MethodLookupIndex *, originalClass, obsoleteClass);
 	SWAP_MEMBER(ramConstantPool, J9ConstantPool *, originalClass, obsoleteClass);
 	originalClass->ramConstantPool->ramClass = originalClass;
 	obsoleteClass->ramConstantPool->ramClass = obsoleteClass;
@@ -202,7 +202,7 @@ monitorTablePeekMonitor(J9JavaVM *vm, j9object_t object);
  * Search the monitor tables in vm->monitorTableList for the inflated monitor corresponding to an object.
  * Similar to monitorTableAt(), but doesn't add the monitor if it isn't found in the hashtable.
  *
- * This function may block on vm->monitorTableMutex.
+ * This function may block on the entry of vm->monitorTableMutexes guarding the object's monitor table.
  * This function can work out-of-process.
  *
  * @param[in] vm the JavaVM. For out-of-process: may be a local or target pointer.
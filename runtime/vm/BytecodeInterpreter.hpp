@@ -7773,59 +7773,48 @@ resolve:
 			UDATA methodIndex = methodIndexAndArgCount >> J9_ITABLE_INDEX_SHIFT;
 			J9ROMMethod *romMethod = NULL;
 
-			/* Run search in receiverClass->lastITable */
-			J9ITable *iTable = receiverClass->lastITable;
-			if (interfaceClass == iTable->interfaceClass) {
-				goto foundITableCache;
-			}
-
-			/* Start search from receiverClass->iTable */
-			iTable = (J9ITable*)receiverClass->iTable;
-			while (NULL != iTable) {
-				if (interfaceClass == iTable->interfaceClass) {
-					receiverClass->lastITable = iTable;
-foundITableCache:
-					if (J9_UNEXPECTED(J9_ARE_ANY_BITS_SET(methodIndexAndArgCount, J9_ITABLE_INDEX_TAG_BITS))) {
-						/* Object or private interface method invoke */
-						if (J9_ARE_ANY_BITS_SET(methodIndexAndArgCount, J9_ITABLE_INDEX_METHOD_INDEX)) {
-							if (J9_ARE_ANY_BITS_SET(methodIndexAndArgCount, J9_ITABLE_INDEX_OBJECT)) {
-								/* Object method not in the vTable */
-								_sendMethod = J9VMJAVALANGOBJECT_OR_NULL(_vm)->ramMethods + methodIndex;
-							} else {
-								/* Private interface method */
-								_sendMethod = interfaceClass->ramMethods + methodIndex;
-							}
+			/* Search the lastITable cache, then the iTable hash or list of receiverClass */
+			J9ITable *iTable = VM_VMHelpers::findITable(receiverClass, interfaceClass);
+			if (NULL != iTable) {
+				if (J9_UNEXPECTED(J9_ARE_ANY_BITS_SET(methodIndexAndArgCount, J9_ITABLE_INDEX_TAG_BITS))) {
+					/* Object or private interface method invoke */
+					if (J9_ARE_ANY_BITS_SET(methodIndexAndArgCount, J9_ITABLE_INDEX_METHOD_INDEX)) {
+						if (J9_ARE_ANY_BITS_SET(methodIndexAndArgCount, J9_ITABLE_INDEX_OBJECT)) {
+							/* Object method not in the vTable */
+							_sendMethod = J9VMJAVALANGOBJECT_OR_NULL(_vm)->ramMethods + methodIndex;
 						} else {
-							/* Object method in the vTable. If methodIndex is
-							 * J9_ITABLE_INDEX_UNRESOLVED_VALUE, the CP entry is unresolved.
-							 * This test is required here because there is no resolve check
-							 * in the main path, so it is possible to get the resolved value
-							 * for interfaceClass, but the unresolved for methodIndexAndArgcCount.
-							 */
-							if (J9_UNEXPECTED(J9_ITABLE_INDEX_UNRESOLVED_VALUE == methodIndex)) {
-								goto retry;
-							}
-							_sendMethod = *(J9Method**)((UDATA)receiverClass + methodIndex);
+							/* Private interface method */
+							_sendMethod = interfaceClass->ramMethods + methodIndex;
 						}
 					} else {
-						/* Standard interface method */
-						_sendMethod = *(J9Method**)((UDATA)receiverClass + ((UDATA*)(iTable + 1))[methodIndex]);
-					}
-					romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(_sendMethod);
-					if (J9_ARE_NO_BITS_SET(romMethod->modifiers, J9AccPublic | J9AccPrivate)) {
-						/* We need a frame to describe the method arguments (in particular, for the case where we got here directly from the JIT) */
-						buildMethodFrame(REGISTER_ARGS, _sendMethod, jitStackFrameFlags(REGISTER_ARGS, 0));
-						updateVMStruct(REGISTER_ARGS);
-						setIllegalAccessErrorNonPublicInvokeInterface(_currentThread, _sendMethod);
-						VMStructHasBeenUpdated(REGISTER_ARGS);
-						rc = GOTO_THROW_CURRENT_EXCEPTION;
-						goto done;
+						/* Object method in the vTable. If methodIndex is
+						 * J9_ITABLE_INDEX_UNRESOLVED_VALUE, the CP entry is unresolved.
+						 * This test is required here because there is no resolve check
+						 * in the main path, so it is possible to get the resolved value
+						 * for interfaceClass, but the unresolved for methodIndexAndArgcCount.
+						 */
+						if (J9_UNEXPECTED(J9_ITABLE_INDEX_UNRESOLVED_VALUE == methodIndex)) {
+							goto retry;
+						}
+						_sendMethod = *(J9Method**)((UDATA)receiverClass + methodIndex);
 					}
-					profileInvokeReceiver(REGISTER_ARGS, receiverClass, _literals, _sendMethod);
-					_pc += offset;
+				} else {
+					/* Standard interface method */
+					_sendMethod = *(J9Method**)((UDATA)receiverClass + ((UDATA*)(iTable + 1))[methodIndex]);
+				}
+				romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(_sendMethod);
+				if (J9_ARE_NO_BITS_SET(romMethod->modifiers, J9AccPublic | J9AccPrivate)) {
+					/* We need a frame to describe the method arguments (in particular, for the case where we got here directly from the JIT) */
+					buildMethodFrame(REGISTER_ARGS, _sendMethod, jitStackFrameFlags(REGISTER_ARGS, 0));
+					updateVMStruct(REGISTER_ARGS);
+					setIllegalAccessErrorNonPublicInvokeInterface(_currentThread, _sendMethod);
+					VMStructHasBeenUpdated(REGISTER_ARGS);
+					rc = GOTO_THROW_CURRENT_EXCEPTION;
 					goto done;
 				}
-				iTable = iTable->next;
+				profileInvokeReceiver(REGISTER_ARGS, receiverClass, _literals, _sendMethod);
+				_pc += offset;
+				goto done;
 			}
 			if (!J9RAMINTERFACEMETHODREF_RESOLVED(interfaceClass, methodIndexAndArgCount)) {
 				goto resolve;
@@ -9411,19 +9400,9 @@ throw_npe:
 		iTableIndex = (UDATA)J9OBJECT_U64_LOAD(_currentThread, memberNameObject, _vm->vmindexOffset);
 		interfaceClass = J9_CLASS_FROM_METHOD(method);
 		vTableOffset = 0;
-		iTable = receiverClass->lastITable;
-		if (interfaceClass == iTable->interfaceClass) {
-			goto foundITable;
-		}
-		iTable = (J9ITable *)receiverClass->iTable;
-		while (NULL != iTable) {
-			if (interfaceClass == iTable->interfaceClass) {
-				receiverClass->lastITable = iTable;
-foundITable:
-				vTableOffset = ((UDATA *)(iTable + 1))[iTableIndex];
-				break;
-			}
-			iTable = iTable->next;
+		iTable = VM_VMHelpers::findITable(receiverClass, interfaceClass);
+		if (NULL != iTable) {
+			vTableOffset = ((UDATA *)(iTable + 1))[iTableIndex];
 		}
 
 		/* The bytecode guarantees with an explicit type test that the receiver is an instance
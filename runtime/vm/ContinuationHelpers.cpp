@@ -35,6 +35,48 @@
 
 extern "C" {
 
+/**
+ * Return the size to allocate for a new continuation stack: the initial thread stack
+ * size, or the stack depth recently finished continuations used if that is larger.
+ * The hint is kept below -Xss, so the result never exceeds the maximum stack size.
+ *
+ * @param[in] vm the J9JavaVM
+ * @return the stack size in bytes
+ */
+static UDATA
+newContinuationStackSize(J9JavaVM *vm)
+{
+#ifdef J9VM_INTERP_GROWABLE_STACKS
+	UDATA initialStackSize = (vm->initialStackSize > (UDATA) vm->stackSize) ? vm->stackSize : vm->initialStackSize;
+#else
+	UDATA initialStackSize = vm->stackSize;
+#endif
+
+	return OMR_MAX(initialStackSize, vm->continuationStackSizeHint);
+}
+
+/**
+ * Fold the stack depth used by a continuation which is being freed into the decaying
+ * average used to size new continuation stacks. The update races with other carriers,
+ * which is harmless as the value is only used as a hint.
+ *
+ * @param[in] vm the J9JavaVM
+ * @param[in] usedDepth the number of bytes of stack the continuation was seen to use
+ */
+static void
+updateContinuationStackSizeHint(J9JavaVM *vm, UDATA usedDepth)
+{
+	UDATA stackSizeHint = vm->continuationStackSizeHint;
+
+	/* A few deep continuations must not make every new stack large */
+	usedDepth = OMR_MIN(usedDepth, vm->stackSize / J9_CONTINUATION_STACK_SIZE_HINT_MAX_FRACTION);
+	if (0 == stackSizeHint) {
+		vm->continuationStackSizeHint = usedDepth;
+	} else {
+		vm->continuationStackSizeHint = stackSizeHint - (stackSizeHint / 8) + (usedDepth / 8);
+	}
+}
+
 BOOLEAN
 createContinuation(J9VMThread *currentThread, j9object_t continuationObject)
 {
@@ -95,21 +137,16 @@ createContinuation(J9VMThread *currentThread, j9object_t continuationObject)
 			goto end;
 		}
 
-#ifdef J9VM_INTERP_GROWABLE_STACKS
-#define VMTHR_INITIAL_STACK_SIZE ((vm->initialStackSize > (UDATA) vm->stackSize) ? vm->stackSize : vm->initialStackSize)
-#else
-#define VMTHR_INITIAL_STACK_SIZE vm->stackSize
-#endif
-
-		if ((stack = allocateJavaStack(vm, VMTHR_INITIAL_STACK_SIZE, NULL)) == NULL) {
+		/* Start new stacks at the depth recently finished continuations used, so that
+		 * deep virtual threads do not repeatedly grow (and copy) their stacks.
+		 */
+		if ((stack = allocateJavaStack(vm, newContinuationStackSize(vm), NULL)) == NULL) {
 			vm->internalVMFunctions->setNativeOutOfMemoryError(currentThread, 0, 0);
 			j9mem_free_memory(continuation);
 			result = FALSE;
 			goto end;
 		}
 
-#undef VMTHR_INITIAL_STACK_SIZE
-
 #if defined(J9VM_PROF_CONTINUATION_ALLOCATION)
 		I_64 totalTime = (I_64)j9time_hires_delta(start, j9time_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
 		if (totalTime > 10000) {
@@ -296,6 +333,12 @@ yieldContinuation(J9VMThread *currentThread, BOOLEAN isFinished)
 	currentThread->currentContinuation = NULL;
 	VM_ContinuationHelpers::swapFieldsWithContinuation(currentThread, continuation, continuationObject);
 
+	/* Remember the deepest point the continuation yielded at, to size new continuation stacks */
+	UDATA stackDepth = (UDATA)continuation->stackObject->end - (UDATA)continuation->sp;
+	if (stackDepth > continuation->maxStackDepth) {
+		continuation->maxStackDepth = stackDepth;
+	}
+
 	/* We need a full fence here to preserve happens-before relationship on PPC and other weakly
 	 * ordered architectures since learning/reservation is turned on by default. Since we have the
 	 * global pin lock counters we only need to need to address yield points, as thats the
@@ -343,6 +386,12 @@ freeContinuation(J9VMThread *currentThread, j9object_t continuationObject, BOOLE
 
 		/* Free old stack used by continuation. */
 		J9JavaStack *currentStack = continuation->stackObject->previous;
+		UDATA usedDepth = continuation->maxStackDepth;
+		if ((NULL != currentStack) && (currentStack->size > usedDepth)) {
+			/* The continuation outgrew its previous stack, so it used at least that much */
+			usedDepth = currentStack->size;
+		}
+		updateContinuationStackSizeHint(currentThread->javaVM, usedDepth);
 		while (NULL != currentStack) {
 			J9JavaStack *previous = currentStack->previous;
 
@@ -364,6 +413,11 @@ recycleContinuation(J9JavaVM *vm, J9VMThread *vmThread, J9VMContinuation* contin
 	PORT_ACCESS_FROM_JAVAVM(vm);
 	bool cached = false;
 
+	if (continuation->stackObject->size > (2 * newContinuationStackSize(vm))) {
+		/* Do not let an unusually deep continuation pin a large stack in the caches. */
+		goto done;
+	}
+
 	if (!skipLocalCache && (0 < vm->continuationT1Size)) {
 		/* If called by carrier thread (not global), try to store in local cache first.
 		 * Allocate cacheArray if it doesn't exist.
@@ -399,12 +453,12 @@ T2:
 				break;
 			}
 		}
-
-		if (!cached) {
-			/* Caching failed, free the J9VMContinuation struct. */
-			freeJavaStack(vm, continuation->stackObject);
-			j9mem_free_memory(continuation);
-		}
+	}
+done:
+	if (!cached) {
+		/* Caching failed, free the J9VMContinuation struct. */
+		freeJavaStack(vm, continuation->stackObject);
+		j9mem_free_memory(continuation);
 	}
 }
 
@@ -27,8 +27,8 @@
 #include "j9jclnls.h"
 #include "objhelp.h"
 #include "VMHelpers.hpp"
+#include "ArrayCopyHelpers.hpp"
 #include "ObjectAllocationAPI.hpp"
-#include "ObjectAccessBarrierAPI.hpp"
 
 extern "C" {
 
@@ -40,7 +40,6 @@ Fast_java_lang_Throwable_fillInStackTrace(J9VMThread *currentThread, j9object_t
 	/* Don't fill in stack traces if -XX:-StackTraceInThrowable is in effect */
 	if (0 == (vm->runtimeFlags & J9_RUNTIME_OMIT_STACK_TRACES)) {
 		MM_ObjectAllocationAPI objectAllocate(currentThread);
-		MM_ObjectAccessBarrierAPI objectAccessBarrier(currentThread);
 		/* If the disableWritableStackTrace field is set to false,
 		 * continue filling in the stack trace.
 		 */
@@ -103,13 +102,15 @@ Fast_java_lang_Throwable_fillInStackTrace(J9VMThread *currentThread, j9object_t
 					framesWalked = maxSize;
 				}
 			}
-			for (UDATA i = 0; i < framesWalked; ++i) {
+			/* The walkback is a primitive array of raw PCs which are only decoded into
+			 * StackTraceElements if the trace is requested, so no barriers are required
+			 * and the cached PCs can be copied in bulk.
+			 */
 #if defined(J9VM_ENV_DATA64)
-				objectAccessBarrier.inlineIndexableObjectStoreI64(currentThread, walkback, i, cachePointer[i]);
+			VM_ArrayCopyHelpers::memcpyToArray(currentThread, walkback, (UDATA)3, 0, framesWalked, (void *)cachePointer);
 #else
-				objectAccessBarrier.inlineIndexableObjectStoreI32(currentThread, walkback, i, cachePointer[i]);
+			VM_ArrayCopyHelpers::memcpyToArray(currentThread, walkback, (UDATA)2, 0, framesWalked, (void *)cachePointer);
 #endif
-			}
 			freeStackWalkCaches(currentThread, walkState);
 recursiveOOM:
 			J9VMJAVALANGTHROWABLE_SET_WALKBACK(currentThread, receiver, walkback);
@@ -267,19 +267,9 @@ private:
 	convertITableIndexToVirtualMethod(J9Class *receiverClass, J9Class *interfaceClass, UDATA iTableIndex) const
 	{
 		J9Method *sendMethod = NULL;
-		J9ITable *iTable = receiverClass->lastITable;
-		if (interfaceClass == iTable->interfaceClass) {
-			goto foundITable;
-		}
-		iTable = (J9ITable*)receiverClass->iTable;
-		while (NULL != iTable) {
-			if (interfaceClass == iTable->interfaceClass) {
-				receiverClass->lastITable = iTable;
-foundITable:
-				sendMethod = *(J9Method**)((UDATA)receiverClass + ((UDATA*)(iTable + 1))[iTableIndex]);
-				break;
-			}
-			iTable = iTable->next;
+		J9ITable *iTable = VM_VMHelpers::findITable(receiverClass, interfaceClass);
+		if (NULL != iTable) {
+			sendMethod = *(J9Method**)((UDATA)receiverClass + ((UDATA*)(iTable + 1))[iTableIndex]);
 		}
 		return sendMethod;
 	}
@@ -192,6 +192,13 @@ releasedAccess:
 		/* Update the anti-deflation vote because we had to block */
 		objectMonitor->antiDeflationCount += 1;
 #endif /* J9VM_THR_SMART_DEFLATION */
+		if (0 != vm->thrAdaptiveTryEnterSpinning) {
+			/* Spinning did not avoid blocking, so spin less on the next contended enter */
+			U_32 const tryEnterSpinBackoff = objectMonitor->tryEnterSpinBackoff;
+			if (tryEnterSpinBackoff < J9_OBJECT_MONITOR_MAX_TRY_ENTER_SPIN_BACKOFF) {
+				objectMonitor->tryEnterSpinBackoff = tryEnterSpinBackoff + 1;
+			}
+		}
 		for (;;) {
 			/* if the INFLATED bit is set, then we own the object and can safely block in acquireVMAccess */
 			if (J9_ARE_ANY_BITS_SET(((J9ThreadMonitor*)monitor)->flags, J9THREAD_MONITOR_INFLATED)) {
@@ -681,9 +688,16 @@ spinOnTryEnter(J9VMThread *currentThread, J9ObjectMonitor *objectMonitor, j9obje
 				tryEnterYieldCount);
 	}
 #else /* J9VM_INTERP_CUSTOM_SPIN_OPTIONS */
-	UDATA const tryEnterSpinCount1 = vm->thrMaxTryEnterSpins1BeforeBlocking;
+	UDATA tryEnterSpinCount1 = vm->thrMaxTryEnterSpins1BeforeBlocking;
 #endif /* J9VM_INTERP_CUSTOM_SPIN_OPTIONS */
 
+	/* Shrink the spin budget of monitors on which recent spinning has failed to avoid blocking */
+	U_32 const tryEnterSpinBackoff = (0 != vm->thrAdaptiveTryEnterSpinning) ? objectMonitor->tryEnterSpinBackoff : 0;
+	if (0 != tryEnterSpinBackoff) {
+		tryEnterSpinCount1 >>= tryEnterSpinBackoff;
+		tryEnterSpinCount2 = OMR_MAX(tryEnterSpinCount2 >> tryEnterSpinBackoff, 1);
+	}
+
 #if defined(OMR_THR_JLM)
 	/* Initialize JLM */
 	J9ThreadMonitorTracing *tracing = NULL;
@@ -728,6 +742,10 @@ spinOnTryEnter(J9VMThread *currentThread, J9ObjectMonitor *objectMonitor, j9obje
 				if (J9_LOCK_IS_INFLATED(J9_LOAD_LOCKWORD(currentThread, lwEA))) {
 					/* try_enter succeeded - monitor is inflated */
 					rc = true;
+					if (0 != tryEnterSpinBackoff) {
+						/* Spinning paid off, so restore some of the budget */
+						objectMonitor->tryEnterSpinBackoff = tryEnterSpinBackoff - 1;
+					}
 #if JAVA_SPEC_VERSION >= 19
 					currentThread->ownedMonitorCount += 1;
 #endif /* JAVA_SPEC_VERSION >= 19 */
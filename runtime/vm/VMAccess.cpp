@@ -55,6 +55,7 @@ extern "C" {
 
 static void initializeExclusiveVMAccessStats(J9JavaVM* vm, J9VMThread* currentThread);
 static U_64 updateExclusiveVMAccessStats(J9VMThread* currentThread);
+static void recordTimeToSafePoint(J9JavaVM *vm, UDATA *histogram, U_64 startTime, U_64 endTime);
 
 #if (defined(J9VM_DBG))
 static void badness (char *description);
@@ -113,6 +114,30 @@ updateExclusiveVMAccessStats(J9VMThread* currentThread)
 	return VM_VMAccess::updateExclusiveVMAccessStats(currentThread, vm, PORTLIB);
 }
 
+/**
+ * Count a safe point response in one of the vm's time-to-safe-point histograms.
+ *
+ * @parm[in] vm the J9JavaVM
+ * @parm[in] histogram the exclusive or handshake bucket array
+ * @parm[in] startTime the hires time at which the request was made
+ * @parm[in] endTime the hires time at which the request was satisfied
+ */
+static void
+recordTimeToSafePoint(J9JavaVM *vm, UDATA *histogram, U_64 startTime, U_64 endTime)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	UDATA bucket = 0;
+
+	if (endTime > startTime) {
+		U_64 micros = j9time_hires_delta(startTime, endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+		while ((0 != micros) && (bucket < (J9_TIME_TO_SAFE_POINT_HISTOGRAM_SIZE - 1))) {
+			micros >>= 1;
+			bucket += 1;
+		}
+	}
+	VM_AtomicSupport::add(&histogram[bucket], 1);
+}
+
 
 void  
 acquireExclusiveVMAccess(J9VMThread * vmThread)
@@ -293,6 +318,8 @@ acquireExclusiveVMAccess(J9VMThread * vmThread)
 					responsesExpected++;
 				}
 #endif /* J9VM_INTERP_ATOMIC_FREE_JNI */
+				/* Wake the thread in case it is waiting with VM access in executeThreadHandshake */
+				omrthread_monitor_notify_all(currentThread->publicFlagsMutex);
 				omrthread_monitor_exit(currentThread->publicFlagsMutex);
 			}
 			omrthread_monitor_exit(vm->vmThreadListMutex);
@@ -328,6 +355,7 @@ acquireExclusiveVMAccess(J9VMThread * vmThread)
 		omrthread_monitor_enter(vm->vmThreadListMutex);
 
 		vm->omrVM->exclusiveVMAccessStats.endTime = j9time_hires_clock();
+		recordTimeToSafePoint(vm, vm->timeToSafePointHistogram.exclusive, vm->omrVM->exclusiveVMAccessStats.startTime, vm->omrVM->exclusiveVMAccessStats.endTime);
 	}
 	Assert_VM_true((J9_XACCESS_EXCLUSIVE == vm->exclusiveAccessState) || (J9_XACCESS_EXCLUSIVE == vm->safePointState));
 	Trc_VM_acquireExclusiveVMAccess_Exit(vmThread);
@@ -746,6 +774,7 @@ waitForResponseFromExternalThread(J9JavaVM * vm, UDATA vmResponsesExpected, UDAT
 	omrthread_monitor_enter(vm->vmThreadListMutex);
 
 	vm->omrVM->exclusiveVMAccessStats.endTime = j9time_hires_clock();
+	recordTimeToSafePoint(vm, vm->timeToSafePointHistogram.exclusive, vm->omrVM->exclusiveVMAccessStats.startTime, vm->omrVM->exclusiveVMAccessStats.endTime);
 }
 
 void
@@ -827,6 +856,8 @@ acquireExclusiveVMAccessFromExternalThread(J9JavaVM * vm)
 			vmResponsesExpected++;
 		}
 #endif /* J9VM_INTERP_ATOMIC_FREE_JNI */
+		/* Wake the thread in case it is waiting with VM access in executeThreadHandshake */
+		omrthread_monitor_notify_all(currentThread->publicFlagsMutex);
 		omrthread_monitor_exit(currentThread->publicFlagsMutex);
 	} while ((currentThread = currentThread->linkNext) != vm->mainThread);
 	omrthread_monitor_exit(vm->vmThreadListMutex);
@@ -1006,6 +1037,8 @@ requestExclusiveVMAccessMetronomeTemp(J9JavaVM *vm, UDATA block, UDATA *vmRespon
  			} /* thread has vm access */
 #endif /* J9VM_INTERP_ATOMIC_FREE_JNI */
 
+			/* Wake the thread in case it is waiting with VM access in executeThreadHandshake */
+			omrthread_monitor_notify_all(thread->publicFlagsMutex);
 			omrthread_monitor_exit(thread->publicFlagsMutex);
 		}
 		thread = thread->linkNext;
@@ -1226,6 +1259,8 @@ acquireSafePointVMAccess(J9VMThread * vmThread)
 				VM_VMAccess::setPublicFlags(currentThread, J9_PUBLIC_FLAGS_HALTED_AT_SAFE_POINT, true);				
 				VM_VMAccess::clearPublicFlags(currentThread, J9_PUBLIC_FLAGS_REQUEST_SAFE_POINT, true);
 			}
+			/* Wake the thread in case it is waiting with VM access in executeThreadHandshake */
+			omrthread_monitor_notify_all(currentThread->publicFlagsMutex);
 			omrthread_monitor_exit(currentThread->publicFlagsMutex);
 		} while ((currentThread = currentThread->linkNext) != vmThread);
 		omrthread_monitor_exit(vm->vmThreadListMutex);
@@ -1311,8 +1346,9 @@ _tryAgain:
 		/* increment the inspection count but don't try to short circuit -- the thread might not actually be halted yet */
 		vmThread->inspectionSuspendCount += 1;
 
-		/* Now halt the thread for inspection */
+		/* Now halt the thread for inspection, waking it in case it is waiting with VM access in executeThreadHandshake */
 		setHaltFlag(vmThread, J9_PUBLIC_FLAGS_HALT_THREAD_INSPECTION);
+		omrthread_monitor_notify_all(vmThread->publicFlagsMutex);
 
 		/* If the thread doesn't have VM access and it not queued for exclusive we can proceed immediately */
 		if (vmThread->publicFlags & (J9_PUBLIC_FLAGS_VM_ACCESS | J9_PUBLIC_FLAGS_QUEUED_FOR_EXCLUSIVE)) {
@@ -1385,4 +1421,167 @@ resumeThreadForInspection(J9VMThread * currentThread, J9VMThread * vmThread)
 	}
 }
 
+/*
+ * Run function on behalf of targetThread once targetThread is at a safe point, without
+ * halting any other thread.
+ *
+ * If targetThread is running Java code, the request is queued on it and it runs the function
+ * itself from its next async event check, so it does not stop for longer than the function
+ * takes. If targetThread is not running Java code (or stops doing so before it gets to the
+ * request), it is halted for inspection and the function is run by the current thread.
+ * The function receives the thread running it as currentThread in either case, must not
+ * release VM access and must not assume which thread it is running on.
+ *
+ * The current thread keeps VM access while targetThread runs the function, so the function
+ * may read objects held by the current thread (e.g. in its special frame or J9VMThread).
+ * While waiting, the current thread runs any handshakes queued on itself, and takes the
+ * request back if it is asked to halt or to reach a safe point, so that it never holds up another requester or
+ * an exclusive VM access request.
+ *
+ * The current thread must have VM access when calling this function, and the caller must ensure
+ * that targetThread cannot exit. VM access may be released and reacquired by this call when
+ * the function runs with targetThread halted - direct object pointers must not be held across
+ * this call.
+ */
+void
+executeThreadHandshake(J9VMThread *currentThread, J9VMThread *targetThread, J9ThreadHandshakeFunction function, void *userData)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	bool runWhileHalted = true;
+	J9ThreadHandshake handshake;
+
+	Assert_VM_mustHaveVMAccess(currentThread);
+
+	if (currentThread == targetThread) {
+		function(currentThread, targetThread, userData);
+		return;
+	}
+
+	handshake.function = function;
+	handshake.userData = userData;
+	handshake.requestTime = j9time_hires_clock();
+	handshake.state = J9_THREAD_HANDSHAKE_QUEUED;
+	handshake.requester = currentThread;
+	handshake.next = NULL;
+
+	if (vm->threadHandshakeHandlerKey >= 0) {
+		omrthread_monitor_t const targetMutex = targetThread->publicFlagsMutex;
+		omrthread_monitor_t const requesterMutex = currentThread->publicFlagsMutex;
+		omrthread_monitor_enter(targetMutex);
+		if (J9_ARE_ANY_BITS_SET(targetThread->publicFlags, J9_PUBLIC_FLAGS_VM_ACCESS)) {
+			J9ThreadHandshake **tail = &targetThread->handshakeQueue;
+			while (NULL != *tail) {
+				tail = &(*tail)->next;
+			}
+			*tail = &handshake;
+			runWhileHalted = false;
+			/* The target may itself be waiting below for a handshake of its own */
+			omrthread_monitor_notify_all(targetMutex);
+			omrthread_monitor_exit(targetMutex);
+
+			J9SignalAsyncEvent(vm, targetThread, vm->threadHandshakeHandlerKey);
+
+			/* Wait on the publicFlagsMutex of the current thread, which is notified when the handshake
+			 * completes and when a halt or another handshake is posted to the current thread. The target
+			 * may stop running Java code without taking an async check, in which case nothing notifies,
+			 * so poll using the sequence 1, 4, 16, 64 and then 64 thereafter.
+			 */
+			IDATA waitTime = 1;
+			omrthread_monitor_enter(requesterMutex);
+			while (J9_THREAD_HANDSHAKE_COMPLETE != handshake.state) {
+				if ((J9_THREAD_HANDSHAKE_QUEUED == handshake.state)
+					&& (J9_ARE_NO_BITS_SET(targetThread->publicFlags, J9_PUBLIC_FLAGS_VM_ACCESS)
+						|| J9_ARE_ANY_BITS_SET(currentThread->publicFlags, J9_PUBLIC_FLAGS_HALT_THREAD_ANY | J9_PUBLIC_FLAGS_REQUEST_SAFE_POINT))
+				) {
+					/* Reclaim the request and run it while the target is halted. The target takes the
+					 * request off its queue before marking it running, so it can only be reclaimed while
+					 * it is still queued.
+					 */
+					omrthread_monitor_exit(requesterMutex);
+					omrthread_monitor_enter(targetMutex);
+					J9ThreadHandshake **cursor = &targetThread->handshakeQueue;
+					while ((NULL != *cursor) && (&handshake != *cursor)) {
+						cursor = &(*cursor)->next;
+					}
+					if (NULL != *cursor) {
+						*cursor = handshake.next;
+						runWhileHalted = true;
+					}
+					omrthread_monitor_exit(targetMutex);
+					omrthread_monitor_enter(requesterMutex);
+					if (runWhileHalted) {
+						break;
+					}
+				}
+				if (NULL != currentThread->handshakeQueue) {
+					/* Another thread may be waiting on this one, possibly the target itself */
+					omrthread_monitor_exit(requesterMutex);
+					threadHandshakeAsyncHandler(currentThread, vm->threadHandshakeHandlerKey, NULL);
+					omrthread_monitor_enter(requesterMutex);
+					continue;
+				}
+				/* A running handshake completes without releasing VM access, so waiting for it
+				 * with VM access cannot hold up an exclusive request for long.
+				 */
+				omrthread_monitor_wait_timed(requesterMutex, waitTime, 0);
+				if (waitTime < 64) {
+					waitTime *= 4;
+				}
+			}
+			omrthread_monitor_exit(requesterMutex);
+		} else {
+			omrthread_monitor_exit(targetMutex);
+		}
+	}
+
+	if (runWhileHalted) {
+		haltThreadForInspection(currentThread, targetThread);
+		recordTimeToSafePoint(vm, vm->timeToSafePointHistogram.handshake, handshake.requestTime, j9time_hires_clock());
+		function(currentThread, targetThread, userData);
+		resumeThreadForInspection(currentThread, targetThread);
+	}
+
+	Assert_VM_mustHaveVMAccess(currentThread);
+}
+
+/*
+ * Called from the async message handler. Run the handshakes queued on the current thread
+ * in the order they were requested, and notify each requester as its handshake completes.
+ *
+ * The current thread has VM access.
+ */
+void
+threadHandshakeAsyncHandler(J9VMThread *currentThread, IDATA handlerKey, void *userData)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	omrthread_monitor_t const publicFlagsMutex = currentThread->publicFlagsMutex;
+	J9ThreadHandshake *handshake = NULL;
+
+	omrthread_monitor_enter(publicFlagsMutex);
+	while (NULL != (handshake = currentThread->handshakeQueue)) {
+		currentThread->handshakeQueue = handshake->next;
+		omrthread_monitor_exit(publicFlagsMutex);
+
+		/* Once off the queue the request can no longer be reclaimed, so the requester waits for it */
+		omrthread_monitor_t const requesterMutex = handshake->requester->publicFlagsMutex;
+		omrthread_monitor_enter(requesterMutex);
+		handshake->state = J9_THREAD_HANDSHAKE_RUNNING;
+		omrthread_monitor_exit(requesterMutex);
+
+		recordTimeToSafePoint(vm, vm->timeToSafePointHistogram.handshake, handshake->requestTime, j9time_hires_clock());
+		handshake->function(currentThread, currentThread, handshake->userData);
+
+		omrthread_monitor_enter(requesterMutex);
+		/* The requester owns the handshake and may return as soon as it sees it complete */
+		handshake->state = J9_THREAD_HANDSHAKE_COMPLETE;
+		omrthread_monitor_notify_all(requesterMutex);
+		omrthread_monitor_exit(requesterMutex);
+
+		omrthread_monitor_enter(publicFlagsMutex);
+	}
+	omrthread_monitor_exit(publicFlagsMutex);
+}
+
 } /* extern "C" */
@@ -232,19 +232,9 @@ mapVirtualMethod(J9VMThread *currentThread, J9Method *method, UDATA vTableOffset
 		UDATA iTableIndex = vTableOffset & ~(UDATA)J9_JNI_MID_INTERFACE;
 		J9Class *interfaceClass = J9_CLASS_FROM_METHOD(method);
 		vTableOffset = 0;
-		J9ITable * iTable = receiverClass->lastITable;
-		if (interfaceClass == iTable->interfaceClass) {
-			goto foundITable;
-		}
-		iTable = (J9ITable*)receiverClass->iTable;
-		while (NULL != iTable) {
-			if (interfaceClass == iTable->interfaceClass) {
-				receiverClass->lastITable = iTable;
-foundITable:
-				vTableOffset = ((UDATA*)(iTable + 1))[iTableIndex];
-				break;
-			}
-			iTable = iTable->next;
+		J9ITable * iTable = VM_VMHelpers::findITable(receiverClass, interfaceClass);
+		if (NULL != iTable) {
+			vTableOffset = ((UDATA*)(iTable + 1))[iTableIndex];
 		}
 	}
 	if (0 != vTableOffset) {
@@ -488,6 +478,7 @@ cleanUpAttachedThread(J9VMThread *currentThread)
 		}
 		restoreCallInFrame(currentThread);
 	}
+	j9jni_flushGlobalRefCaches(currentThread);
 	Trc_VM_cleanUpAttachedThread_Exit(currentThread);
 }
 
@@ -149,6 +149,7 @@ static J9Class* markInterfaces(J9ROMClass *romClass, J9Class *superclass, J9Clas
 static void unmarkInterfaces(J9Class *interfaceHead);
 static void createITable(J9VMThread* vmStruct, J9Class *ramClass, J9Class *interfaceClass, J9ITable ***previousLink, UDATA **currentSlot, UDATA depth);
 static UDATA* initializeRAMClassITable(J9VMThread* vmStruct, J9Class *ramClass, J9Class *superclass, UDATA* currentSlot, J9Class *interfaceHead, IDATA maxInterfaceDepth);
+static void initializeRAMClassITableHash(J9VMThread* vmStruct, J9Class *ramClass, UDATA *currentSlot, UDATA iTableHashSlotCount);
 static UDATA addInterfaceMethods(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *interfaceClass, UDATA vTableMethodCount, UDATA *vTableAddress, J9Class *superclass, J9ROMClass *romClass, UDATA *defaultConflictCount, J9Pool *equivalentSets, UDATA *equivSetCount, J9OverrideErrorData *errorData);
 static UDATA* computeVTable(J9VMThread *vmStruct, J9ClassLoader *classLoader, J9Class *superclass, J9ROMClass *taggedClass, UDATA packageID, J9ROMMethod ** methodRemapArray, J9Class *interfaceHead, UDATA *defaultConflictCount, UDATA interfaceCount, UDATA inheritedInterfaceCount, J9OverrideErrorData *errorData);
 static void copyVTable(J9VMThread *vmStruct, J9Class *ramClass, J9Class *superclass, UDATA *vTable, UDATA defaultConflictCount);
@@ -433,6 +434,42 @@ initializeRAMClassITable (J9VMThread* vmStruct, J9Class *ramClass, J9Class *supe
 	return currentSlot;
 }
 
+/**
+ * Build the iTable hash for ramClass in the iTableHashSlotCount slots following the iTables.
+ * Array classes share the hash of [Z along with its iTable list.
+ *
+ * @param[in] vmStruct the current J9VMThread
+ * @param[in] ramClass the class being created, whose iTable list is complete
+ * @param[in] currentSlot the first slot following the iTables
+ * @param[in] iTableHashSlotCount the number of slots reserved for the hash, 0 if no hash is required
+ */
+static void
+initializeRAMClassITableHash(J9VMThread* vmStruct, J9Class *ramClass, UDATA *currentSlot, UDATA iTableHashSlotCount)
+{
+	J9Class *booleanArrayClass = vmStruct->javaVM->booleanArrayClass;
+
+	if (J9ROMCLASS_IS_ARRAY(ramClass->romClass) && (booleanArrayClass != NULL)) {
+		ramClass->iTableHash = booleanArrayClass->iTableHash;
+	} else if (0 != iTableHashSlotCount) {
+		/* The first slot holds the mask, the remainder (a power of two) are the hash slots, zeroed by the allocator */
+		J9ITableHash *iTableHash = (J9ITableHash *)currentSlot;
+		J9ITable **slots = J9ITABLEHASH_SLOTS(iTableHash);
+		UDATA mask = iTableHashSlotCount - 2;
+		J9ITable *iTable = (J9ITable *)ramClass->iTable;
+
+		iTableHash->mask = mask;
+		while (NULL != iTable) {
+			UDATA index = J9ITABLEHASH_INDEX(iTable->interfaceClass, mask);
+			while (NULL != slots[index]) {
+				index = (index + 1) & mask;
+			}
+			slots[index] = iTable;
+			iTable = iTable->next;
+		}
+		ramClass->iTableHash = iTableHash;
+	}
+}
+
 /* Helper function to compare two name and sigs.
  * It compares the lengths of both name and sig first before doing any memcmp.
  *
@@ -2598,6 +2635,7 @@ internalCreateRAMClassFromROMClassImpl(J9VMThread *vmThread, J9ClassLoader *clas
 	UDATA *instanceDescription = NULL;
 	UDATA instanceDescriptionSlotCount = 0;
 	UDATA iTableSlotCount = 0;
+	UDATA iTableHashSlotCount = 0;
 	IDATA maxInterfaceDepth = -1;
 	UDATA inheritedInterfaceCount = 0;
 	UDATA defaultConflictCount = 0;
@@ -2847,6 +2885,24 @@ fail:
 					interfaceWalk = (J9Class *)((UDATA)interfaceWalk->instanceDescription & ~INTERFACE_TAG);
 				}
 			}
+			/* Classes with long iTable lists (including those inherited from the superclass) also get
+			 * an iTable hash so that interface dispatch does not walk the list on a lastITable miss.
+			 * The hash is a mask slot followed by a power of two number of slots, at most half full.
+			 */
+			{
+				UDATA iTableCount = interfaceCount + inheritedInterfaceCount;
+				if ((romClass->modifiers & J9AccInterface) == J9AccInterface) {
+					iTableCount += 1;
+				}
+				if (iTableCount > J9_ITABLE_HASH_THRESHOLD) {
+					UDATA hashSize = 2 * J9_ITABLE_HASH_THRESHOLD;
+					while (hashSize < (2 * iTableCount)) {
+						hashSize *= 2;
+					}
+					iTableHashSlotCount = 1 + hashSize;
+					iTableSlotCount += iTableHashSlotCount;
+				}
+			}
 			classSize += iTableSlotCount;
 		}
 
@@ -3338,7 +3394,8 @@ fail:
 
 			if (!fastHCR) {
 				/* Fill in the itable. This will unmark the linked interfaces. */
-				initializeRAMClassITable(vmThread, ramClass, superclass, iTable, interfaceHead, maxInterfaceDepth);
+				UDATA *iTableEnd = initializeRAMClassITable(vmThread, ramClass, superclass, iTable, interfaceHead, maxInterfaceDepth);
+				initializeRAMClassITableHash(vmThread, ramClass, iTableEnd, iTableHashSlotCount);
 			}
 			/* Ensure that lastITable is never NULL */
 			ramClass->lastITable = (J9ITable *) ramClass->iTable;
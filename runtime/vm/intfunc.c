@@ -204,6 +204,7 @@ J9InternalVMFunctions J9InternalFunctions = {
 	getJITHookInterface,
 	haltThreadForInspection,
 	resumeThreadForInspection,
+	executeThreadHandshake,
 	threadCleanup,
 	walkStackForExceptionThrow,
 	postInitLoadJ9DLL,
@@ -255,6 +256,7 @@ J9InternalVMFunctions J9InternalFunctions = {
 	initializeMethodID,
 	objectMonitorDestroy,
 	objectMonitorDestroyComplete,
+	objectMonitorDeflateIdle,
 	buildNativeFunctionNames,
 	resolveInstanceFieldRefInto,
 	resolveInterfaceMethodRefInto,
@@ -1677,10 +1677,68 @@ J9VM_initializeJNI31Table(JNIEnv *env)
 }
 #endif /* defined(J9VM_ZOS_3164_INTEROPERABILITY) */
 
+/*
+ * Refill the cache of free global ref slots of vmThread with a batch of new elements from the shared pool.
+ */
+static void
+refillGlobalRefCache(J9VMThread *vmThread)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	J9JNIGlobalRefCache *cache = &vmThread->jniGlobalRefCache;
+
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+
+	while (cache->count < (J9_JNI_GLOBAL_REF_CACHE_SIZE / 2)) {
+		j9object_t *slot = (j9object_t *)pool_newElement(vm->jniGlobalReferences);
+		if (NULL == slot) {
+			break;
+		}
+		/* Clear the slot under mutex as a concurrent collector may read from it as soon as we release the mutex */
+		*slot = NULL;
+		cache->slots[cache->count] = slot;
+		cache->count += 1;
+	}
+
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_exit(vm->jniFrameMutex);
+#endif
+}
+
+/*
+ * Return the cached global ref slots of vmThread to the shared pool.
+ * Called when the thread is exiting. Caller must have VM access.
+ */
+void JNICALL
+j9jni_flushGlobalRefCaches(J9VMThread *vmThread)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	J9JNIGlobalRefCache *cache = &vmThread->jniGlobalRefCache;
+
+	Assert_VM_mustHaveVMAccess(vmThread);
+
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+
+	for (UDATA i = 0; i < cache->count; i++) {
+		pool_removeElement(vm->jniGlobalReferences, cache->slots[i]);
+	}
+	cache->count = 0;
+
+#ifdef J9VM_THR_PREEMPTIVE
+	omrthread_monitor_exit(vm->jniFrameMutex);
+#endif
+}
+
 /*
  * 1) Private routine.  Used to delete a jni global reference from an actual object pointer.
  * 2) We don't acquire VM access - caller must already have it.
  * 3) globalRef may be NULL
+ * 4) A deleted strong ref is kept in this thread's cache of free slots while it has room.
+ * 5) Deletes take jniFrameMutex: the ref must be found in the pool before its slot is written, and
+ *    pool_includesElement walks the puddles which other threads add to under the mutex.
  */
 void JNICALL
 j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
@@ -1691,22 +1749,38 @@ j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
 	Assert_VM_mustHaveVMAccess(vmThread);
 
 	if (globalRef != NULL) {
+		J9Pool *pool = isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences;
+		j9object_t *slot = (j9object_t *)globalRef;
 
 #ifdef J9VM_THR_PREEMPTIVE
 		omrthread_monitor_enter(vm->jniFrameMutex);
 #endif
 
+		if (pool_includesElement(pool, globalRef) == TRUE) {
+			if (isWeak) {
+#if defined(J9VM_GC_REALTIME)
+				vm->memoryManagerFunctions->j9gc_objaccess_jniDeleteGlobalReference(vmThread, *slot);
+#endif /* defined(J9VM_GC_REALTIME) */
+				pool_removeElement(pool, globalRef);
+			} else if (NULL != *slot) {
+				/* Live strong global refs never hold NULL, a NULL slot is free (deleted, or cached by a thread) */
+				J9JNIGlobalRefCache *cache = &vmThread->jniGlobalRefCache;
 #if defined(J9VM_GC_REALTIME)
-		vm->memoryManagerFunctions->j9gc_objaccess_jniDeleteGlobalReference(vmThread, *((j9object_t*)globalRef));
+				vm->memoryManagerFunctions->j9gc_objaccess_jniDeleteGlobalReference(vmThread, *slot);
 #endif /* defined(J9VM_GC_REALTIME) */
-		if (pool_includesElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences, globalRef) == TRUE) {
-			pool_removeElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences, globalRef);
+				*slot = NULL;
+				if (cache->count < J9_JNI_GLOBAL_REF_CACHE_SIZE) {
+					cache->slots[cache->count] = slot;
+					cache->count += 1;
+				} else {
+					pool_removeElement(pool, globalRef);
+				}
+			}
 		}
 
 #ifdef J9VM_THR_PREEMPTIVE
 		omrthread_monitor_exit(vm->jniFrameMutex);
 #endif
-
 	}
 }
 
@@ -1716,30 +1790,45 @@ j9jni_deleteGlobalRef(JNIEnv *env, jobject globalRef, jboolean isWeak)
  * 2) We don't acquire VM access - if you have an object pointer in your hands, you had better already have it.
  * 3) Does not accept NULL for object (NULL check must be done by caller)
  * 4) Returns NULL if ref creation failed.
+ * 5) Strong refs are taken from a per-thread cache of free slots, which is refilled from the shared pool in batches.
+ *    Weak refs are not cached, as a free slot could not be told from a weak ref cleared by the GC, and take jniFrameMutex.
  */
 jobject JNICALL
 j9jni_createGlobalRef(JNIEnv *env, j9object_t object, jboolean isWeak)
 {
 	J9VMThread * vmThread = (J9VMThread *) env;
 	J9JavaVM * vm = vmThread->javaVM;
-	j9object_t * result;
+	j9object_t * result = NULL;
 
 	Assert_VM_mustHaveVMAccess(vmThread);
 	Assert_VM_notNull(object);
 
+	if (isWeak) {
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_enter(vm->jniFrameMutex);
+		omrthread_monitor_enter(vm->jniFrameMutex);
 #endif
 
-	result = (j9object_t*)pool_newElement(isWeak ? vm->jniWeakGlobalReferences : vm->jniGlobalReferences);
-	if (result != NULL) {
-		/* Initialize the ref under mutex as a concurrent collector may read from the slot as soon as we release the mutex */
-		*result = object;
-	}
+		result = (j9object_t*)pool_newElement(vm->jniWeakGlobalReferences);
+		if (result != NULL) {
+			/* Initialize the ref under mutex as a concurrent collector may read from the slot as soon as we release the mutex */
+			*result = object;
+		}
 
 #ifdef J9VM_THR_PREEMPTIVE
-	omrthread_monitor_exit(vm->jniFrameMutex);
+		omrthread_monitor_exit(vm->jniFrameMutex);
 #endif
+	} else {
+		J9JNIGlobalRefCache *cache = &vmThread->jniGlobalRefCache;
+
+		if (0 == cache->count) {
+			refillGlobalRefCache(vmThread);
+		}
+		if (0 != cache->count) {
+			cache->count -= 1;
+			result = cache->slots[cache->count];
+			*result = object;
+		}
+	}
 
 	if (result == NULL) {
 		fatalError(env, "Could not allocate JNI global ref");
@@ -2410,7 +2499,9 @@ getObjectRefType(JNIEnv *env, jobject obj)
 
 	/* Check for global ref */
 
-	if (pool_includesElement(vm->jniGlobalReferences, obj)) {
+	/* Free slots cached by the threads are in the pool too, but hold NULL */
+
+	if (pool_includesElement(vm->jniGlobalReferences, obj) && (NULL != *(j9object_t *)obj)) {
 #ifdef J9VM_THR_PREEMPTIVE
 		omrthread_monitor_exit(vm->jniFrameMutex);
 #endif
@@ -748,6 +748,8 @@ freeJavaVM(J9JavaVM * vm)
 		while (NULL != clazz) {
 			j9mem_free_memory(clazz->jniIDs);
 			clazz->jniIDs = NULL;
+			j9mem_free_memory(clazz->methodLookupIndex);
+			clazz->methodLookupIndex = NULL;
 			clazz = allClassesNextDo(&classWalkState);
 		}
 		allClassesEndDo(&classWalkState);
@@ -1108,6 +1110,7 @@ initializeJavaVM(void * osMainThread, J9JavaVM ** vmPtr, J9CreateJavaVMParams *c
 #if defined(J9VM_THR_ASYNC_NAME_UPDATE)
 	vm->threadNameHandlerKey = -1;
 #endif /* J9VM_THR_ASYNC_NAME_UPDATE */
+	vm->threadHandshakeHandlerKey = -1;
 
 #if defined(J9VM_JIT_RUNTIME_INSTRUMENTATION)
 	/* Protection in case updateJITRuntimeInstrumentationFlags is called before initializeJITRuntimeInstrumentation */
@@ -3758,6 +3761,13 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 		} else if (fastClassHashTable < noFastClassHashTable) {
 			vm->extendedRuntimeFlags |= J9_EXTENDED_RUNTIME_DISABLE_FAST_CLASS_HASH_TABLE;
 		}
+		/* Enable lock-free class table lookups before any class loader exists, so that every
+		 * class hash table is created J9HASH_TABLE_DO_NOT_GROW and is only ever replaced (never
+		 * rehashed in place) by growClassHashTable. This covers startup class loading as well.
+		 */
+		if (J9_ARE_NO_BITS_SET(vm->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_DISABLE_FAST_CLASS_HASH_TABLE)) {
+			vm->extendedRuntimeFlags |= J9_EXTENDED_RUNTIME_FAST_CLASS_HASH_TABLE;
+		}
 	}
 
 #if (JAVA_SPEC_VERSION <= 19) && !defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
@@ -4615,6 +4625,12 @@ threadInitStages(J9JavaVM* vm, IDATA stage, void* reserved)
 				goto _error;
 			}
 #endif /* J9VM_THR_ASYNC_NAME_UPDATE */
+			vm->threadHandshakeHandlerKey = J9RegisterAsyncEvent(vm, threadHandshakeAsyncHandler, NULL);
+			if (vm->threadHandshakeHandlerKey < 0) {
+				loadInfo = FIND_DLL_TABLE_ENTRY( FUNCTION_THREAD_INIT );
+				setErrorJ9dll(PORTLIB, loadInfo, "cannot initialize threadHandshakeHandlerKey", FALSE);
+				goto _error;
+			}
 			break;
 		case JCL_INITIALIZED :
 			break;
@@ -8035,6 +8051,9 @@ freeClassNativeMemory(J9HookInterface** hook, UDATA eventNum, void* eventData, v
 	j9mem_free_memory(clazz->jniIDs);
 	clazz->jniIDs = NULL;
 
+	j9mem_free_memory(clazz->methodLookupIndex);
+	clazz->methodLookupIndex = NULL;
+
 	/* If the class is an interface, free the HCR method ordering table */
 	if (J9ROMCLASS_IS_INTERFACE(clazz->romClass)) {
 		j9mem_free_memory(J9INTERFACECLASS_METHODORDERING(clazz));
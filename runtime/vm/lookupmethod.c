@@ -53,6 +53,8 @@ static char *
 defaultMethodConflictExceptionMessage(J9VMThread *currentThread, J9Class *targetClass, UDATA nameLength, U_8 *name, UDATA sigLength, U_8 *sig, J9Method **methods, UDATA methodsLength);
 static J9Method *
 searchClassForMethodCommon(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, UDATA sigLength, BOOLEAN partialMatch);
+static VMINLINE U_32 hashMethodNameAndSignature(U_8 *name, UDATA nameLength, U_8 *sig, UDATA sigLength);
+static void buildMethodLookupIndex(J9VMThread *currentThread, J9Class *clazz);
 static J9Method* javaResolveInterfaceMethods(J9VMThread *currentThread, J9Class *targetClass, J9ROMNameAndSignature *nameAndSig, J9Class *senderClass, UDATA lookupOptions, J9InterfaceResolveData *data);
 
 /**
@@ -95,7 +97,26 @@ searchClassForMethodCommon(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 *
 
 	if (romMethodCount != 0) {
 		J9Method * methods = clazz->ramMethods;
-		if (J9_ARE_ALL_BITS_SET(romClass->extraModifiers, J9AccClassUseBisectionSearch)) {
+		J9MethodLookupIndex *lookupIndex = clazz->methodLookupIndex;
+		if (!partialMatch && (NULL != lookupIndex) && (romClass == lookupIndex->romClass)) {
+			U_16 *slots = J9METHODLOOKUPINDEX_SLOTS(lookupIndex);
+			U_32 mask = lookupIndex->mask;
+			U_32 index = hashMethodNameAndSignature(name, nameLength, sig, sigLength) & mask;
+
+			/* The index is never full, so an empty slot terminates the probe */
+			while (0 != slots[index]) {
+				J9Method * method = &(methods[slots[index] - 1]);
+				J9ROMMethod * romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
+				J9UTF8 * nameUTF = J9ROMMETHOD_NAME(romMethod);
+				J9UTF8 * sigUTF = J9ROMMETHOD_SIGNATURE(romMethod);
+
+				if (0 == compareMethodNameAndSignature(name, (U_16) nameLength, sig, (U_16) sigLength, J9UTF8_DATA(nameUTF), J9UTF8_LENGTH(nameUTF), J9UTF8_DATA(sigUTF), J9UTF8_LENGTH(sigUTF))) {
+					searchResult = method;
+					break;
+				}
+				index = (index + 1) & mask;
+			}
+		} else if (J9_ARE_ALL_BITS_SET(romClass->extraModifiers, J9AccClassUseBisectionSearch)) {
 			IDATA startIndex = 0;
 			IDATA endIndex = (romMethodCount - 1);
 			IDATA midIndex = endIndex/2;
@@ -150,6 +171,82 @@ searchClassForMethodCommon(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 *
 	return searchResult;
 }
 
+/**
+ * Hash a method name and signature for the method lookup index.
+ *
+ * @param name[in] the name of the method
+ * @param nameLength[in] the length of the method name
+ * @param sig[in] the signature of the method
+ * @param sigLength[in] the length of the method signature
+ *
+ * @returns the hash value
+ */
+static VMINLINE U_32
+hashMethodNameAndSignature(U_8 *name, UDATA nameLength, U_8 *sig, UDATA sigLength)
+{
+	U_32 hash = (U_32)nameLength;
+	UDATA i = 0;
+
+	for (i = 0; i < nameLength; i++) {
+		hash = (hash * 31) + name[i];
+	}
+	for (i = 0; i < sigLength; i++) {
+		hash = (hash * 31) + sig[i];
+	}
+	/* Mix the high bits down as the index is masked to a small power of two */
+	return hash ^ (hash >> 16);
+}
+
+/**
+ * Build the method lookup index for a class with many methods, so that searchClassForMethodCommon
+ * can find methods by name and signature without scanning the whole method list. The index is
+ * published with a compare and swap, so no lock is required and concurrent builders discard their
+ * copy if they lose the race. Failure to allocate the index is not an error, the methods are
+ * simply searched without it.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param clazz[in] the class to index
+ */
+static void
+buildMethodLookupIndex(J9VMThread *currentThread, J9Class *clazz)
+{
+	PORT_ACCESS_FROM_VMC(currentThread);
+	J9ROMClass *romClass = clazz->romClass;
+	U_32 romMethodCount = romClass->romMethodCount;
+	U_32 slotCount = 1;
+	J9MethodLookupIndex *lookupIndex = NULL;
+
+	/* Keep the index at most half full */
+	while (slotCount < (romMethodCount * 2)) {
+		slotCount <<= 1;
+	}
+	lookupIndex = (J9MethodLookupIndex *)j9mem_allocate_memory(sizeof(J9MethodLookupIndex) + (slotCount * sizeof(U_16)), J9MEM_CATEGORY_CLASSES);
+	if (NULL != lookupIndex) {
+		U_16 *slots = J9METHODLOOKUPINDEX_SLOTS(lookupIndex);
+		U_32 mask = slotCount - 1;
+		J9ROMMethod *romMethod = J9ROMCLASS_ROMMETHODS(romClass);
+		U_32 i = 0;
+
+		memset(slots, 0, slotCount * sizeof(U_16));
+		lookupIndex->romClass = romClass;
+		lookupIndex->mask = mask;
+		for (i = 0; i < romMethodCount; i++) {
+			J9UTF8 *nameUTF = J9ROMMETHOD_NAME(romMethod);
+			J9UTF8 *sigUTF = J9ROMMETHOD_SIGNATURE(romMethod);
+			U_32 index = hashMethodNameAndSignature(J9UTF8_DATA(nameUTF), J9UTF8_LENGTH(nameUTF), J9UTF8_DATA(sigUTF), J9UTF8_LENGTH(sigUTF)) & mask;
+
+			while (0 != slots[index]) {
+				index = (index + 1) & mask;
+			}
+			slots[index] = (U_16)(i + 1);
+			romMethod = nextROMMethod(romMethod);
+		}
+		issueWriteBarrier();
+		if (NULL != (J9MethodLookupIndex *)compareAndSwapUDATA((UDATA *)&clazz->methodLookupIndex, (UDATA)NULL, (UDATA)lookupIndex)) {
+			j9mem_free_memory(lookupIndex);
+		}
+	}
+}
 
 static J9Method *
 processMethod(J9VMThread * currentThread, UDATA lookupOptions, J9Method * method, J9Class * methodClass, UDATA * exception, J9Class ** exceptionClass, IDATA *errorType, J9ROMNameAndSignature * nameAndSig, J9Class * senderClass, J9Class * targetClass) {
@@ -696,7 +793,15 @@ retry:
 		/* Search for a matching method in the target class and its superclasses. */
 	
 		while (lookupClass != NULL) {
-			J9Method * foundMethod = searchClassForMethodCommon(lookupClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
+			J9Method * foundMethod = NULL;
+
+			if ((NULL == lookupClass->methodLookupIndex)
+			&& (lookupClass->romClass->romMethodCount >= J9_METHOD_LOOKUP_INDEX_THRESHOLD)
+			&& J9_ARE_NO_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE)
+			) {
+				buildMethodLookupIndex(currentThread, lookupClass);
+			}
+			foundMethod = searchClassForMethodCommon(lookupClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
 
 			if (foundMethod != NULL) {
 				resultMethod = processMethod(currentThread, lookupOptions, foundMethod, lookupClass, &exception, &exceptionClass, &errorType, nameAndSig, senderClass, targetClass);
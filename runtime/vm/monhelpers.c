@@ -30,6 +30,49 @@
 #include "util_internal.h"
 #include "monhelp.h"
 
+/**
+ * Determine whether the deflation policy in effect allows an inflated object monitor,
+ * which no thread owns or is blocked on, to be deflated.
+ *
+ * @param[in] vmStruct the current J9VMThread
+ * @param[in] objectMonitor the inflated object monitor
+ * @return TRUE if the monitor may be deflated, FALSE otherwise
+ */
+static BOOLEAN
+mayDeflateObjectMonitor(J9VMThread *vmStruct, J9ObjectMonitor *objectMonitor)
+{
+	BOOLEAN deflate = FALSE;
+#ifdef OMR_THR_ADAPTIVE_SPIN
+	J9ThreadAbstractMonitor *monitor = (J9ThreadAbstractMonitor *)objectMonitor->monitor;
+
+	/* for now we don't allow deflation if spinning has been disabled for this monitor
+	 * because it has a longer hold time */
+	if ((NULL != monitor->tracing) && (0 != (monitor->flags & J9THREAD_MONITOR_DISABLE_SPINNING))) {
+		return FALSE;
+	}
+#endif
+
+	switch (vmStruct->javaVM->thrDeflationPolicy) {
+	case J9VM_DEFLATION_POLICY_NEVER:
+		break;
+	case J9VM_DEFLATION_POLICY_ASAP:
+		deflate = TRUE;
+		break;
+#ifdef J9VM_THR_SMART_DEFLATION
+	case J9VM_DEFLATION_POLICY_SMART:
+		Trc_VM_objectMonitorExit_SmartDecisionPoint(vmStruct,objectMonitor->proDeflationCount,objectMonitor->antiDeflationCount);
+#ifdef J9VM_CPU_TIMESTAMP_SUPPORT
+		deflate = (objectMonitor->proDeflationCount > objectMonitor->antiDeflationCount);
+#else
+		deflate = ( (objectMonitor->proDeflationCount / 1024) > objectMonitor->antiDeflationCount);
+#endif /* J9VM_CPU_TIMESTAMP_SUPPORT */
+		break;
+#endif /* J9VM_THR_SMART_DEFLATION */
+	}
+
+	return deflate;
+}
+
 IDATA
 objectMonitorExit(J9VMThread* vmStruct, j9object_t object)
 {
@@ -149,20 +192,11 @@ restart:
 		/* Dealing with an inflated monitor */
 		J9ObjectMonitor *objectMonitor = NULL;
 		J9ThreadAbstractMonitor *monitor = NULL;
-		IDATA deflate = 1;
 		
 		objectMonitor = J9_INFLLOCK_OBJECT_MONITOR(lock);		
 		monitor = (J9ThreadAbstractMonitor *)objectMonitor->monitor;
 		Assert_VM_notNull(monitor);
 
-#ifdef OMR_THR_ADAPTIVE_SPIN
-		/* for now we don't allow deflation if spinning has been disabled for this monitor
-		 * because it has a longer hold time */
-		if ((NULL != monitor->tracing) && (0 != (monitor->flags & J9THREAD_MONITOR_DISABLE_SPINNING))) {
-			deflate = 0;
-		}
-#endif
-
 		if (monitor->owner != vmStruct->osThread) {
 			Trc_VM_objectMonitorExit_Exit_IllegalInflatedLock(vmStruct, monitor->owner, vmStruct->osThread);
 			goto done;
@@ -179,32 +213,11 @@ restart:
 		 */
 		if (monitor->count == 1) {
 			if (0 == monitor->pinCount) {
-				if (deflate) {
-					deflate = 0;
-					switch (vmStruct->javaVM->thrDeflationPolicy) {
-					case J9VM_DEFLATION_POLICY_NEVER:
-						break;
-					case J9VM_DEFLATION_POLICY_ASAP:
-						deflate = 1;
-						break;
-#ifdef J9VM_THR_SMART_DEFLATION
-					case J9VM_DEFLATION_POLICY_SMART:
-						Trc_VM_objectMonitorExit_SmartDecisionPoint(vmStruct,objectMonitor->proDeflationCount,objectMonitor->antiDeflationCount);
-#ifdef J9VM_CPU_TIMESTAMP_SUPPORT
-						deflate = (objectMonitor->proDeflationCount > objectMonitor->antiDeflationCount);
-#else
-						deflate = ( (objectMonitor->proDeflationCount / 1024) > objectMonitor->antiDeflationCount);
-#endif /* J9VM_CPU_TIMESTAMP_SUPPORT */
-						break;
-#endif /* J9VM_THR_SMART_DEFLATION */
-					}
-
-					if (deflate) {
-						monitor->flags &= ~J9THREAD_MONITOR_INFLATED;
-						monitorExitWriteBarrier();
-						J9_STORE_LOCKWORD(vmStruct, lockEA, 0);
-						Trc_VM_objectMonitorDeflated(vmStruct, vmStruct->osThread, object, lock);
-					}
+				if (mayDeflateObjectMonitor(vmStruct, objectMonitor)) {
+					monitor->flags &= ~J9THREAD_MONITOR_INFLATED;
+					monitorExitWriteBarrier();
+					J9_STORE_LOCKWORD(vmStruct, lockEA, 0);
+					Trc_VM_objectMonitorDeflated(vmStruct, vmStruct->osThread, object, lock);
 				}
 			} else {
 				if (J9_EVENT_IS_HOOKED(vmStruct->javaVM->hookInterface, J9HOOK_VM_MONITOR_CONTENDED_EXIT)) {
@@ -295,6 +308,72 @@ objectMonitorEnter(J9VMThread* vmStruct, j9object_t object)
 
 #if defined (J9VM_THR_LOCK_RESERVATION)
 
+/**
+ * Thread handshake function which swaps an unreserved lock word into the object that
+ * the cancelling thread is blocked entering, if the target thread still holds the reservation.
+ * Runs either on the reserving thread at a safe point, or on the cancelling thread while
+ * the reserving thread is halted.
+ *
+ * @param[in] currentThread the thread running the handshake
+ * @param[in] reservationOwner the thread which reserved the lock
+ * @param[in] userData the cancelling J9VMThread, whose blockingEnterObject is the object
+ */
+static void
+cancelLockReservationHandshake(J9VMThread *currentThread, J9VMThread *reservationOwner, void *userData)
+{
+	J9VMThread *vmStruct = (J9VMThread *)userData;
+	/* read the object pointer here, since the cancelling thread may have released VM access */
+	j9object_t object = vmStruct->blockingEnterObject;
+	j9objectmonitor_t oldLock = 0;
+	j9objectmonitor_t newLock = 0;
+	j9objectmonitor_t *lockEA = NULL;
+
+	if (!LN_HAS_LOCKWORD(currentThread,object)) {
+		J9ObjectMonitor *objectMonitor = monitorTableAt(currentThread, object);
+
+		Assert_VM_true(objectMonitor != NULL);
+
+		lockEA = &objectMonitor->alternateLockword;
+	} else {
+		lockEA = J9OBJECT_MONITOR_EA(currentThread, object);
+	}
+
+	/* swap in an unreserved lock word */
+	/* (must use atomics since another thread might be doing this too) */
+	oldLock = J9_LOAD_LOCKWORD(currentThread, lockEA);
+
+	/* must verify that the reserving thread still owns the reservation */
+	if ( J9_FLATLOCK_OWNER(oldLock) == reservationOwner ) {
+		if (oldLock & OBJECT_HEADER_LOCK_RESERVED) {
+			if ( (oldLock & OBJECT_HEADER_LOCK_RECURSION_MASK) > 0 ) {
+				/* if the lock is acquired recursively, decrement the count and remove the reserved bit */
+				newLock = oldLock - OBJECT_HEADER_LOCK_RESERVED - OBJECT_HEADER_LOCK_FIRST_RECURSION_BIT;
+				Assert_VM_true(J9_FLATLOCK_COUNT(oldLock) == J9_FLATLOCK_COUNT(newLock));
+			} else {
+				/* otherwise clear the lock completely */
+				newLock = 0;
+				Assert_VM_true(J9_FLATLOCK_COUNT(oldLock) == 0);
+			}
+
+			/* TODO: Move file to C++, use VM_ObjectMonitor::compareAndSwapLockWord */
+			if (J9VMTHREAD_COMPRESS_OBJECT_REFERENCES(currentThread)) {
+				compareAndSwapU32((uint32_t*)lockEA, (uint32_t)oldLock, (uint32_t)newLock);
+			} else {
+				compareAndSwapUDATA((uintptr_t*)lockEA, (uintptr_t)oldLock, (uintptr_t)newLock);
+			}
+
+			/* 
+			 * CAS can only fail if another canceller has modified the lockword, in which case the
+			 * object is either no longer reserved or reserved by a different thread.
+			 * Such cases should be detected by the calling function when it re-attempts to enter the monitor.
+			 */
+
+			/* Transition from Reserved to Flat occurred so the Cancel Counter in the object's J9Class is incremented by 1. */
+			incrementCancelCounter(J9OBJECT_CLAZZ(currentThread, object));
+		}
+	}
+}
+
 void
 cancelLockReservation(J9VMThread* vmStruct)
 {
@@ -318,64 +397,12 @@ cancelLockReservation(J9VMThread* vmStruct)
 	lock = J9_LOAD_LOCKWORD(vmStruct, lockEA);
 
 	if ( (lock & (OBJECT_HEADER_LOCK_INFLATED | OBJECT_HEADER_LOCK_RESERVED)) == OBJECT_HEADER_LOCK_RESERVED) {
-		j9objectmonitor_t oldLock = 0;
-		j9objectmonitor_t newLock = 0;
 		J9VMThread* reservationOwner = J9_FLATLOCK_OWNER(lock);
 
 		Trc_VM_cancelLockReservation_reservationOwner(vmStruct, reservationOwner);
 
-		/* halt the reserving thread */
-		haltThreadForInspection(vmStruct, reservationOwner);
-
-		/* refresh the object pointer, since we may have released VM access */
-		object = vmStruct->blockingEnterObject;
-		if (!LN_HAS_LOCKWORD(vmStruct,object)) {
-			J9ObjectMonitor *objectMonitor = monitorTableAt(vmStruct, object);
-
-			Assert_VM_true(objectMonitor != NULL);
-
-			lockEA = &objectMonitor->alternateLockword;
-		} else {
-			lockEA = J9OBJECT_MONITOR_EA(vmStruct, object);
-		}
-
-		/* swap in an unreserved lock word */
-		/* (must use atomics since another thread might be doing this too) */
-		oldLock = J9_LOAD_LOCKWORD(vmStruct, lockEA);
-
-		/* must verify that the halted thread still owns the reservation */
-		if ( J9_FLATLOCK_OWNER(oldLock) == reservationOwner ) {
-			if (oldLock & OBJECT_HEADER_LOCK_RESERVED) {
-				if ( (oldLock & OBJECT_HEADER_LOCK_RECURSION_MASK) > 0 ) {
-					/* if the lock is acquired recursively, decrement the count and remove the reserved bit */
-					newLock = oldLock - OBJECT_HEADER_LOCK_RESERVED - OBJECT_HEADER_LOCK_FIRST_RECURSION_BIT;
-					Assert_VM_true(J9_FLATLOCK_COUNT(oldLock) == J9_FLATLOCK_COUNT(newLock));
-				} else {
-					/* otherwise clear the lock completely */
-					newLock = 0;
-					Assert_VM_true(J9_FLATLOCK_COUNT(oldLock) == 0);
-				}
-
-				/* TODO: Move file to C++, use VM_ObjectMonitor::compareAndSwapLockWord */
-				if (J9VMTHREAD_COMPRESS_OBJECT_REFERENCES(vmStruct)) {
-					compareAndSwapU32((uint32_t*)lockEA, (uint32_t)oldLock, (uint32_t)newLock);
-				} else {
-					compareAndSwapUDATA((uintptr_t*)lockEA, (uintptr_t)oldLock, (uintptr_t)newLock);
-				}
-
-				/* 
-				 * CAS can only fail if another canceller has modified the lockword, in which case the
-				 * object is either no longer reserved or reserved by a different thread.
-				 * Such cases should be detected by the calling function when it re-attempts to enter the monitor.
-				 */
-
-				/* Transition from Reserved to Flat occurred so the Cancel Counter in the object's J9Class is incremented by 1. */
-				incrementCancelCounter(J9OBJECT_CLAZZ(vmStruct, object));
-			}
-		}
-
-		/* resume the reserving thread */
-		resumeThreadForInspection(vmStruct, reservationOwner);
+		/* have the reserving thread give up the reservation at its next safe point */
+		executeThreadHandshake(vmStruct, reservationOwner, cancelLockReservationHandshake, vmStruct);
 	}
 
 	Trc_VM_cancelLockReservation_Exit(vmStruct);
@@ -428,3 +455,53 @@ objectMonitorDestroyComplete(J9JavaVM *vm, J9VMThread *vmThread)
 	omrthread_monitor_flush_destroyed_monitor_list(vmThread->osThread);
 }
 
+/**
+ * Called by the GC, while clearing the monitor table, for each monitor whose object survived.
+ * Deflates the monitor if it is still inflated but no thread owns it, waits on it or
+ * is blocked entering it, so that monitors which were left inflated by a contended
+ * exit do not keep the object on the slow locking path indefinitely.
+ *
+ * The J9ObjectMonitor stays in the monitor table, exactly as it does after a deflating exit.
+ *
+ * @pre the caller must have exclusive VM access, and the object must not be moving.
+ *
+ * @param[in] vm Java VM
+ * @param[in] vmThread the J9VMThread calling this function
+ * @param[in] objectMonitor the monitor table entry for a live object
+ * @return 1 if the monitor was deflated, 0 otherwise
+ */
+UDATA
+objectMonitorDeflateIdle(J9JavaVM *vm, J9VMThread *vmThread, J9ObjectMonitor *objectMonitor)
+{
+	UDATA deflated = 0;
+	J9ThreadAbstractMonitor *monitor = (J9ThreadAbstractMonitor *)objectMonitor->monitor;
+
+	/* Blocked and waiting threads pin the monitor, so an unpinned unowned monitor is idle */
+	if ((NULL == monitor->owner) && (0 == monitor->count) && (0 == monitor->pinCount)
+		&& J9_ARE_ANY_BITS_SET(monitor->flags, J9THREAD_MONITOR_INFLATED)
+	) {
+		j9object_t object = (j9object_t)monitor->userData;
+		j9objectmonitor_t *lockEA = NULL;
+		j9objectmonitor_t lock = 0;
+
+		if (!LN_HAS_LOCKWORD(vmThread, object)) {
+			lockEA = &(objectMonitor->alternateLockword);
+		} else {
+			lockEA = J9OBJECT_MONITOR_EA(vmThread, object);
+		}
+		lock = J9_LOAD_LOCKWORD(vmThread, lockEA);
+
+		if (J9_LOCK_IS_INFLATED(lock)
+			&& (J9_INFLLOCK_OBJECT_MONITOR(lock) == objectMonitor)
+			&& mayDeflateObjectMonitor(vmThread, objectMonitor)
+		) {
+			monitor->flags &= ~J9THREAD_MONITOR_INFLATED;
+			J9_STORE_LOCKWORD(vmThread, lockEA, 0);
+			Trc_VM_objectMonitorDeflated(vmThread, vmThread->osThread, object, lock);
+			deflated = 1;
+		}
+	}
+
+	return deflated;
+}
+
@@ -132,10 +132,6 @@ initializeMonitorTable(J9JavaVM* vm)
 		return -1;
 	}
 
-	if (omrthread_monitor_init_with_name(&vm->monitorTableMutex, 0, "VM monitor table")) {
-		return -1;
-	}
-
 	vm->monitorTableListPool = pool_new(sizeof(J9MonitorTableListEntry), 0, 0, 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(vm->portLibrary));
 	if (NULL == vm->monitorTableListPool) {
 		return -1;
@@ -146,11 +142,22 @@ initializeMonitorTable(J9JavaVM* vm)
 		return -1;
 	}
 	memset(vm->monitorTables, 0, sizeof(J9HashTable *) * tableCount);
-	
+
+	/* Each table has its own mutex, so inflation only contends with lookups that hash to the same table */
+	vm->monitorTableMutexes = (omrthread_monitor_t *)j9mem_allocate_memory(sizeof(omrthread_monitor_t) * tableCount, OMRMEM_CATEGORY_VM);
+	if (NULL == vm->monitorTableMutexes) {
+		return -1;
+	}
+	memset(vm->monitorTableMutexes, 0, sizeof(omrthread_monitor_t) * tableCount);
+
 	vm->monitorTableList = NULL;
 
 	for (tableIndex = 0; tableIndex < tableCount; tableIndex++) {
-		J9HashTable *table = createMonitorTable(vm, J9_GET_CALLSITE());
+		J9HashTable *table = NULL;
+		if (omrthread_monitor_init_with_name(&vm->monitorTableMutexes[tableIndex], 0, "VM monitor table")) {
+			return -1;
+		}
+		table = createMonitorTable(vm, J9_GET_CALLSITE());
 		if (NULL == table) {
 			return -1;
 		}
@@ -203,9 +210,18 @@ destroyMonitorTable(J9JavaVM* vm)
 		vm->monitorTableListPool = NULL;
 	}
 
-	if (NULL != vm->monitorTableMutex) {
-		omrthread_monitor_destroy(vm->monitorTableMutex);
-		vm->monitorTableMutex = NULL;
+	if (NULL != vm->monitorTableMutexes) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		UDATA tableIndex = 0;
+		for (tableIndex = 0; tableIndex < vm->monitorTableCount; tableIndex++) {
+			if (NULL != vm->monitorTableMutexes[tableIndex]) {
+				omrthread_monitor_destroy(vm->monitorTableMutexes[tableIndex]);
+				vm->monitorTableMutexes[tableIndex] = NULL;
+			}
+		}
+
+		j9mem_free_memory(vm->monitorTableMutexes);
+		vm->monitorTableMutexes = NULL;
 	}
 
 	/* Note: destroyMonitorTable is called after the GC hook interface has shut down,
@@ -224,7 +240,7 @@ J9ObjectMonitor *
 monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 {
 	J9JavaVM* vm = vmStruct->javaVM;
-	omrthread_monitor_t mutex = vm->monitorTableMutex;
+	omrthread_monitor_t mutex = NULL;
 	J9ObjectMonitor * objectMonitor = NULL;
 	J9ObjectMonitor key_objectMonitor;
 	J9ThreadAbstractMonitor key_monitor;
@@ -271,7 +287,7 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 	key_objectMonitor.hash = objectHashCode(vm, object);
 	index = key_objectMonitor.hash % (U_32)vm->monitorTableCount;
 	monitorTable = vm->monitorTables[index];
-
+	mutex = vm->monitorTableMutexes[index];
 
 	omrthread_monitor_enter(mutex);
 
@@ -285,6 +301,7 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 			UDATA monitorFlags = J9THREAD_MONITOR_OBJECT;
 
 			key_objectMonitor.alternateLockword = 0;
+			key_objectMonitor.tryEnterSpinBackoff = 0;
 
 			if (omrthread_monitor_init_with_name(&monitor, monitorFlags, NULL) == 0) {
 				TRACE("Adding monitor");
@@ -673,6 +673,7 @@ createClassHotFieldsInfo(J9JavaVM *javaVM, J9Class* clazz, uint8_t fieldOffset,
 			hotFieldsInfo->hotFieldOffset1 = U_8_MAX;
 			hotFieldsInfo->hotFieldOffset2 = U_8_MAX;
 			hotFieldsInfo->hotFieldOffset3 = U_8_MAX;
+			hotFieldsInfo->hotFieldCopyDepth = U_8_MAX;
 			hotFieldsInfo->classLoader = clazz->classLoader;
 			clazz->hotFieldsInfo = hotFieldsInfo;
 		}
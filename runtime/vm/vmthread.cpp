@@ -543,6 +543,8 @@ threadParseArguments(J9JavaVM *vm, char *optArg)
 	vm->thrMaxTryEnterYieldsBeforeBlocking = 45;
 	vm->thrNestedSpinning = 1;
 	vm->thrTryEnterNestedSpinning = 1;
+	vm->thrAdaptiveTryEnterSpinning = 0;
+	vm->thrDeflateIdleMonitors = 0;
 	vm->thrDeflationPolicy = J9VM_DEFLATION_POLICY_ASAP;
 
 	if (cpus > 1) {
@@ -778,6 +780,26 @@ threadParseArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "adaptiveTryEnterSpinning")) {
+			vm->thrAdaptiveTryEnterSpinning = 1;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noAdaptiveTryEnterSpinning")) {
+			vm->thrAdaptiveTryEnterSpinning = 0;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "deflateIdleMonitors")) {
+			vm->thrDeflateIdleMonitors = 1;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noDeflateIdleMonitors")) {
+			vm->thrDeflateIdleMonitors = 0;
+			continue;
+		}
+
 
 		if (try_scan(&scan_start, "staggerStep=")) {
 			if (scan_udata(&scan_start, &vm->thrStaggerStep)) {
@@ -1346,6 +1368,8 @@ dumpThreadingInfo(J9JavaVM* jvm)
 	j9tty_printf(PORTLIB, LEADING_SPACE "tryEnterYield=%zu,\n", jvm->thrMaxTryEnterYieldsBeforeBlocking);
 	j9tty_printf(PORTLIB, LEADING_SPACE "%sestedSpinning,\n", (jvm->thrNestedSpinning) ? "n" : "noN");
 	j9tty_printf(PORTLIB, LEADING_SPACE "%sryEnterNestedSpinning,\n", (jvm->thrTryEnterNestedSpinning) ? "t" : "noT");
+	j9tty_printf(PORTLIB, LEADING_SPACE "%sdaptiveTryEnterSpinning,\n", (jvm->thrAdaptiveTryEnterSpinning) ? "a" : "noA");
+	j9tty_printf(PORTLIB, LEADING_SPACE "%seflateIdleMonitors,\n", (jvm->thrDeflateIdleMonitors) ? "d" : "noD");
 	j9tty_printf(PORTLIB, LEADING_SPACE "%sestroyMutexOnMonitorFree,\n",
 		J9_ARE_ALL_BITS_SET(omrthread_lib_get_flags(), J9THREAD_LIB_FLAG_DESTROY_MUTEX_ON_MONITOR_FREE) ? "d" : "noD");
 #if !defined(WIN32) && defined(OMR_NOTIFY_POLICY_CONTROL)
@@ -121,6 +121,8 @@ public class TestMemoryMXBean {
 		}
 		attribs.put("MaximumGCThreads", new AttributeData(Integer.TYPE.getName(), true, false, false));
 		attribs.put("CurrentGCThreads", new AttributeData(Integer.TYPE.getName(), true, false, false));
+		attribs.put("IdleResidentSetReduction", new AttributeData(Long.TYPE.getName(), true, false, false));
+		attribs.put("LastIdleResidentSetReduction", new AttributeData(Long.TYPE.getName(), true, false, false));
 	}// end static initializer
 
 	private ExtendedMemoryMXBeanImpl mb;
@@ -201,6 +203,15 @@ public class TestMemoryMXBean {
 			AssertJUnit.assertNotNull(sharedCacheFreeSpace);
 			AssertJUnit.assertTrue(sharedCacheFreeSpace > -1);
 			logger.debug("Shared class cache free space : " + sharedCacheFreeSpace);
+
+			// -1 unless idle tuning is active, never negative otherwise.
+			Long idleRSSReduction = (Long)mbs.getAttribute(objName, "IdleResidentSetReduction");
+			AssertJUnit.assertNotNull(idleRSSReduction);
+			AssertJUnit.assertTrue(idleRSSReduction >= -1);
+			Long lastIdleRSSReduction = (Long)mbs.getAttribute(objName, "LastIdleResidentSetReduction");
+			AssertJUnit.assertNotNull(lastIdleRSSReduction);
+			AssertJUnit.assertTrue(lastIdleRSSReduction >= -1);
+			logger.debug("Idle resident set reduction : " + idleRSSReduction + " (last " + lastIdleRSSReduction + ")");
 		} catch (AttributeNotFoundException e) {
 			Assert.fail("Unexpected AttributeNotFoundException : " + e.getMessage());
 		} catch (MBeanException e) {
@@ -740,9 +751,9 @@ public class TestMemoryMXBean {
 		MBeanAttributeInfo[] attributes = mbi.getAttributes();
 		AssertJUnit.assertNotNull(attributes);
 		if (javaVersion >= 16) {
-			AssertJUnit.assertTrue(attributes.length == 24);
-		} else {
 			AssertJUnit.assertTrue(attributes.length == 26);
+		} else {
+			AssertJUnit.assertTrue(attributes.length == 28);
 		}
 		for (int i = 0; i < attributes.length; i++) {
 			MBeanAttributeInfo info = attributes[i];
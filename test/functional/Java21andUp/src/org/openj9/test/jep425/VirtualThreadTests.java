@@ -51,6 +51,10 @@ public class VirtualThreadTests {
 
 	public static native boolean lockSupportPark();
 
+	public static native long getContinuationStackSizeHint();
+
+	public static native long getMaxStackSize();
+
 	private void incrementalWait(Thread t) throws InterruptedException {
 		/* Incrementally wait for 10000 ms. */
 		for (int i = 0; i < 200; i++) {
@@ -356,4 +360,49 @@ public class VirtualThreadTests {
 			Assert.fail("Unexpected exception occured : " + e.getMessage() , e);
 		}
 	}
+
+	private static int recurseAndYield(int depth) throws InterruptedException {
+		if (0 == depth) {
+			/* unmount at the deepest point */
+			Thread.sleep(1);
+			return 0;
+		}
+		return recurseAndYield(depth - 1) + 1;
+	}
+
+	private static void runVirtualThreads(int count, int depth) throws InterruptedException {
+		Thread[] threads = new Thread[count];
+		for (int i = 0; i < count; i++) {
+			threads[i] = Thread.ofVirtual().start(() -> {
+				try {
+					recurseAndYield(depth);
+				} catch (InterruptedException e) {
+					throw new RuntimeException(e);
+				}
+			});
+		}
+		for (int i = 0; i < count; i++) {
+			threads[i].join();
+		}
+	}
+
+	@Test
+	public void test_continuationStackSizeHintDecays() {
+		try {
+			long maxHint = getMaxStackSize() / 4;
+
+			runVirtualThreads(16, 1000);
+			long deepHint = getContinuationStackSizeHint();
+			AssertJUnit.assertTrue("No stack size hint after deep virtual threads", deepHint > 0);
+			AssertJUnit.assertTrue("Stack size hint " + deepHint + " exceeds a quarter of -Xss " + maxHint, deepHint <= maxHint);
+
+			runVirtualThreads(200, 0);
+			long shallowHint = getContinuationStackSizeHint();
+			AssertJUnit.assertTrue(
+					"Stack size hint did not decay after shallow virtual threads: " + deepHint + " -> " + shallowHint,
+					shallowHint < (deepHint / 2));
+		} catch (Exception e) {
+			Assert.fail("Unexpected exception occured : " + e.getMessage() , e);
+		}
+	}
 }
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+package org.openj9.test.jep454.downcall;
+
+import org.testng.annotations.Test;
+import org.testng.Assert;
+
+import java.lang.invoke.MethodHandle;
+
+import java.lang.foreign.Linker;
+import java.lang.foreign.FunctionDescriptor;
+import java.lang.foreign.MemorySegment;
+import java.lang.foreign.SymbolLookup;
+import static java.lang.foreign.ValueLayout.*;
+
+/**
+ * Test cases for JEP 454: Foreign Linker API for primitive types in downcall,
+ * which time repeated downcalls and repeated downcall handle creation with the same
+ * function descriptor (served from the cached prep_cif) and report the time per call.
+ *
+ * The bounds are deliberately loose so that the tests only catch gross regressions,
+ * e.g. a handle creation or a downcall which falls back to a slow path on every call.
+ */
+@Test(groups = { "level.sanity" })
+public class DowncallTimingTests {
+	private static final int WARMUP_ITERATIONS = 10000;
+	private static final int TIMED_ITERATIONS = 100000;
+	private static final long MAX_NANOS_PER_DOWNCALL = 100000L;
+	private static final long MAX_NANOS_PER_HANDLE = 1000000L;
+
+	private static Linker linker = Linker.nativeLinker();
+
+	static {
+		System.loadLibrary("clinkerffitests");
+	}
+	private static final SymbolLookup nativeLibLookup = SymbolLookup.loaderLookup();
+
+	@Test
+	public void test_nanosPerDowncall() throws Throwable {
+		FunctionDescriptor fd = FunctionDescriptor.of(JAVA_INT, JAVA_INT, JAVA_INT);
+		MemorySegment functionSymbol = nativeLibLookup.find("add2Ints").get();
+		MethodHandle mh = linker.downcallHandle(functionSymbol, fd);
+
+		int result = 0;
+		for (int i = 0; i < WARMUP_ITERATIONS; i++) {
+			result = (int)mh.invokeExact(i, 1);
+		}
+		Assert.assertEquals(result, WARMUP_ITERATIONS);
+
+		long startTime = System.nanoTime();
+		for (int i = 0; i < TIMED_ITERATIONS; i++) {
+			result = (int)mh.invokeExact(i, 1);
+		}
+		long nanosPerCall = (System.nanoTime() - startTime) / TIMED_ITERATIONS;
+		Assert.assertEquals(result, TIMED_ITERATIONS);
+
+		System.out.println("add2Ints downcall: " + nanosPerCall + " ns per call");
+		Assert.assertTrue(nanosPerCall < MAX_NANOS_PER_DOWNCALL, "add2Ints downcall took " + nanosPerCall + " ns per call");
+	}
+
+	@Test
+	public void test_nanosPerDowncallHandleWithCachedFuncDescriptor() throws Throwable {
+		MemorySegment functionSymbol = nativeLibLookup.find("add2Doubles").get();
+		int handleCount = TIMED_ITERATIONS / 100;
+
+		/* A new descriptor instance per handle, so each handle is created rather than found in the linker's cache. */
+		linker.downcallHandle(functionSymbol, FunctionDescriptor.of(JAVA_DOUBLE, JAVA_DOUBLE, JAVA_DOUBLE));
+		MethodHandle mh = null;
+		long startTime = System.nanoTime();
+		for (int i = 0; i < handleCount; i++) {
+			mh = linker.downcallHandle(functionSymbol, FunctionDescriptor.of(JAVA_DOUBLE, JAVA_DOUBLE, JAVA_DOUBLE.withName("arg" + i)));
+		}
+		long nanosPerHandle = (System.nanoTime() - startTime) / handleCount;
+		double result = (double)mh.invokeExact(159.748d, 262.795d);
+		Assert.assertEquals(result, 422.543d, 0.001d);
+
+		System.out.println("add2Doubles downcall handle: " + nanosPerHandle + " ns per handle");
+		Assert.assertTrue(nanosPerHandle < MAX_NANOS_PER_HANDLE, "add2Doubles downcall handle took " + nanosPerHandle + " ns per handle");
+	}
+}
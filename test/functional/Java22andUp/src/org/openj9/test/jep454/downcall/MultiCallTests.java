@@ -136,4 +136,25 @@ public class MultiCallTests {
 		mh = linker.downcallHandle(functionSymbol2, fd2);
 		mh.invokeExact(454, 398);
 	}
+
+	@Test
+	public void test_multiCallsWithCollidingLayoutStrHashCodes() throws Throwable {
+		/* The layout strings of these descriptors ("(|1C|4I|8J|8J|4F|8D|4F|)8D" and "(|4I|8D|1C|2S|8D|8J|2S|)8D")
+		 * have the same hash code, so they must not share the cached prep_cif of each other.
+		 */
+		FunctionDescriptor fd1 = FunctionDescriptor.of(JAVA_DOUBLE, JAVA_BYTE, JAVA_INT, JAVA_LONG, JAVA_LONG, JAVA_FLOAT, JAVA_DOUBLE, JAVA_FLOAT);
+		MemorySegment functionSymbol1 = nativeLibLookup.find("addByteIntLongLongFloatDoubleFloat").get();
+		MethodHandle mh1 = linker.downcallHandle(functionSymbol1, fd1);
+		double result = (double)mh1.invokeExact((byte)1, 2, 3L, 4L, 5.5f, 6.25d, 7.5f);
+		Assert.assertEquals(result, 29.25d, 0.001d);
+
+		FunctionDescriptor fd2 = FunctionDescriptor.of(JAVA_DOUBLE, JAVA_INT, JAVA_DOUBLE, JAVA_BYTE, JAVA_SHORT, JAVA_DOUBLE, JAVA_LONG, JAVA_SHORT);
+		MemorySegment functionSymbol2 = nativeLibLookup.find("addIntDoubleByteShortDoubleLongShort").get();
+		MethodHandle mh2 = linker.downcallHandle(functionSymbol2, fd2);
+		result = (double)mh2.invokeExact(1, 2.5d, (byte)3, (short)4, 5.25d, 6L, (short)7);
+		Assert.assertEquals(result, 28.75d, 0.001d);
+
+		result = (double)mh1.invokeExact((byte)11, 12, 13L, 14L, 15.5f, 16.25d, 17.5f);
+		Assert.assertEquals(result, 99.25d, 0.001d);
+	}
 }
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+package j9vm.test.arraylets;
+
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+
+/*
+ * Allocate primitive arrays larger than a region, move their spines with GCs and check that the
+ * data survives, both through normal element access and through JNI critical access.
+ * Run with -Xgc:enableVirtualLargeObjectHeap so that the data is stored off heap where supported.
+ */
+public class OffHeapArrayTest {
+	private static final int ARRAY_COUNT = 8;
+	private static final int GC_COUNT = 4;
+	/* 8GB of 1MB arrays: more than fits below the compressed references heap ceiling without collecting */
+	private static final int CHURN_COUNT = 8 * 1024;
+	private static final int CHURN_LIVE = 16;
+
+	/* returns true if every element matched its expected pattern; increments every element and commits */
+	private static native boolean verifyAndIncrementCritical(byte[] array, byte seed);
+
+	//these are public statics to avoid compiler optimizations removing them
+	public static byte[][] bytes = new byte[ARRAY_COUNT][];
+	public static long[][] longs = new long[ARRAY_COUNT][];
+	public static Object[] garbage = null;
+
+	public static void main(String[] args) {
+		System.loadLibrary("j9ben");
+
+		System.out.println("Testing large primitive array allocation...");
+		for (int i = 0; i < ARRAY_COUNT; i++) {
+			/* from just under a typical region size up to several regions */
+			int size = (512 * 1024) + (i * 1024 * 1024) - 8;
+			bytes[i] = new byte[size];
+			longs[i] = new long[size / 8];
+			checkZero(bytes[i]);
+			checkZero(longs[i]);
+			fill(bytes[i], (byte)i);
+			fill(longs[i], i);
+			/* a large pointer array keeps the regular discontiguous layout */
+			garbage = new Object[size / 8];
+			garbage[garbage.length - 1] = bytes[i];
+		}
+		System.out.println("Large primitive array allocation tests passed.");
+
+		System.out.println("Testing large primitive arrays across GCs...");
+		for (int gc = 0; gc < GC_COUNT; gc++) {
+			/* churn so that copy-forward and compaction move the spines */
+			for (int i = 0; i < 64; i++) {
+				garbage = new Object[4096];
+			}
+			garbage = null;
+			System.gc();
+			for (int i = 0; i < ARRAY_COUNT; i++) {
+				check(bytes[i], (byte)(i + gc));
+				check(longs[i], i);
+				if (!verifyAndIncrementCritical(bytes[i], (byte)(i + gc))) {
+					throw new RuntimeException("JNI critical data mismatch for array " + i + " after GC " + gc);
+				}
+			}
+			/* drop half of the arrays so their off heap data is released */
+			if (1 == gc) {
+				for (int i = 0; i < ARRAY_COUNT; i += 2) {
+					bytes[i] = new byte[bytes[i].length];
+					fill(bytes[i], (byte)(i + gc + 1));
+				}
+			}
+		}
+		System.out.println("Large primitive arrays across GCs tests passed.");
+
+		System.out.println("Testing large primitive array churn...");
+		/* the spines are tiny, so only off heap bytes paying allocation tax trigger the collections that free dead data */
+		long collectionsBefore = collectionCount();
+		byte[][] live = new byte[CHURN_LIVE][];
+		for (int i = 0; i < CHURN_COUNT; i++) {
+			byte[] array = new byte[1024 * 1024];
+			array[array.length - 1] = (byte)i;
+			live[i % CHURN_LIVE] = array;
+		}
+		for (int i = 0; i < CHURN_LIVE; i++) {
+			/* CHURN_COUNT is a multiple of CHURN_LIVE, so slot i holds the array allocated at CHURN_COUNT - CHURN_LIVE + i */
+			byte expected = (byte)(CHURN_COUNT - CHURN_LIVE + i);
+			if (expected != live[i][live[i].length - 1]) {
+				throw new RuntimeException("churned array " + i + " has the wrong contents");
+			}
+		}
+		if (collectionsBefore == collectionCount()) {
+			throw new RuntimeException("allocating " + CHURN_COUNT + "MB of large arrays did not trigger a collection");
+		}
+		System.out.println("Large primitive array churn tests passed.");
+	}
+
+	private static long collectionCount() {
+		long count = 0;
+		for (GarbageCollectorMXBean bean : ManagementFactory.getGarbageCollectorMXBeans()) {
+			count += Math.max(0, bean.getCollectionCount());
+		}
+		return count;
+	}
+
+	private static void fill(byte[] array, byte seed) {
+		for (int i = 0; i < array.length; i++) {
+			array[i] = (byte)(seed + i);
+		}
+	}
+
+	private static void fill(long[] array, long seed) {
+		for (int i = 0; i < array.length; i++) {
+			array[i] = seed + i;
+		}
+	}
+
+	private static void checkZero(byte[] array) {
+		for (int i = 0; i < array.length; i++) {
+			if (0 != array[i]) {
+				throw new RuntimeException("byte[" + array.length + "] not zeroed at " + i);
+			}
+		}
+	}
+
+	private static void checkZero(long[] array) {
+		for (int i = 0; i < array.length; i++) {
+			if (0 != array[i]) {
+				throw new RuntimeException("long[" + array.length + "] not zeroed at " + i);
+			}
+		}
+	}
+
+	private static void check(byte[] array, byte seed) {
+		for (int i = 0; i < array.length; i++) {
+			if ((byte)(seed + i) != array[i]) {
+				throw new RuntimeException("byte[" + array.length + "] mismatch at " + i);
+			}
+		}
+	}
+
+	private static void check(long[] array, long seed) {
+		for (int i = 0; i < array.length; i++) {
+			if ((seed + i) != array[i]) {
+				throw new RuntimeException("long[" + array.length + "] mismatch at " + i);
+			}
+		}
+	}
+}
@@ -0,0 +1,48 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+package j9vm.test.arraylets;
+
+import j9vm.runner.Runner;
+
+public class OffHeapArrayTestRunner extends Runner {
+
+	private final String customizedHeapOptions = "-Xms256m -Xmx256m";
+
+	public OffHeapArrayTestRunner(String className, String exeName, String bootClassPath, String userClassPath, String javaVersion) {
+		super(className, exeName, bootClassPath, userClassPath, javaVersion);
+	}
+
+	/* Large arrays only leave the heap under balanced; the option is ignored by VMs built without sparse heap allocation. */
+	@Override
+	public String getCustomCommandLineOptions() {
+		return super.getCustomCommandLineOptions() + " -Xgcpolicy:balanced -Xgc:enableVirtualLargeObjectHeap -Xdisableexcessivegc";
+	}
+
+	/* the live arrays do not fit the default test heap when the VM keeps their data on heap */
+	@Override
+	public String getCommandLine() {
+		return super.exeName + " " + customizedHeapOptions + " " + getCustomCommandLineOptions() + " "
+			+ super.getJ9VMSystemPropertiesString() + " " + super.getBootClassPathOption() + " "
+			+ super.getUserClassPathOption() + " ";
+	}
+
+}
@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+package j9vm.test.itable;
+
+import java.io.Serializable;
+
+/*
+ * Classes implementing more than J9_ITABLE_HASH_THRESHOLD interfaces find their iTables through
+ * a hash rather than by walking the iTable list. Call, cast and instanceof check every interface
+ * of such classes in an order that keeps missing the single entry lastITable cache, and check
+ * the interfaces they do not implement.
+ */
+public class ITableHashTest {
+	private static final int ITERATIONS = 10000;
+
+	interface I0 { int id0(); }
+	interface I1 { int id1(); }
+	interface I2 { int id2(); }
+	interface I3 { int id3(); }
+	interface I4 { int id4(); }
+	interface I5 { int id5(); }
+	interface I6 { int id6(); }
+	interface I7 { int id7(); }
+	interface I8 { int id8(); }
+	interface I9 { int id9(); }
+	interface I10 { int id10(); }
+	interface I11 { int id11(); }
+	interface I12 extends I0, I11 { int id12(); }
+	interface IDefault { default int idDefault() { return 100; } }
+	interface NotImplemented { int notImplemented(); }
+
+	static class Many implements I0, I1, I2, I3, I4, I5, I6, I7, I8, I9, I10, I11, IDefault {
+		public int id0() { return 0; }
+		public int id1() { return 1; }
+		public int id2() { return 2; }
+		public int id3() { return 3; }
+		public int id4() { return 4; }
+		public int id5() { return 5; }
+		public int id6() { return 6; }
+		public int id7() { return 7; }
+		public int id8() { return 8; }
+		public int id9() { return 9; }
+		public int id10() { return 10; }
+		public int id11() { return 11; }
+	}
+
+	/* inherits the iTables of Many and adds one whose superinterfaces are already implemented */
+	static class Sub extends Many implements I12 {
+		public int id5() { return 50; }
+		public int id12() { return 12; }
+	}
+
+	/* below the threshold, so iTables are still found by walking the list */
+	static class Few implements I0, I1, IDefault {
+		public int id0() { return 0; }
+		public int id1() { return 1; }
+	}
+
+	public static void main(String[] args) {
+		for (int i = 0; i < ITERATIONS; i++) {
+			checkMany(new Many(), false);
+			checkMany(new Sub(), true);
+			checkFew(new Few());
+			checkArrays();
+		}
+		System.out.println("iTable hash tests passed.");
+	}
+
+	private static void checkMany(Object o, boolean isSub) {
+		/* alternate between the first and last interfaces so each lookup misses lastITable */
+		check(((I11)o).id11(), 11);
+		check(((I0)o).id0(), 0);
+		check(((I10)o).id10(), 10);
+		check(((I1)o).id1(), 1);
+		check(((I9)o).id9(), 9);
+		check(((I2)o).id2(), 2);
+		check(((I8)o).id8(), 8);
+		check(((I3)o).id3(), 3);
+		check(((I7)o).id7(), 7);
+		check(((I4)o).id4(), 4);
+		check(((I6)o).id6(), 6);
+		check(((I5)o).id5(), isSub ? 50 : 5);
+		check(((IDefault)o).idDefault(), 100);
+
+		check(o instanceof I0, true);
+		check(o instanceof I6, true);
+		check(o instanceof I11, true);
+		check(o instanceof IDefault, true);
+		check(o instanceof I12, isSub);
+		check(o instanceof NotImplemented, false);
+		check(o instanceof Runnable, false);
+		if (isSub) {
+			I12 i12 = (I12)o;
+			check(i12.id12(), 12);
+			check(i12.id0(), 0);
+			check(i12.id11(), 11);
+		}
+		try {
+			((NotImplemented)o).notImplemented();
+			throw new RuntimeException("**FAILURE** cast of " + o.getClass().getName() + " to NotImplemented succeeded");
+		} catch (ClassCastException e) {
+			/* expected */
+		}
+	}
+
+	private static void checkFew(Object o) {
+		check(((I1)o).id1(), 1);
+		check(((I0)o).id0(), 0);
+		check(((IDefault)o).idDefault(), 100);
+		check(o instanceof I2, false);
+		check(o instanceof I11, false);
+	}
+
+	private static void checkArrays() {
+		/* array classes share the iTables of [Z */
+		Object[] objects = new Many[1];
+		int[][] ints = new int[1][];
+		check(objects instanceof Cloneable, true);
+		check(objects instanceof Serializable, true);
+		check(ints instanceof Cloneable, true);
+		check(((Object)ints) instanceof Runnable, false);
+		check(((Cloneable)objects) != null, true);
+		check(((Serializable)ints) != null, true);
+	}
+
+	private static void check(int actual, int expected) {
+		if (actual != expected) {
+			throw new RuntimeException("**FAILURE** expected " + expected + " but got " + actual);
+		}
+	}
+
+	private static void check(boolean actual, boolean expected) {
+		if (actual != expected) {
+			throw new RuntimeException("**FAILURE** expected " + expected + " but got " + actual);
+		}
+	}
+}
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+package j9vm.test.jni;
+
+/*
+ * Create and delete JNI global refs from several threads at once, including deletes of the same
+ * refs from every thread and deleting a ref twice, and check that no slot is ever handed out to
+ * two live refs.
+ */
+public class GlobalRefTest {
+	private static final int THREAD_COUNT = 8;
+	private static final int REF_COUNT = 64;
+	private static final int ITERATIONS = 2000;
+
+	/* returns the handles of new global refs to the objects */
+	private static native long[] createSharedRefs(Object[] objects);
+	/* deletes the global refs, which may already have been deleted by another thread */
+	private static native void deleteSharedRefs(long[] handles);
+	/* returns true if every new global ref had its own slot and referred to its object */
+	private static native boolean churnGlobalRefs(Object[] objects, int iterations);
+	/* returns true if deleting a ref twice did not free its slot twice */
+	private static native boolean deleteTwice(Object first, Object second);
+
+	public static void main(String[] args) throws Exception {
+		System.loadLibrary("j9ben");
+
+		System.out.println("Testing double delete of a JNI global ref...");
+		for (int i = 0; i < REF_COUNT; i++) {
+			if (!deleteTwice(new Object(), new Object())) {
+				fail("a global ref slot was handed out twice after a double delete");
+			}
+		}
+
+		System.out.println("Testing concurrent delete of shared JNI global refs...");
+		final long[] shared = createSharedRefs(newObjects(REF_COUNT));
+		Thread[] threads = new Thread[THREAD_COUNT];
+		for (int i = 0; i < THREAD_COUNT; i++) {
+			threads[i] = new Thread(new Runnable() {
+				public void run() {
+					deleteSharedRefs(shared);
+				}
+			});
+			threads[i].start();
+		}
+		for (int i = 0; i < THREAD_COUNT; i++) {
+			threads[i].join();
+		}
+
+		System.out.println("Testing concurrent create and delete of JNI global refs...");
+		final boolean[] results = new boolean[THREAD_COUNT];
+		for (int i = 0; i < THREAD_COUNT; i++) {
+			final int index = i;
+			/* each thread refers to its own objects, so a shared slot shows up as a wrong object */
+			final Object[] objects = newObjects(REF_COUNT);
+			threads[i] = new Thread(new Runnable() {
+				public void run() {
+					results[index] = churnGlobalRefs(objects, ITERATIONS);
+				}
+			});
+			threads[i].start();
+		}
+		for (int i = 0; i < THREAD_COUNT; i++) {
+			while (threads[i].isAlive()) {
+				System.gc();
+				threads[i].join(10);
+			}
+		}
+		for (int i = 0; i < THREAD_COUNT; i++) {
+			if (!results[i]) {
+				fail("thread " + i + " found a global ref that did not refer to its object");
+			}
+		}
+		System.out.println("JNI global ref tests passed.");
+	}
+
+	private static Object[] newObjects(int count) {
+		Object[] objects = new Object[count];
+		for (int i = 0; i < count; i++) {
+			objects[i] = new Object();
+		}
+		return objects;
+	}
+
+	private static void fail(String message) {
+		System.out.println("**FAILURE** " + message);
+		throw new RuntimeException(message);
+	}
+}
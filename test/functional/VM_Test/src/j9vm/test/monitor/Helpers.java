@@ -58,5 +58,7 @@ public class Helpers {
 	public static native int monitorExitWithException(Object obj, Throwable throwable);
 	
 	public static native void monitorReserve(Object obj);
+
+	public static native boolean isInflated(Object obj);
 	
 }
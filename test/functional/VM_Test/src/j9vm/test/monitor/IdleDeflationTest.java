@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+package j9vm.test.monitor;
+
+/*
+ * Contend on monitors while GCs run, with adaptive try-enter spinning and the deflation of idle
+ * monitors by the GC enabled. Check that no increment made under a monitor is lost, that the
+ * GC never deflates a monitor which is owned or has a waiting thread, and that an idle monitor
+ * is flat after a GC.
+ */
+public class IdleDeflationTest {
+	private static final int THREAD_COUNT = 8;
+	private static final int LOCK_COUNT = 4;
+	private static final int ITERATIONS = 20000;
+
+	static class Counter {
+		int count;
+	}
+
+	private static final Counter[] counters = new Counter[LOCK_COUNT];
+
+	public static void main(String[] args) throws Exception {
+		for (int i = 0; i < LOCK_COUNT; i++) {
+			counters[i] = new Counter();
+		}
+
+		System.out.println("Testing contended monitors across GCs...");
+		Thread[] threads = new Thread[THREAD_COUNT];
+		for (int i = 0; i < THREAD_COUNT; i++) {
+			final int index = i;
+			threads[i] = new Thread(new Runnable() {
+				public void run() {
+					for (int j = 0; j < ITERATIONS; j++) {
+						Counter counter = counters[(index + j) % LOCK_COUNT];
+						synchronized (counter) {
+							counter.count += 1;
+							/* long hold times on some enters make spinning fail, so the spin backs off */
+							if (0 == (j % 1000)) {
+								sleep(1);
+							}
+						}
+					}
+				}
+			});
+			threads[i].start();
+		}
+		for (int i = 0; i < THREAD_COUNT; i++) {
+			while (threads[i].isAlive()) {
+				System.gc();
+				threads[i].join(10);
+			}
+		}
+		int total = 0;
+		for (int i = 0; i < LOCK_COUNT; i++) {
+			total += counters[i].count;
+		}
+		if ((THREAD_COUNT * ITERATIONS) != total) {
+			fail("expected " + (THREAD_COUNT * ITERATIONS) + " increments, found " + total);
+		}
+
+		System.gc();
+		for (int i = 0; i < LOCK_COUNT; i++) {
+			if (Helpers.isInflated(counters[i])) {
+				fail("monitor " + i + " is still inflated after a GC although no thread uses it");
+			}
+		}
+
+		System.out.println("Testing a monitor with a waiting thread across a GC...");
+		final Counter waitCounter = new Counter();
+		Thread waiter = new Thread(new Runnable() {
+			public void run() {
+				synchronized (waitCounter) {
+					waitCounter.count = 1;
+					waitCounter.notifyAll();
+					while (1 == waitCounter.count) {
+						try {
+							waitCounter.wait();
+						} catch (InterruptedException e) {
+							throw new RuntimeException(e);
+						}
+					}
+				}
+			}
+		});
+		synchronized (waitCounter) {
+			waiter.start();
+			while (0 == waitCounter.count) {
+				waitCounter.wait();
+			}
+		}
+		/* the waiter has released the monitor in wait(), which keeps it inflated */
+		System.gc();
+		if (!Helpers.isInflated(waitCounter)) {
+			fail("a monitor with a waiting thread was deflated by a GC");
+		}
+		synchronized (waitCounter) {
+			waitCounter.count = 2;
+			waitCounter.notifyAll();
+		}
+		waiter.join();
+
+		System.out.println("Testing an owned monitor across a GC...");
+		final Counter ownedCounter = new Counter();
+		Thread blocker = new Thread(new Runnable() {
+			public void run() {
+				synchronized (ownedCounter) {
+					ownedCounter.count += 1;
+				}
+			}
+		});
+		synchronized (ownedCounter) {
+			blocker.start();
+			/* wait until the blocked enter has inflated the monitor */
+			while (!Helpers.isInflated(ownedCounter)) {
+				sleep(1);
+			}
+			System.gc();
+			if (!Helpers.isInflated(ownedCounter)) {
+				fail("an owned monitor was deflated by a GC");
+			}
+			ownedCounter.count += 1;
+		}
+		/* the blocked thread has to be able to take the monitor after it is released */
+		blocker.join();
+		if (2 != ownedCounter.count) {
+			fail("expected 2 increments of the owned monitor, found " + ownedCounter.count);
+		}
+
+		System.out.println("Idle monitor deflation tests passed.");
+	}
+
+	private static void sleep(long millis) {
+		try {
+			Thread.sleep(millis);
+		} catch (InterruptedException e) {
+			throw new RuntimeException(e);
+		}
+	}
+
+	private static void fail(String message) {
+		System.out.println("**FAILURE** " + message);
+		throw new RuntimeException(message);
+	}
+}
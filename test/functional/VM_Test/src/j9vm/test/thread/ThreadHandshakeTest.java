@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+package j9vm.test.thread;
+
+import java.util.concurrent.atomic.AtomicInteger;
+
+/*
+ * Check Thread.getState for threads in each state, and take stack traces of running threads
+ * from several threads at once, including threads taking each other's stack traces, while
+ * GCs run. Stack traces of running threads are taken at the target's next safe point.
+ */
+public class ThreadHandshakeTest {
+	private static final int THREAD_COUNT = 4;
+	private static final int SAMPLES = 2000;
+	private static final long TIMEOUT_MILLIS = 5 * 60 * 1000;
+
+	private static final AtomicInteger spinning = new AtomicInteger();
+	private static volatile boolean running = true;
+	private static volatile long sink;
+
+	public static void main(String[] args) throws Exception {
+		testGetState();
+		testGetStackTrace();
+		System.out.println("Thread handshake tests passed.");
+	}
+
+	private static void testGetState() throws Exception {
+		System.out.println("Testing Thread.getState...");
+		final Object lock = new Object();
+		final Object waitLock = new Object();
+
+		Thread spinner = new Thread(new Runnable() {
+			public void run() {
+				spin();
+			}
+		});
+		checkState(spinner, Thread.State.NEW);
+		spinner.setDaemon(true);
+		spinner.start();
+		awaitState(spinner, Thread.State.RUNNABLE);
+
+		Thread sleeper = new Thread(new Runnable() {
+			public void run() {
+				try {
+					Thread.sleep(TIMEOUT_MILLIS);
+				} catch (InterruptedException e) {
+					/* expected */
+				}
+			}
+		});
+		sleeper.start();
+		awaitState(sleeper, Thread.State.TIMED_WAITING);
+
+		Thread waiter = new Thread(new Runnable() {
+			public void run() {
+				synchronized (waitLock) {
+					try {
+						waitLock.wait();
+					} catch (InterruptedException e) {
+						/* expected */
+					}
+				}
+			}
+		});
+		waiter.start();
+		awaitState(waiter, Thread.State.WAITING);
+
+		Thread blocked = new Thread(new Runnable() {
+			public void run() {
+				synchronized (lock) {
+					sink += 1;
+				}
+			}
+		});
+		synchronized (lock) {
+			blocked.start();
+			awaitState(blocked, Thread.State.BLOCKED);
+		}
+
+		running = false;
+		sleeper.interrupt();
+		waiter.interrupt();
+		Thread[] threads = { spinner, sleeper, waiter, blocked };
+		for (int i = 0; i < threads.length; i++) {
+			threads[i].join(TIMEOUT_MILLIS);
+			checkState(threads[i], Thread.State.TERMINATED);
+		}
+		running = true;
+	}
+
+	private static void testGetStackTrace() throws Exception {
+		System.out.println("Testing Thread.getStackTrace of running threads...");
+		spinning.set(0);
+		final Thread[] spinners = new Thread[THREAD_COUNT];
+		for (int i = 0; i < THREAD_COUNT; i++) {
+			spinners[i] = new Thread(new Runnable() {
+				public void run() {
+					spin();
+				}
+			});
+			spinners[i].setDaemon(true);
+			spinners[i].start();
+		}
+		while (spinning.get() < THREAD_COUNT) {
+			Thread.sleep(1);
+		}
+
+		final Thread[] samplers = new Thread[THREAD_COUNT];
+		final String[] failures = new String[THREAD_COUNT];
+		for (int i = 0; i < THREAD_COUNT; i++) {
+			final int index = i;
+			samplers[i] = new Thread(new Runnable() {
+				public void run() {
+					for (int j = 0; j < SAMPLES; j++) {
+						/* spinners stay in spin(), while samplers sample each other concurrently */
+						StackTraceElement[] trace = spinners[(index + j) % THREAD_COUNT].getStackTrace();
+						if (!contains(trace, "spin")) {
+							failures[index] = "a stack trace of a spinning thread does not contain spin()";
+							return;
+						}
+						samplers[(index + 1) % THREAD_COUNT].getStackTrace();
+					}
+				}
+			});
+		}
+		for (int i = 0; i < THREAD_COUNT; i++) {
+			samplers[i].setDaemon(true);
+			samplers[i].start();
+		}
+		long deadline = System.currentTimeMillis() + TIMEOUT_MILLIS;
+		for (int i = 0; i < THREAD_COUNT; i++) {
+			while (samplers[i].isAlive()) {
+				if (System.currentTimeMillis() > deadline) {
+					fail("stack trace sampling did not complete, the samplers may be deadlocked");
+				}
+				System.gc();
+				samplers[i].join(10);
+			}
+		}
+		running = false;
+		for (int i = 0; i < THREAD_COUNT; i++) {
+			spinners[i].join(TIMEOUT_MILLIS);
+		}
+		running = true;
+		for (int i = 0; i < THREAD_COUNT; i++) {
+			if (null != failures[i]) {
+				fail("sampler " + i + ": " + failures[i]);
+			}
+		}
+	}
+
+	static void spin() {
+		long value = 0;
+		spinning.incrementAndGet();
+		while (running) {
+			value += 1;
+			/* allocate so that the spinning threads take part in GCs */
+			if (0 == (value % 1024)) {
+				sink += new Object().hashCode();
+			}
+		}
+		sink += value;
+	}
+
+	private static boolean contains(StackTraceElement[] trace, String methodName) {
+		for (int i = 0; i < trace.length; i++) {
+			if (methodName.equals(trace[i].getMethodName())) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	private static void awaitState(Thread thread, Thread.State state) throws InterruptedException {
+		long deadline = System.currentTimeMillis() + TIMEOUT_MILLIS;
+		while (thread.getState() != state) {
+			if (System.currentTimeMillis() > deadline) {
+				fail("thread did not reach " + state + ", it is " + thread.getState());
+			}
+			Thread.sleep(1);
+		}
+	}
+
+	private static void checkState(Thread thread, Thread.State state) {
+		Thread.State actual = thread.getState();
+		if (actual != state) {
+			fail("expected thread state " + state + ", found " + actual);
+		}
+	}
+
+	private static void fail(String message) {
+		System.out.println("**FAILURE** " + message);
+		throw new RuntimeException(message);
+	}
+}
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * Blocks one finalizer forever and checks that the rest of the finalizer queue is still drained and
+ * that System.runFinalization() keeps returning. Run with -Xgc:finalizeCycleLimit= so that the
+ * worker stuck in the finalizer, primary or assist, is abandoned.
+ */
+public class FinalizerStuckWorker
+{
+	static final AtomicInteger finalizedCount = new AtomicInteger();
+	static final CountDownLatch stuck = new CountDownLatch(1);
+	static final Object forever = new Object();
+
+	static class Stuck
+	{
+		@Override
+		protected void finalize() throws InterruptedException
+		{
+			stuck.countDown();
+			synchronized (forever) {
+				for (;;) {
+					forever.wait();
+				}
+			}
+		}
+	}
+
+	static class Finalizable
+	{
+		@Override
+		protected void finalize()
+		{
+			finalizedCount.incrementAndGet();
+		}
+	}
+
+	/**
+	 * @param args Takes one argument: the number of finalizable objects to create after the stuck one.
+	 */
+	public static void main(String[] args) throws InterruptedException
+	{
+		int objectCount = Integer.parseInt(args[0]);
+		long finishTime = System.currentTimeMillis() + 60000;
+
+		new Stuck();
+		while ((stuck.getCount() > 0) && (System.currentTimeMillis() < finishTime)) {
+			System.gc();
+			stuck.await(100, TimeUnit.MILLISECONDS);
+		}
+		if (stuck.getCount() > 0) {
+			System.out.println("FAIL: the stuck finalizer never ran");
+			return;
+		}
+
+		for (int i = 0; i < objectCount; i++) {
+			new Finalizable();
+		}
+
+		/* each runFinalization returns once the queue is drained, the stuck worker is abandoned after the cycle limit */
+		int rounds = 0;
+		while ((finalizedCount.get() < objectCount) && (System.currentTimeMillis() < finishTime)) {
+			System.gc();
+			System.runFinalization();
+			rounds += 1;
+		}
+
+		System.out.println("Finalized " + finalizedCount.get() + " of " + objectCount + " objects in " + rounds + " round(s)");
+		if (finalizedCount.get() == objectCount) {
+			System.out.println("PASS");
+		} else {
+			System.out.println("FAIL");
+		}
+	}
+}
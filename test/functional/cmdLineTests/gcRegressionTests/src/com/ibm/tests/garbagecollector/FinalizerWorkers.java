@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * Creates a backlog of finalizable objects and checks that System.runFinalization() drains it,
+ * whether the finalizer queue is processed by the primary worker alone or with assist workers
+ * (-Xgc:finalizeWorkerThreads=).
+ */
+public class FinalizerWorkers
+{
+	static final AtomicInteger finalizedCount = new AtomicInteger();
+	static final Set<String> finalizerThreads = ConcurrentHashMap.newKeySet();
+
+	static class Finalizable
+	{
+		@Override
+		protected void finalize()
+		{
+			finalizerThreads.add(Thread.currentThread().getName());
+			finalizedCount.incrementAndGet();
+		}
+	}
+
+	/**
+	 * @param args Takes one argument: the number of finalizable objects to create.
+	 */
+	public static void main(String[] args)
+	{
+		int objectCount = Integer.parseInt(args[0]);
+		for (int i = 0; i < objectCount; i++) {
+			new Finalizable();
+		}
+
+		/* runFinalization blocks while the queue is being drained, the loop only covers objects the GC has not discovered yet */
+		long finishTime = System.currentTimeMillis() + 60000;
+		while ((finalizedCount.get() < objectCount) && (System.currentTimeMillis() < finishTime)) {
+			System.gc();
+			System.runFinalization();
+		}
+
+		System.out.println("Finalized " + finalizedCount.get() + " of " + objectCount + " objects on " + finalizerThreads.size() + " thread(s)");
+		if (finalizedCount.get() == objectCount) {
+			System.out.println("PASS");
+		} else {
+			System.out.println("FAIL");
+		}
+	}
+}
@@ -0,0 +1,259 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+import java.io.BufferedInputStream;
+import java.io.DataInputStream;
+import java.io.EOFException;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.IOException;
+
+/**
+ * Thrown to trigger the heap dump agents of the test (-Xdump:heap:events=throw,filter=...HeapDumpTrigger).
+ */
+class HeapDumpTrigger extends RuntimeException
+{
+	private static final long serialVersionUID = 1L;
+}
+
+/**
+ * Writes a portable heap dump with the PARALLEL option and one without it for the same event, so both
+ * see the same heap, then parses both files and checks that they describe the same objects: the same
+ * number of object records at the same addresses, and the same number of references.
+ */
+public class HeapDumpParallelWalk
+{
+	static Object[] roots;
+
+	static class Node
+	{
+		Node next;
+		Object payload;
+		Object[] siblings;
+		int value;
+	}
+
+	/**
+	 * Summary of the object records of a portable heap dump.
+	 */
+	static class DumpSummary
+	{
+		long objectCount;
+		long referenceCount;
+		long addressChecksum;
+		long address;
+
+		void addObject(long gap, long references)
+		{
+			address += gap * 4;
+			objectCount += 1;
+			referenceCount += references;
+			addressChecksum = (addressChecksum * 31) + address;
+		}
+
+		public String toString()
+		{
+			return objectCount + " objects, " + referenceCount + " references, address checksum " + Long.toHexString(addressChecksum);
+		}
+	}
+
+	public static void main(String[] args) throws IOException
+	{
+		if (args.length != 2) {
+			System.out.println("FAIL: usage: HeapDumpParallelWalk <parallel dump file> <serial dump file>");
+			return;
+		}
+		File parallelFile = new File(args[0]);
+		File serialFile = new File(args[1]);
+		parallelFile.delete();
+		serialFile.delete();
+
+		buildHeap(200000);
+		try {
+			throw new HeapDumpTrigger();
+		} catch (HeapDumpTrigger e) {
+			/* both dump agents have run */
+		}
+
+		if (!parallelFile.exists() || !serialFile.exists()) {
+			System.out.println("FAIL: heap dumps " + parallelFile + " and " + serialFile + " were not written");
+			return;
+		}
+
+		DumpSummary parallel = summarize(parallelFile);
+		DumpSummary serial = summarize(serialFile);
+		System.out.println("parallel dump: " + parallel);
+		System.out.println("serial dump:   " + serial);
+
+		if ((parallel.objectCount == serial.objectCount)
+			&& (parallel.referenceCount == serial.referenceCount)
+			&& (parallel.addressChecksum == serial.addressChecksum)
+			&& (serial.objectCount > 200000)
+		) {
+			System.out.println("PASS");
+			parallelFile.delete();
+			serialFile.delete();
+		} else {
+			System.out.println("FAIL: the parallel heap dump does not match the serial heap dump");
+		}
+	}
+
+	/**
+	 * Allocate a mix of objects which use every kind of object record: nodes with up to four references,
+	 * hashed objects, reference arrays and primitive arrays.
+	 */
+	static void buildHeap(int count)
+	{
+		roots = new Object[count / 16];
+		Node previous = null;
+		for (int i = 0; i < count; i++) {
+			Node node = new Node();
+			node.value = i;
+			node.next = previous;
+			switch (i % 5) {
+			case 0:
+				node.payload = new int[i % 64];
+				break;
+			case 1:
+				node.payload = "node" + i;
+				break;
+			case 2:
+				node.siblings = new Object[(i % 9) + 1];
+				node.siblings[0] = previous;
+				break;
+			case 3:
+				System.identityHashCode(node);
+				break;
+			default:
+				node.payload = new long[(i % 3) * 512];
+				break;
+			}
+			previous = node;
+			if (0 == (i % 16)) {
+				roots[i / 16] = node;
+				previous = null;
+			}
+		}
+	}
+
+	static DumpSummary summarize(File file) throws IOException
+	{
+		DumpSummary summary = new DumpSummary();
+		DataInputStream in = new DataInputStream(new BufferedInputStream(new FileInputStream(file)));
+		try {
+			/* file header: identifier, version, flags */
+			in.skipBytes(in.readUnsignedShort());
+			in.readInt();
+			int flags = in.readInt();
+			int wordSize = (0 != (flags & 0x01)) ? 8 : 4;
+			boolean allHashed = (0 != (flags & 0x02));
+
+			if (0x01 != in.readUnsignedByte()) {
+				throw new IOException("missing header start tag");
+			}
+			for (int tag = in.readUnsignedByte(); 0x02 != tag; tag = in.readUnsignedByte()) {
+				if (0x04 != tag) {
+					throw new IOException("unexpected header tag " + tag);
+				}
+				in.skipBytes(in.readUnsignedShort());
+			}
+			if (0x02 != in.readUnsignedByte()) {
+				throw new IOException("missing dump start tag");
+			}
+
+			/* object records, up to the class records which the trailer writes */
+			for (;;) {
+				int tag = in.readUnsignedByte();
+				if (0 != (tag & 0x80)) {
+					/* short object record */
+					long gap = readNumber(in, 1 << ((tag >> 2) & 0x01));
+					int references = (tag >> 3) & 0x03;
+					skip(in, (allHashed ? 2 : 0) + (references * (1 << (tag & 0x03))));
+					summary.addObject(gap, references);
+				} else if (0 != (tag & 0x40)) {
+					/* medium object record */
+					long gap = readNumber(in, 1 << ((tag >> 2) & 0x01));
+					int references = (tag >> 3) & 0x07;
+					skip(in, wordSize + (allHashed ? 2 : 0) + (references * (1 << (tag & 0x03))));
+					summary.addObject(gap, references);
+				} else if (0 != (tag & 0x20)) {
+					/* primitive array record: gap, length, hash code, size */
+					int size = 1 << (tag & 0x03);
+					long gap = readNumber(in, size);
+					skip(in, size + (allHashed ? 2 : 0) + 4);
+					summary.addObject(gap, 0);
+				} else if ((0x04 == tag) || (0x08 == tag)) {
+					/* long object record or object array record */
+					int recordFlags = in.readUnsignedByte();
+					long gap = readNumber(in, 1 << ((recordFlags >> 6) & 0x03));
+					skip(in, wordSize + (allHashed ? 2 : ((0 != (recordFlags & 0x02)) ? 4 : 0)));
+					int references = in.readInt();
+					skip(in, references * (1 << ((recordFlags >> 4) & 0x03)));
+					if (0x08 == tag) {
+						/* array length and size */
+						skip(in, 8);
+					}
+					summary.addObject(gap, references);
+				} else if (0x07 == tag) {
+					/* long primitive array record: gap, length, hash code, size */
+					int recordFlags = in.readUnsignedByte();
+					int size = (0 != (recordFlags & 0x10)) ? wordSize : 1;
+					long gap = readNumber(in, size);
+					skip(in, size + ((0 != (recordFlags & 0x02)) ? 4 : 0) + 4);
+					summary.addObject(gap, 0);
+				} else if ((0x06 == tag) || (0x03 == tag)) {
+					/* class records or dump end */
+					break;
+				} else {
+					throw new IOException("unexpected record tag " + tag + " after " + summary);
+				}
+			}
+		} catch (EOFException e) {
+			throw new IOException("truncated heap dump " + file + " after " + summary, e);
+		} finally {
+			in.close();
+		}
+		return summary;
+	}
+
+	static long readNumber(DataInputStream in, int size) throws IOException
+	{
+		switch (size) {
+		case 1:
+			return in.readByte();
+		case 2:
+			return in.readShort();
+		case 4:
+			return in.readInt();
+		default:
+			return in.readLong();
+		}
+	}
+
+	static void skip(DataInputStream in, int length) throws IOException
+	{
+		if (length != in.skipBytes(length)) {
+			throw new EOFException();
+		}
+	}
+}
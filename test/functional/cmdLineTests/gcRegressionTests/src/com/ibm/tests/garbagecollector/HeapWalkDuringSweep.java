@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+import java.io.File;
+import java.io.IOException;
+
+/**
+ * Writes heap dumps in a loop while another thread keeps the heap churning under a large live set, so
+ * that with -XXgc:tarokEnableConcurrentGlobalSweep most dumps are requested while a concurrent global
+ * sweep is rebuilding the free lists. Every dump has to walk a consistent heap: each one must parse
+ * and contain the live set of the test.
+ */
+public class HeapWalkDuringSweep
+{
+	static final int CHUNK_SIZE = 4 * 1024;
+
+	static volatile boolean done;
+	static volatile boolean filled;
+
+	/**
+	 * @param args Takes three arguments: the heap dump file, the number of heap dumps to write, in the
+	 * range [1-100], and the percentage of the maximum heap to keep live, in the range [1-90].
+	 */
+	public static void main(String[] args) throws Exception
+	{
+		if (args.length != 3) {
+			System.out.println("FAIL: usage: HeapWalkDuringSweep <dump file> <dump count> <live%>");
+			return;
+		}
+		File dumpFile = new File(args[0]);
+		int dumpCount = Integer.parseInt(args[1]);
+		int livePercent = Integer.parseInt(args[2]);
+		if ((dumpCount < 1) || (dumpCount > 100) || (livePercent < 1) || (livePercent > 90)) {
+			System.out.println("FAIL: dump count must be in [1-100] and live percentage in [1-90]");
+			return;
+		}
+
+		long liveBytes = Runtime.getRuntime().maxMemory() / 100 * livePercent;
+		final byte[][] live = new byte[(int)(liveBytes / CHUNK_SIZE)][];
+		Thread churn = new Thread("HeapWalkDuringSweep churn") {
+			public void run() {
+				int next = 0;
+				while (!done) {
+					/* replace one live chunk for every few garbage chunks */
+					for (int i = 0; i < 3; i++) {
+						new byte[CHUNK_SIZE].hashCode();
+					}
+					live[next] = new byte[CHUNK_SIZE];
+					next = (next + 1) % live.length;
+					if (0 == next) {
+						filled = true;
+					}
+				}
+			}
+		};
+		churn.start();
+		/* dump only once the whole live set has been allocated */
+		while (!filled) {
+			Thread.sleep(10);
+		}
+
+		boolean passed = true;
+		try {
+			for (int dump = 0; (dump < dumpCount) && passed; dump++) {
+				dumpFile.delete();
+				try {
+					throw new HeapDumpTrigger();
+				} catch (HeapDumpTrigger e) {
+					/* the dump agent has run */
+				}
+				if (!dumpFile.exists()) {
+					System.out.println("FAIL: heap dump " + dumpFile + " was not written");
+					passed = false;
+				} else {
+					try {
+						HeapDumpParallelWalk.DumpSummary summary = HeapDumpParallelWalk.summarize(dumpFile);
+						if (summary.objectCount < live.length) {
+							System.out.println("FAIL: heap dump " + dump + " is missing objects: " + summary);
+							passed = false;
+						}
+					} catch (IOException e) {
+						System.out.println("FAIL: heap dump " + dump + " could not be parsed: " + e.getMessage());
+						passed = false;
+					}
+				}
+			}
+		} finally {
+			done = true;
+			churn.join();
+		}
+
+		if (passed) {
+			System.out.println("PASS");
+			dumpFile.delete();
+		}
+	}
+}
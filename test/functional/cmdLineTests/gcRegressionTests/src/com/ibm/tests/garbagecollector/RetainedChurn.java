@@ -0,0 +1,64 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+/**
+ * Allocates for a number of seconds while keeping a large, slowly replaced live set, so that a
+ * small heap sees partial collections that have to copy a lot of live data (and therefore some
+ * copy-forward aborts) rather than only collecting garbage.
+ */
+public class RetainedChurn
+{
+	static final int CHUNK_SIZE = 4 * 1024;
+
+	/**
+	 * @param args Takes two arguments: the number of seconds to run for, in the range [1-60], and the
+	 * percentage of the maximum heap to keep live, in the range [1-90].
+	 */
+	public static void main(String[] args)
+	{
+		int secondsToRun = Integer.parseInt(args[0]);
+		int livePercent = Integer.parseInt(args[1]);
+		if ((secondsToRun < 1) || (secondsToRun > 60) || (livePercent < 1) || (livePercent > 90)) {
+			System.err.println("Invalid arguments: seconds must be in [1-60] and live percentage in [1-90]");
+			System.exit(1);
+		}
+
+		long liveBytes = Runtime.getRuntime().maxMemory() / 100 * livePercent;
+		byte[][] live = new byte[(int)(liveBytes / CHUNK_SIZE)][];
+		long finishTime = System.currentTimeMillis() + (secondsToRun * 1000);
+		long allocated = 0;
+		int next = 0;
+
+		while (System.currentTimeMillis() < finishTime) {
+			/* replace one live chunk for every few garbage chunks */
+			for (int i = 0; i < 3; i++) {
+				new byte[CHUNK_SIZE].hashCode();
+			}
+			live[next] = new byte[CHUNK_SIZE];
+			next = (next + 1) % live.length;
+			allocated += 4;
+		}
+		System.out.println("Allocated " + allocated + " chunks");
+		System.out.println("Test ran to completion");
+	}
+}
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2024
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+package com.ibm.jvmti.tests.iterateThroughHeap;
+
+public class ith002
+{
+	static final int INSTANCE_COUNT = 20000;
+
+	static class Instance
+	{
+		int id;
+
+		Instance(int id)
+		{
+			this.id = id;
+		}
+	}
+
+	Instance[] instances;
+	Object[] garbage;
+	volatile boolean stopAllocating;
+
+	public boolean setup(String args)
+	{
+		/* interleave the instances with other objects so they spread over many regions */
+		instances = new Instance[INSTANCE_COUNT];
+		garbage = new Object[INSTANCE_COUNT];
+		for (int i = 0; i < INSTANCE_COUNT; i++) {
+			instances[i] = new Instance(i);
+			garbage[i] = new byte[64 + (i % 512)];
+		}
+		return true;
+	}
+
+	public boolean testClassFilterOrder()
+	{
+		return checkOrder(Instance.class, INSTANCE_COUNT);
+	}
+
+	public String helpClassFilterOrder()
+	{
+		return "Check that a class filtered IterateThroughHeap reports the same instances, in the same order, as an unfiltered walk";
+	}
+
+	public boolean testClassFilterOrderAfterGC()
+	{
+		garbage = null;
+		System.gc();
+		return checkOrder(Instance.class, INSTANCE_COUNT);
+	}
+
+	public String helpClassFilterOrderAfterGC()
+	{
+		return "Check the class filtered IterateThroughHeap order after a GC has compacted or copied the instances";
+	}
+
+	public boolean testClassFilterDuringConcurrentGC() throws InterruptedException
+	{
+		Thread allocator = new Thread() {
+			public void run() {
+				Object[] churn = new Object[1024];
+				int i = 0;
+				while (!stopAllocating) {
+					churn[i++ % churn.length] = new byte[1024 + (i % 4096)];
+				}
+			}
+		};
+
+		stopAllocating = false;
+		allocator.start();
+		boolean ret = true;
+		try {
+			/* concurrent GC phases started by the allocator must not break the parallel walk */
+			for (int i = 0; ret && (i < 50); i++) {
+				ret = checkOrder(Instance.class, INSTANCE_COUNT);
+			}
+		} finally {
+			stopAllocating = true;
+			allocator.join();
+		}
+		return ret;
+	}
+
+	public String helpClassFilterDuringConcurrentGC()
+	{
+		return "Check the class filtered IterateThroughHeap while another thread allocates and drives concurrent GC work";
+	}
+
+	public static native boolean checkOrder(Class klass, int expectedCount);
+}